@@ -210,6 +210,8 @@ public:
 
 	void SetUnicodeMode(bool unicodeMode_);
 	void SetDBCSMode(int codePage);
+
+	Surface *AllocateMeasuringSurface();
 };
 #ifdef SCI_NAMESPACE
 }
@@ -987,6 +989,31 @@ void SurfaceImpl::SetDBCSMode(int codePage) {
 		et = dbcs;
 }
 
+Surface *SurfaceImpl::AllocateMeasuringSurface() {
+#if PANGO_VERSION_CHECK(1,32,6)
+	if (!pcontext)
+		return 0;
+	// A font map of its own so the surface can be used on another thread.
+	// The context keeps a reference to the font map.
+	PangoFontMap *fontMap = pango_cairo_font_map_new();
+	SurfaceImpl *surface = new SurfaceImpl();
+	surface->pcontext = pango_font_map_create_context(fontMap);
+	g_object_unref(fontMap);
+	// Settings are copied here on the main thread, which is using this surface's context
+	pango_cairo_context_set_resolution(surface->pcontext, pango_cairo_context_get_resolution(pcontext));
+	const cairo_font_options_t *options = pango_cairo_context_get_font_options(pcontext);
+	if (options)
+		pango_cairo_context_set_font_options(surface->pcontext, options);
+	surface->layout = pango_layout_new(surface->pcontext);
+	surface->et = et;
+	surface->inited = true;
+	return surface;
+#else
+	// Before Pango 1.32.6 font maps were not safe to use from other threads
+	return 0;
+#endif
+}
+
 Surface *Surface::Allocate(int) {
 	return new SurfaceImpl();
 }
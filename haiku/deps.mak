@@ -27,8 +27,8 @@ Catalogue.o: ../src/Catalogue.cxx ../include/ILexer.h \
  ../lexlib/LexerModule.h ../src/Catalogue.h
 CellBuffer.o: ../src/CellBuffer.cxx ../include/Platform.h \
  ../include/Scintilla.h ../include/Sci_Position.h ../src/Position.h \
- ../src/SplitVector.h ../src/Partitioning.h ../src/CellBuffer.h \
- ../src/UniConversion.h
+ ../src/SplitVector.h ../src/Partitioning.h ../src/BlockedPartitioning.h \
+ ../src/CellBuffer.h ../src/UniConversion.h
 CharClassify.o: ../src/CharClassify.cxx ../src/CharClassify.h
 ContractionState.o: ../src/ContractionState.cxx ../include/Platform.h \
  ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h \
@@ -43,7 +43,7 @@ Document.o: ../src/Document.cxx ../include/Platform.h ../include/ILexer.h \
  ../src/Partitioning.h ../src/RunStyles.h ../src/CellBuffer.h \
  ../src/PerLine.h ../src/CharClassify.h ../src/Decoration.h \
  ../src/CaseFolder.h ../src/Document.h ../src/RESearch.h \
- ../src/UniConversion.h ../src/UnicodeFromUTF8.h
+ ../src/MultilineRegex.h ../src/UniConversion.h ../src/UnicodeFromUTF8.h
 EditModel.o: ../src/EditModel.cxx ../include/Platform.h \
  ../include/ILexer.h ../include/Sci_Position.h ../include/Scintilla.h \
  ../lexlib/StringCopy.h ../src/Position.h ../src/SplitVector.h \
@@ -95,6 +95,10 @@ MarginView.o: ../src/MarginView.cxx ../include/Platform.h \
  ../src/Document.h ../src/UniConversion.h ../src/Selection.h \
  ../src/PositionCache.h ../src/EditModel.h ../src/MarginView.h \
  ../src/EditView.h
+MultilineRegex.o: ../src/MultilineRegex.cxx ../include/Platform.h \
+ ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h \
+ ../src/RunStyles.h ../src/CellBuffer.h ../src/CharClassify.h \
+ ../src/MultilineRegex.h
 PerLine.o: ../src/PerLine.cxx ../include/Platform.h \
  ../include/Scintilla.h ../include/Sci_Position.h ../src/Position.h \
  ../src/SplitVector.h ../src/Partitioning.h ../src/CellBuffer.h \
@@ -106,7 +110,8 @@ PositionCache.o: ../src/PositionCache.cxx ../include/Platform.h \
  ../src/KeyMap.h ../src/Indicator.h ../src/XPM.h ../src/LineMarker.h \
  ../src/Style.h ../src/ViewStyle.h ../src/CharClassify.h \
  ../src/Decoration.h ../src/CaseFolder.h ../src/Document.h \
- ../src/UniConversion.h ../src/Selection.h ../src/PositionCache.h
+ ../src/UniConversion.h ../src/Selection.h ../src/PositionCache.h \
+ ../src/CompactPositions.h
 RESearch.o: ../src/RESearch.cxx ../src/Position.h ../src/CharClassify.h \
  ../src/RESearch.h
 RunStyles.o: ../src/RunStyles.cxx ../include/Platform.h \
@@ -341,6 +341,11 @@ public:
 
 	virtual void SetUnicodeMode(bool unicodeMode_)=0;
 	virtual void SetDBCSMode(int codePage)=0;
+
+	// Allocate a surface that measures text the same way as this surface but can not draw.
+	// Called on the main thread; the result may then be used by one other thread at a time.
+	// Returns NULL when the platform only measures text on its main thread.
+	virtual Surface *AllocateMeasuringSurface() { return 0; }
 };
 
 /**
@@ -397,6 +397,8 @@ typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam,
 #define SCFIND_REGEXP 0x00200000
 #define SCFIND_POSIX 0x00400000
 #define SCFIND_CXX11REGEX 0x00800000
+#define SCFIND_MULTILINE 0x01000000
+#define SCFIND_PARALLEL 0x02000000
 #define SCI_FINDTEXT 2150
 #define SCI_FORMATRANGE 2151
 #define SCI_GETFIRSTVISIBLELINE 2152
@@ -424,6 +426,10 @@ typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam,
 #define SCI_CANPASTE 2173
 #define SCI_CANUNDO 2174
 #define SCI_EMPTYUNDOBUFFER 2175
+#define SCI_SETUNDOLIMITBYTES 2698
+#define SCI_GETUNDOLIMITBYTES 2699
+#define SCI_SETUNDOCOMPRESSIONTHRESHOLD 2700
+#define SCI_GETUNDOCOMPRESSIONTHRESHOLD 2701
 #define SCI_UNDO 2176
 #define SCI_CUT 2177
 #define SCI_COPY 2178
@@ -449,8 +455,22 @@ typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam,
 #define SCI_REPLACETARGET 2194
 #define SCI_REPLACETARGETRE 2195
 #define SCI_SEARCHINTARGET 2197
+#define SCI_REPLACEALLINTARGET 2702
+#define SCI_FINDALLINTARGET 2705
+#define SCI_GETFOUNDSTART 2706
+#define SCI_GETFOUNDEND 2707
+#define SCI_GETFOUNDCOUNT 2708
+#define SCI_STARTSEARCHINTARGET 2709
+#define SCI_CANCELSEARCH 2710
+#define SC_SEARCHSTATUS_NONE 0
+#define SC_SEARCHSTATUS_RUNNING 1
+#define SC_SEARCHSTATUS_FINISHED 2
+#define SC_SEARCHSTATUS_CANCELLED 3
+#define SCI_GETSEARCHSTATUS 2711
 #define SCI_SETSEARCHFLAGS 2198
 #define SCI_GETSEARCHFLAGS 2199
+#define SCI_GETREGEXCACHEHITS 2703
+#define SCI_GETREGEXCACHEMISSES 2704
 #define SCI_CALLTIPSHOW 2200
 #define SCI_CALLTIPCANCEL 2201
 #define SCI_CALLTIPACTIVE 2202
@@ -541,12 +561,19 @@ typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam,
 #define SC_WRAPINDENT_INDENT 2
 #define SCI_SETWRAPINDENTMODE 2472
 #define SCI_GETWRAPINDENTMODE 2473
+#define SCI_SETWRAPTHREADS 2712
+#define SCI_GETWRAPTHREADS 2713
+#define SCI_SETWRAPESTIMATE 2714
+#define SCI_GETWRAPESTIMATE 2715
 #define SC_CACHE_NONE 0
 #define SC_CACHE_CARET 1
 #define SC_CACHE_PAGE 2
 #define SC_CACHE_DOCUMENT 3
 #define SCI_SETLAYOUTCACHE 2272
 #define SCI_GETLAYOUTCACHE 2273
+#define SCI_SETLAYOUTCACHEBUDGET 2716
+#define SCI_GETLAYOUTCACHEBUDGET 2717
+#define SCI_GETLAYOUTCACHEMEMORY 2718
 #define SCI_SETSCROLLWIDTH 2274
 #define SCI_GETSCROLLWIDTH 2275
 #define SCI_SETSCROLLWIDTHTRACKING 2516
@@ -940,7 +967,13 @@ typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam,
 #define SC_TECHNOLOGY_DIRECTWRITEDC 3
 #define SCI_SETTECHNOLOGY 2630
 #define SCI_GETTECHNOLOGY 2631
+#define SC_DOCUMENTOPTION_DEFAULT 0
+#define SC_DOCUMENTOPTION_STYLES_RUNS 0x1
+#define SC_DOCUMENTOPTION_STYLES_LAZY 0x2
+#define SC_DOCUMENTOPTION_TEXT_LARGE 0x100
+#define SC_DOCUMENTOPTION_TEXT_MAPPED 0x200
 #define SCI_CREATELOADER 2632
+#define SCI_GETDOCUMENTOPTIONS 2379
 #define SCI_FINDINDICATORSHOW 2640
 #define SCI_FINDINDICATORFLASH 2641
 #define SCI_FINDINDICATORHIDE 2642
@@ -1080,6 +1113,7 @@ typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam,
 #define SCN_FOCUSIN 2028
 #define SCN_FOCUSOUT 2029
 #define SCN_AUTOCCOMPLETED 2030
+#define SCN_SEARCHPROGRESS 2031
 /* --Autogenerated -- end of section automatically generated from Scintilla.iface */
 
 /* These structures are defined to be exactly the same shape as the Win32
@@ -1157,7 +1191,7 @@ struct SCNotification {
 	/* SCN_NEEDSHOWN, SCN_DWELLSTART, SCN_DWELLEND, SCN_CALLTIPCLICK, */
 	/* SCN_HOTSPOTCLICK, SCN_HOTSPOTDOUBLECLICK, SCN_HOTSPOTRELEASECLICK, */
 	/* SCN_INDICATORCLICK, SCN_INDICATORRELEASE, */
-	/* SCN_USERLISTSELECTION, SCN_AUTOCSELECTION */
+	/* SCN_USERLISTSELECTION, SCN_AUTOCSELECTION, SCN_SEARCHPROGRESS */
 
 	int ch;
 	/* SCN_CHARADDED, SCN_KEY, SCN_AUTOCCOMPLETED, SCN_AUTOCSELECTION, */
@@ -1170,7 +1204,7 @@ struct SCNotification {
 	const char *text;
 	/* SCN_MODIFIED, SCN_USERLISTSELECTION, SCN_AUTOCSELECTION, SCN_URIDROPPED */
 
-	Sci_Position length;		/* SCN_MODIFIED */
+	Sci_Position length;		/* SCN_MODIFIED, SCN_SEARCHPROGRESS */
 	Sci_Position linesAdded;	/* SCN_MODIFIED */
 	int message;	/* SCN_MACRORECORD */
 	uptr_t wParam;	/* SCN_MACRORECORD */
@@ -1184,7 +1218,7 @@ struct SCNotification {
 	int y;		/* SCN_DWELLSTART, SCN_DWELLEND */
 	int token;		/* SCN_MODIFIED with SC_MOD_CONTAINER */
 	Sci_Position annotationLinesAdded;	/* SCN_MODIFIED with SC_MOD_CHANGEANNOTATION */
-	int updated;	/* SCN_UPDATEUI */
+	int updated;	/* SCN_UPDATEUI, SCN_SEARCHPROGRESS */
 	int listCompletionMethod;
 	/* SCN_AUTOCSELECTION, SCN_AUTOCCOMPLETED, SCN_USERLISTSELECTION, */
 };
@@ -24,6 +24,9 @@ enum CharacterCategory {
 
 CharacterCategory CategoriseCharacter(int character);
 
+// Slower binary search over the ranges the tables of CategoriseCharacter are generated from.
+CharacterCategory CategoriseCharacterByRanges(int character);
+
 #ifdef SCI_NAMESPACE
 }
 #endif
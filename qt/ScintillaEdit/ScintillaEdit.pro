@@ -36,6 +36,7 @@ SOURCES += \
     ../../src/ScintillaBase.cxx \
     ../../src/RunStyles.cxx \
     ../../src/RESearch.cxx \
+    ../../src/MultilineRegex.cxx \
     ../../src/PositionCache.cxx \
     ../../src/PerLine.cxx \
     ../../src/MarginView.cxx \
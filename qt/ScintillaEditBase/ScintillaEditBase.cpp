@@ -759,6 +759,10 @@ void ScintillaEditBase::notifyParent(SCNotification scn)
 			emit autoCompleteCancelled();
 			break;
 
+		case SCN_SEARCHPROGRESS:
+			emit searchProgress(scn.position, scn.length, scn.updated);
+			break;
+
 		default:
 			return;
 	}
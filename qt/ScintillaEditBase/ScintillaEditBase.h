@@ -102,6 +102,7 @@ signals:
 	void callTipClick();
 	void autoCompleteSelection(int position, const QString &text);
 	void autoCompleteCancelled();
+	void searchProgress(int position, int length, int status);
 
 	// Base notifications for compatibility with other Scintilla implementations
 	void notify(SCNotification *pscn);
@@ -34,6 +34,7 @@ SOURCES += \
     ../../src/ScintillaBase.cxx \
     ../../src/RunStyles.cxx \
     ../../src/RESearch.cxx \
+    ../../src/MultilineRegex.cxx \
     ../../src/PositionCache.cxx \
     ../../src/PerLine.cxx \
     ../../src/MarginView.cxx \
@@ -80,7 +81,9 @@ HEADERS  += \
     ../../src/ScintillaBase.h \
     ../../src/RunStyles.h \
     ../../src/RESearch.h \
+    ../../src/MultilineRegex.h \
     ../../src/PositionCache.h \
+    ../../src/CompactPositions.h \
     ../../src/PerLine.h \
     ../../src/Partitioning.h \
     ../../src/LineMarker.h \
@@ -98,6 +101,7 @@ HEADERS  += \
     ../../src/CaseFolder.h \
     ../../src/CaseConvert.h \
     ../../src/CallTip.h \
+    ../../src/BlockedPartitioning.h \
     ../../src/AutoComplete.h \
     ../../include/Scintilla.h \
     ../../include/SciLexer.h \
@@ -3,18 +3,17 @@
 # Requires Python 3.3 or later
 # Should not be run with old versions of Python.
 
-# Current best approach divides case conversions into two cases:
-# simple symmetric and complex.
-# Simple symmetric is where a lower and upper case pair convert to each
-# other and the folded form is the same as the lower case.
-# There are 1006 symmetric pairs.
-# These are further divided into ranges (stored as lower, upper, range length,
-# range pitch and singletons (stored as lower, upper).
-# Complex is for cases that don't fit the above: where there are multiple
+# Case conversions are found by considering which characters are symmetric:
+# where a lower and upper case pair convert to each other and the folded form
+# is the same as the lower case, and which are complex: where there are multiple
 # characters in one of the forms or fold is different to lower or
-# lower(upper(x)) or upper(lower(x)) are not x. These are represented as UTF-8
-# strings with original, folded, upper, and lower separated by '|'.
-# There are 126 complex cases.
+# lower(upper(x)) or upper(lower(x)) are not x.
+# Each conversion (fold, upper, lower) is then written as a two level table so a
+# character is converted with two array lookups and no setup at run time.
+# The code points are divided into blocks of 128. A per-conversion array gives a
+# block number for each block of code points and the shared block data gives an
+# index into an array of UTF-8 conversion strings where 0 means no conversion.
+# Blocks with the same contents are only stored once.
 
 import codecs, itertools, os, string, sys, unicodedata
 
@@ -74,53 +73,93 @@ def conversionSets():
 
     return symmetrics, complexes
 
-def groupRanges(symmetrics):
-    # Group the symmetrics into groups where possible, returning a list
-    # of ranges and a list of symmetrics that didn't fit into a range
+blockShift = 7
+blockSize = 1 << blockShift
+maxConversionLength = 6
+
+def caseConversions(symmetrics, complexes):
+    # Return a dictionary from code point to converted string for each of
+    # fold, upper, and lower
+    fold = {}
+    upper = {}
+    lower = {}
+    for l, u, d in symmetrics:
+        fold[u] = chr(l)
+        upper[l] = chr(u)
+        lower[u] = chr(l)
+    for uch, f, u, l in complexes:
+        ch = ord(uch)
+        if f:
+            fold[ch] = f
+        if u:
+            upper[ch] = u
+        if l:
+            lower[ch] = l
+    return [fold, upper, lower]
+
+def blockTables(conversions):
+    # Return the conversion strings, the distinct blocks, and the block numbers
+    # of each conversion
+    strings = sorted(set(flatten(c.values() for c in conversions)), key=lambda s: ([ord(c) for c in s]))
+    stringIndex = dict((s, i+1) for i, s in enumerate(strings))
+    emptyBlock = tuple([0] * blockSize)
+    blocks = [emptyBlock]
+    blockNumbers = {emptyBlock: 0}
+    indexes = []
+    for conversion in conversions:
+        index = []
+        for b in range((max(conversion) >> blockShift) + 1):
+            block = tuple(stringIndex.get(conversion.get((b << blockShift) + i), 0) for i in range(blockSize))
+            if block not in blockNumbers:
+                blockNumbers[block] = len(blocks)
+                blocks.append(block)
+            index.append(blockNumbers[block])
+        indexes.append(index)
+    assert len(blocks) < 0x100
+    assert len(strings) < 0xffff
+    assert max(len(s.encode('utf-8')) for s in strings) <= maxConversionLength
+    return strings, blocks, indexes
+
+def numberLines(numbers, perLine):
+    return ["".join("%d," % n for n in numbers[i:i+perLine]) for i in range(0, len(numbers), perLine)]
 
-    def distance(s):
-        return s[2]
-
-    groups = []
-    uniquekeys = []
-    for k, g in itertools.groupby(symmetrics, distance):
-        groups.append(list(g))      # Store group iterator as a list
-        uniquekeys.append(k)
-
-    contiguousGroups = flatten([contiguousRanges(g, 1) for g in groups])
-    longGroups = [(x[0][0], x[0][1], len(x), 1) for x in contiguousGroups if len(x) > 4]
-
-    oneDiffs = [s for s in symmetrics if s[2] == 1]
-    contiguousOnes = flatten([contiguousRanges(g, 2) for g in [oneDiffs]])
-    longOneGroups = [(x[0][0], x[0][1], len(x), 2) for x in contiguousOnes if len(x) > 4]
+def escape(s):
+    # Hexadecimal escapes continue while there are hexadecimal digits so a following
+    # letter that could be a digit is also escaped
+    out = ""
+    escaped = False
+    for c in s.encode('utf-8'):
+        ch = chr(c)
+        if ch in string.ascii_letters and not (escaped and ch in string.hexdigits):
+            out += ch
+            escaped = False
+        else:
+            out += "\\x%x" % c
+            escaped = True
+    return out
 
-    rangeGroups = sorted(longGroups+longOneGroups, key=lambda s: s[0])
+def writeCaseConvert(conversions):
+    strings, blocks, indexes = blockTables(conversions)
 
-    rangeCoverage = list(flatten([range(r[0], r[0]+r[2]*r[3], r[3]) for r in rangeGroups]))
+    print(len(strings), "conversion strings")
+    print(len(blocks), "blocks")
 
-    nonRanges = [(l, u) for l, u, d in symmetrics if l not in rangeCoverage]
+    indexLines = [numberLines(index, 32) for index in indexes]
+    blockLines = []
+    for b, block in enumerate(blocks):
+        blockLines.append("// %d" % b)
+        blockLines.extend(numberLines(block, 32))
+    stringLines = ['"%s",' % escape(s) for s in strings]
 
-    return rangeGroups, nonRanges
-
-def escape(s):
-	return "".join((chr(c) if chr(c) in string.ascii_letters else "\\x%x" % c) for c in s.encode('utf-8'))
+    Regenerate("../src/CaseConvert.cxx", "//", indexLines[0], indexLines[1], indexLines[2],
+        blockLines, stringLines)
 
 def updateCaseConvert():
     symmetrics, complexes = conversionSets()
 
-    rangeGroups, nonRanges = groupRanges(symmetrics)
-
-    print(len(rangeGroups), "ranges")
-    rangeLines = ["%d,%d,%d,%d, " % x for x in rangeGroups]
-
-    print(len(nonRanges), "non ranges")
-    nonRangeLines = ["%d,%d, " % x for x in nonRanges]
-
     print(len(symmetrics), "symmetric")
+    print(len(complexes), "complex")
 
-    complexLines = ['"%s|%s|%s|%s|"' % tuple(escape(t) for t in x) for x in complexes]
-    print(len(complexLines), "complex")
-
-    Regenerate("../src/CaseConvert.cxx", "//", rangeLines, nonRangeLines, complexLines)
+    writeCaseConvert(caseConversions(symmetrics, complexes))
 
 updateCaseConvert()
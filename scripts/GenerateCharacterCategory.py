@@ -14,22 +14,58 @@ def findCategories(filename):
     print(values)
     return [v[2:] for v in values]
 
+# The category of each code point is also written as a two level table.
+# The code points are divided into blocks of 128. catBlocks gives a block number
+# for each block of code points and catBlockContents holds the category of each
+# code point in each distinct block.
+blockShift = 7
+blockSize = 1 << blockShift
+maxUnicode = 0x10ffff
+
+def blockTables(ranges):
+    # ranges is a list of (start of range, category number) in ascending order
+    categoryOfCharacter = []
+    for i, (start, category) in enumerate(ranges):
+        end = ranges[i+1][0] if i+1 < len(ranges) else maxUnicode + 1
+        categoryOfCharacter.extend([category] * (end - start))
+    blocks = []
+    blockNumbers = {}
+    index = []
+    for b in range((maxUnicode + 1) >> blockShift):
+        block = tuple(categoryOfCharacter[b * blockSize:(b + 1) * blockSize])
+        if block not in blockNumbers:
+            blockNumbers[block] = len(blocks)
+            blocks.append(block)
+        index.append(blockNumbers[block])
+    assert len(blocks) < 0x100
+    return index, blocks
+
+def numberLines(numbers, perLine):
+    return ["".join("%d," % n for n in numbers[i:i+perLine]) for i in range(0, len(numbers), perLine)]
+
 def updateCharacterCategory(filename):
     values = ["// Created with Python %s,  Unicode %s" % (
         platform.python_version(), unicodedata.unidata_version)]
+    ranges = []
     category = unicodedata.category(chr(0))
     startRange = 0
     for ch in range(sys.maxunicode):
         uch = chr(ch)
         if unicodedata.category(uch) != category:
-            value = startRange * 32 + categories.index(category)
-            values.append("%d," % value)
+            ranges.append((startRange, categories.index(category)))
             category = unicodedata.category(uch)
             startRange = ch
-    value = startRange * 32 + categories.index(category)
-    values.append("%d," % value)
+    ranges.append((startRange, categories.index(category)))
+    values.extend("%d," % (start * 32 + category) for start, category in ranges)
+
+    index, blocks = blockTables(ranges)
+    print(len(blocks), "blocks")
+    blockLines = []
+    for b, block in enumerate(blocks):
+        blockLines.append("// %d" % b)
+        blockLines.extend(numberLines(block, 32))
 
-    Regenerate(filename, "//", values)
+    Regenerate(filename, "//", values, numberLines(index, 32), blockLines)
 
 categories = findCategories("../lexlib/CharacterCategory.h")
 
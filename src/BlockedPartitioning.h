@@ -0,0 +1,339 @@
+// Scintilla source code edit control
+/** @file BlockedPartitioning.h
+ ** Partitioning that stores positions in blocks of offsets from a base position.
+ **/
+// Copyright 1998-2017 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef BLOCKEDPARTITIONING_H
+#define BLOCKEDPARTITIONING_H
+
+#ifdef SCI_NAMESPACE
+namespace Scintilla {
+#endif
+
+/// Divide an interval into multiple partitions with the same interface and
+/// behaviour as Partitioning.
+/// The partition start positions are held in blocks, each with a base position
+/// and int offsets from that base. Inserting text changes the offsets after the
+/// insertion point in one block and the bases of the following blocks so costs
+/// O(blockSize + partitions / blockSize) instead of O(partitions).
+/// When POS is wider than int, a block whose offsets would not fit in an int is
+/// split so each line start costs 4 bytes even for huge documents.
+
+template <typename POS>
+class BlockedPartitioning {
+private:
+	ptrdiff_t blockSize;
+	// Parallel vectors with one element per block
+	std::vector<POS> bases;	// Position of first element in block
+	std::vector<POS> firsts;	// Index of first element in block
+	std::vector<std::vector<int> > offsets;	// Positions relative to base, first is always 0
+
+	// Private so BlockedPartitioning objects can not be copied
+	BlockedPartitioning(const BlockedPartitioning &);
+
+	static bool FitsOffset(ptrdiff_t offset) {
+		return (offset >= INT_MIN) && (offset <= INT_MAX);
+	}
+
+	POS Count() const {
+		return firsts.back() + static_cast<POS>(offsets.back().size());
+	}
+
+	/// Return the block containing element index or the last block if index is after the end.
+	size_t BlockFromIndex(POS index) const {
+		return std::upper_bound(firsts.begin() + 1, firsts.end(), index) - firsts.begin() - 1;
+	}
+
+	/// Can delta be added to each offset in block from local onwards without overflowing.
+	bool DeltaFits(size_t block, size_t local, ptrdiff_t delta) const {
+		if (sizeof(POS) <= sizeof(int))
+			return true;
+		if (!FitsOffset(delta))
+			return false;
+		const std::vector<int> &blockOffsets = offsets[block];
+		for (size_t i = local; i < blockOffsets.size(); i++) {
+			if (!FitsOffset(blockOffsets[i] + delta))
+				return false;
+		}
+		return true;
+	}
+
+	void AddDelta(size_t block, size_t local, int delta) {
+		AddToArray(offsets[block].data() + local, offsets[block].size() - local, delta);
+	}
+
+	void AdjustFirsts(size_t blockStart, POS delta) {
+		for (size_t block = blockStart; block < firsts.size(); block++) {
+			firsts[block] += delta;
+		}
+	}
+
+	void InsertBlock(size_t block, POS first, POS base) {
+		bases.insert(bases.begin() + block, base);
+		firsts.insert(firsts.begin() + block, first);
+		offsets.insert(offsets.begin() + block, std::vector<int>(1, 0));
+		offsets[block].reserve(blockSize);
+	}
+
+	void EraseBlock(size_t block) {
+		bases.erase(bases.begin() + block);
+		firsts.erase(firsts.begin() + block);
+		offsets.erase(offsets.begin() + block);
+	}
+
+	/// Move the elements from local onwards in block into a new following block.
+	void SplitBlock(size_t block, size_t local) {
+		const int offsetSplit = offsets[block][local];
+		InsertBlock(block + 1, firsts[block] + static_cast<POS>(local), bases[block] + offsetSplit);
+		std::vector<int> &blockOffsets = offsets[block];
+		std::vector<int> &nextOffsets = offsets[block + 1];
+		nextOffsets.clear();
+		for (size_t i = local; i < blockOffsets.size(); i++) {
+			nextOffsets.push_back(blockOffsets[i] - offsetSplit);
+		}
+		blockOffsets.resize(local);
+	}
+
+	/// Combine a small block with the following block when the result is small.
+	void MergeIfSmall(size_t block) {
+		if ((block + 1 >= offsets.size()) ||
+			(static_cast<ptrdiff_t>(offsets[block].size() + offsets[block + 1].size()) > blockSize))
+			return;
+		const ptrdiff_t offsetNext = bases[block + 1] - bases[block];
+		const std::vector<int> &nextOffsets = offsets[block + 1];
+		for (size_t i = 0; i < nextOffsets.size(); i++) {
+			if (!FitsOffset(nextOffsets[i] + offsetNext))
+				return;
+		}
+		std::vector<int> &blockOffsets = offsets[block];
+		for (size_t i = 0; i < nextOffsets.size(); i++) {
+			blockOffsets.push_back(static_cast<int>(nextOffsets[i] + offsetNext));
+		}
+		EraseBlock(block + 1);
+	}
+
+	void Allocate() {
+		bases.assign(1, 0);
+		firsts.assign(1, 0);
+		offsets.assign(1, std::vector<int>());
+		offsets[0].reserve(blockSize);
+		offsets[0].push_back(0);	// This value stays 0 for ever
+		offsets[0].push_back(0);	// This is the end of the first partition and will be the start of the second
+	}
+
+public:
+	explicit BlockedPartitioning(ptrdiff_t blockSize_) : blockSize(blockSize_ < 4 ? 4 : blockSize_) {
+		Allocate();
+	}
+
+	~BlockedPartitioning() {
+	}
+
+	POS Partitions() const {
+		return Count() - 1;
+	}
+
+	void InsertPartition(POS partition, POS pos) {
+		size_t block = BlockFromIndex(partition);
+		size_t local = partition - firsts[block];
+		if ((local == 0) && (block > 0)) {
+			// Append to previous block so the base of this block does not change
+			block--;
+			local = offsets[block].size();
+		}
+		const ptrdiff_t offset = pos - bases[block];
+		if ((local == 0) || !FitsOffset(offset)) {
+			// Only at start of document or when too far from base so make a new block
+			size_t blockNew = block;
+			if (local > 0) {
+				if (local < offsets[block].size())
+					SplitBlock(block, local);
+				blockNew++;
+			}
+			InsertBlock(blockNew, partition, pos);
+			AdjustFirsts(blockNew + 1, 1);
+			return;
+		}
+		std::vector<int> &blockOffsets = offsets[block];
+		blockOffsets.insert(blockOffsets.begin() + local, static_cast<int>(offset));
+		AdjustFirsts(block + 1, 1);
+		if (static_cast<ptrdiff_t>(blockOffsets.size()) >= blockSize * 2) {
+			SplitBlock(block, blockOffsets.size() / 2);
+		}
+	}
+
+	void InsertPartitions(POS partition, const POS *positions, size_t length) {
+		if (length == 0)
+			return;
+		size_t block = BlockFromIndex(partition);
+		size_t local = partition - firsts[block];
+		if ((local == 0) && (block > 0)) {
+			block--;
+			local = offsets[block].size();
+		}
+		bool fits = local > 0;
+		for (size_t i = 0; fits && (i < length); i++) {
+			fits = FitsOffset(positions[i] - bases[block]);
+		}
+		if (!fits) {
+			for (size_t i = 0; i < length; i++) {
+				InsertPartition(partition + static_cast<POS>(i), positions[i]);
+			}
+			return;
+		}
+		std::vector<int> &blockOffsets = offsets[block];
+		blockOffsets.insert(blockOffsets.begin() + local, length, 0);
+		for (size_t i = 0; i < length; i++) {
+			blockOffsets[local + i] = static_cast<int>(positions[i] - bases[block]);
+		}
+		AdjustFirsts(block + 1, static_cast<POS>(length));
+		// Split from the end so each element is only moved once
+		while (static_cast<ptrdiff_t>(offsets[block].size()) >= blockSize * 2) {
+			SplitBlock(block, offsets[block].size() - blockSize);
+		}
+	}
+
+	void SetPartitionStartPosition(POS partition, POS pos) {
+		if ((partition < 0) || (partition >= Count())) {
+			return;
+		}
+		const size_t block = BlockFromIndex(partition);
+		const size_t local = partition - firsts[block];
+		if (local == 0) {
+			const ptrdiff_t delta = bases[block] - pos;
+			if (DeltaFits(block, 1, delta)) {
+				AddDelta(block, 1, static_cast<int>(delta));
+			} else {
+				SplitBlock(block, 1);
+			}
+			bases[block] = pos;
+		} else {
+			const ptrdiff_t offset = pos - bases[block];
+			if (FitsOffset(offset)) {
+				offsets[block][local] = static_cast<int>(offset);
+			} else {
+				SplitBlock(block, local);
+				bases[block + 1] = pos;
+			}
+		}
+	}
+
+	void InsertText(POS partitionInsert, POS delta) {
+		// Point all the partitions after the insertion point further along in the buffer
+		const POS index = partitionInsert + 1;
+		if ((delta == 0) || (index < 0) || (index >= Count()))
+			return;
+		size_t block = BlockFromIndex(index);
+		const size_t local = index - firsts[block];
+		if (local > 0) {
+			if (DeltaFits(block, local, delta)) {
+				AddDelta(block, local, static_cast<int>(delta));
+			} else {
+				// Following block moved by loop below
+				SplitBlock(block, local);
+			}
+			block++;
+		}
+		AddToArray(bases.data() + block, bases.size() - block, delta);
+	}
+
+	void RemovePartition(POS partition) {
+		if ((partition < 0) || (partition >= Count())) {
+			return;
+		}
+		const size_t block = BlockFromIndex(partition);
+		const size_t local = partition - firsts[block];
+		std::vector<int> &blockOffsets = offsets[block];
+		if (blockOffsets.size() == 1) {
+			EraseBlock(block);
+			AdjustFirsts(block, -1);
+		} else {
+			if (local == 0) {
+				// Rebase on the second element
+				const int shift = blockOffsets[1];
+				if (DeltaFits(block, 1, -static_cast<ptrdiff_t>(shift))) {
+					AddDelta(block, 1, -shift);
+					bases[block] += shift;
+				} else {
+					SplitBlock(block, 1);
+					EraseBlock(block);
+					AdjustFirsts(block, -1);
+					return;
+				}
+			}
+			blockOffsets.erase(blockOffsets.begin() + local);
+			AdjustFirsts(block + 1, -1);
+			if (static_cast<ptrdiff_t>(blockOffsets.size()) < blockSize / 4) {
+				MergeIfSmall(block);
+			}
+		}
+	}
+
+	void RemovePartitions(POS partition, POS lengthRemove) {
+		while (lengthRemove > 0) {
+			if ((partition < 0) || (partition >= Count())) {
+				return;
+			}
+			const size_t block = BlockFromIndex(partition);
+			const size_t local = partition - firsts[block];
+			std::vector<int> &blockOffsets = offsets[block];
+			const size_t available = blockOffsets.size() - local;
+			const size_t lengthBlock = (static_cast<size_t>(lengthRemove) < available) ?
+				static_cast<size_t>(lengthRemove) : available;
+			if (local == 0) {
+				// Move any remaining elements to a new block based on the first of them
+				if (lengthBlock < blockOffsets.size())
+					SplitBlock(block, lengthBlock);
+				EraseBlock(block);
+				AdjustFirsts(block, -static_cast<POS>(lengthBlock));
+			} else {
+				blockOffsets.erase(blockOffsets.begin() + local, blockOffsets.begin() + local + lengthBlock);
+				AdjustFirsts(block + 1, -static_cast<POS>(lengthBlock));
+				if (static_cast<ptrdiff_t>(blockOffsets.size()) < blockSize / 4) {
+					MergeIfSmall(block);
+				}
+			}
+			lengthRemove -= static_cast<POS>(lengthBlock);
+		}
+	}
+
+	POS PositionFromPartition(POS partition) const {
+		PLATFORM_ASSERT(partition >= 0);
+		PLATFORM_ASSERT(partition < Count());
+		if ((partition < 0) || (partition >= Count())) {
+			return 0;
+		}
+		const size_t block = BlockFromIndex(partition);
+		return bases[block] + offsets[block][partition - firsts[block]];
+	}
+
+	/// Return value in range [0 .. Partitions() - 1] even for arguments outside interval
+	POS PartitionFromPosition(POS pos) const {
+		const POS count = Count();
+		if (count <= 1)
+			return 0;
+		if (pos >= PositionFromPartition(count - 1))
+			return count - 1 - 1;
+		const typename std::vector<POS>::const_iterator itBlock = std::upper_bound(bases.begin(), bases.end(), pos);
+		if (itBlock == bases.begin())
+			return 0;
+		const size_t block = itBlock - bases.begin() - 1;
+		const ptrdiff_t offset = pos - bases[block];
+		const std::vector<int> &blockOffsets = offsets[block];
+		const size_t local = std::upper_bound(blockOffsets.begin() + 1, blockOffsets.end(), offset,
+			[](ptrdiff_t a, int b) { return a < b; }) - blockOffsets.begin() - 1;
+		return firsts[block] + static_cast<POS>(local);
+	}
+
+	void DeleteAll() {
+		Allocate();
+	}
+};
+
+#ifdef SCI_NAMESPACE
+}
+#endif
+
+#endif
@@ -10,10 +10,6 @@
 
 #include <cstring>
 
-#include <stdexcept>
-#include <vector>
-#include <algorithm>
-
 #include "StringCopy.h"
 #include "CaseConvert.h"
 #include "UniConversion.h"
@@ -26,388 +22,2638 @@ using namespace Scintilla;
 namespace {
 	// Use an unnamed namespace to protect the declarations from name conflicts
 
-// Unicode code points are ordered by groups and follow patterns.
-// Most characters (pitch==1) are in ranges for a particular alphabet and their
-// upper case forms are a fixed distance away.
-// Another pattern (pitch==2) is where each lower case letter is preceded by
-// the upper case form. These are also grouped into ranges.
+// Each conversion is a two level table so converting a character needs no searching.
+// The block of a character (character >> blockShift) selects a block number from the
+// conversion's array of block numbers. Blocks with the same contents are stored once in
+// blockConversions and shared between conversions. The character's position in its block
+// then gives an index into caseConversionStrings where 0 means there is no conversion.
+
+enum { blockShift=7, blockSize=1 << blockShift, blockMask=blockSize-1 };
 
-int symmetricCaseConversionRanges[] = {
-//lower, upper, range length, range pitch
+// Maximum length of a case conversion result is 6 bytes in UTF-8
+enum { maxConversionLength=6 };
+
+const unsigned char foldBlocks[] = {
 //++Autogenerated -- start of section automatically generated
 //**\(\*\n\)
-97,65,26,1, 
-224,192,23,1, 
-248,216,7,1, 
-257,256,24,2, 
-314,313,8,2, 
-331,330,23,2, 
-462,461,8,2, 
-479,478,9,2, 
-505,504,20,2, 
-547,546,9,2, 
-583,582,5,2, 
-945,913,17,1, 
-963,931,9,1, 
-985,984,12,2, 
-1072,1040,32,1, 
-1104,1024,16,1, 
-1121,1120,17,2, 
-1163,1162,27,2, 
-1218,1217,7,2, 
-1233,1232,44,2, 
-1377,1329,38,1, 
-7681,7680,75,2, 
-7841,7840,48,2, 
-7936,7944,8,1, 
-7952,7960,6,1, 
-7968,7976,8,1, 
-7984,7992,8,1, 
-8000,8008,6,1, 
-8032,8040,8,1, 
-8560,8544,16,1, 
-9424,9398,26,1, 
-11312,11264,47,1, 
-11393,11392,50,2, 
-11520,4256,38,1, 
-42561,42560,23,2, 
-42625,42624,12,2, 
-42787,42786,7,2, 
-42803,42802,31,2, 
-42879,42878,5,2, 
-42913,42912,5,2, 
-65345,65313,26,1, 
-66600,66560,40,1, 
+1,2,3,4,5,0,6,7,8,9,10,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,14,15,16,
+0,0,17,18,0,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,21,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,22,23,24,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,27,0,
+0,0,0,0,0,0,0,0,28,
 
 //--Autogenerated -- end of section automatically generated
 };
 
-// Code points that are symmetric but don't fit into a range of similar characters
-// are listed here.
-
-int symmetricCaseConversions[] = {
-//lower, upper
+const unsigned char upperBlocks[] = {
 //++Autogenerated -- start of section automatically generated
 //**1 \(\*\n\)
-255,376, 
-307,306, 
-309,308, 
-311,310, 
-378,377, 
-380,379, 
-382,381, 
-384,579, 
-387,386, 
-389,388, 
-392,391, 
-396,395, 
-402,401, 
-405,502, 
-409,408, 
-410,573, 
-414,544, 
-417,416, 
-419,418, 
-421,420, 
-424,423, 
-429,428, 
-432,431, 
-436,435, 
-438,437, 
-441,440, 
-445,444, 
-447,503, 
-454,452, 
-457,455, 
-460,458, 
-477,398, 
-499,497, 
-501,500, 
-572,571, 
-575,11390, 
-576,11391, 
-578,577, 
-592,11375, 
-593,11373, 
-594,11376, 
-595,385, 
-596,390, 
-598,393, 
-599,394, 
-601,399, 
-603,400, 
-608,403, 
-611,404, 
-613,42893, 
-614,42922, 
-616,407, 
-617,406, 
-619,11362, 
-623,412, 
-625,11374, 
-626,413, 
-629,415, 
-637,11364, 
-640,422, 
-643,425, 
-648,430, 
-649,580, 
-650,433, 
-651,434, 
-652,581, 
-658,439, 
-881,880, 
-883,882, 
-887,886, 
-891,1021, 
-892,1022, 
-893,1023, 
-940,902, 
-941,904, 
-942,905, 
-943,906, 
-972,908, 
-973,910, 
-974,911, 
-983,975, 
-1010,1017, 
-1016,1015, 
-1019,1018, 
-1231,1216, 
-7545,42877, 
-7549,11363, 
-8017,8025, 
-8019,8027, 
-8021,8029, 
-8023,8031, 
-8048,8122, 
-8049,8123, 
-8050,8136, 
-8051,8137, 
-8052,8138, 
-8053,8139, 
-8054,8154, 
-8055,8155, 
-8056,8184, 
-8057,8185, 
-8058,8170, 
-8059,8171, 
-8060,8186, 
-8061,8187, 
-8112,8120, 
-8113,8121, 
-8144,8152, 
-8145,8153, 
-8160,8168, 
-8161,8169, 
-8165,8172, 
-8526,8498, 
-8580,8579, 
-11361,11360, 
-11365,570, 
-11366,574, 
-11368,11367, 
-11370,11369, 
-11372,11371, 
-11379,11378, 
-11382,11381, 
-11500,11499, 
-11502,11501, 
-11507,11506, 
-11559,4295, 
-11565,4301, 
-42874,42873, 
-42876,42875, 
-42892,42891, 
-42897,42896, 
-42899,42898, 
+29,30,31,32,33,34,35,36,37,38,39,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,42,43,44,45,
+0,0,46,47,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,50,51,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,52,53,54,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,57,0,
+0,0,0,0,0,0,0,0,58,
 
 //--Autogenerated -- end of section automatically generated
 };
 
-// Characters that have complex case conversions are listed here.
-// This includes cases where more than one character is needed for a conversion,
-// folding is different to lowering, or (as appropriate) upper(lower(x)) != x or
-// lower(upper(x)) != x.
-
-const char *complexCaseConversions =
-// Original | Folded | Upper | Lower |
+const unsigned char lowerBlocks[] = {
 //++Autogenerated -- start of section automatically generated
 //**2 \(\*\n\)
-"\xc2\xb5|\xce\xbc|\xce\x9c||"
-"\xc3\x9f|ss|SS||"
-"\xc4\xb0|i\xcc\x87||i\xcc\x87|"
-"\xc4\xb1||I||"
-"\xc5\x89|\xca\xbcn|\xca\xbcN||"
-"\xc5\xbf|s|S||"
-"\xc7\x85|\xc7\x86|\xc7\x84|\xc7\x86|"
-"\xc7\x88|\xc7\x89|\xc7\x87|\xc7\x89|"
-"\xc7\x8b|\xc7\x8c|\xc7\x8a|\xc7\x8c|"
-"\xc7\xb0|j\xcc\x8c|J\xcc\x8c||"
-"\xc7\xb2|\xc7\xb3|\xc7\xb1|\xc7\xb3|"
-"\xcd\x85|\xce\xb9|\xce\x99||"
-"\xce\x90|\xce\xb9\xcc\x88\xcc\x81|\xce\x99\xcc\x88\xcc\x81||"
-"\xce\xb0|\xcf\x85\xcc\x88\xcc\x81|\xce\xa5\xcc\x88\xcc\x81||"
-"\xcf\x82|\xcf\x83|\xce\xa3||"
-"\xcf\x90|\xce\xb2|\xce\x92||"
-"\xcf\x91|\xce\xb8|\xce\x98||"
-"\xcf\x95|\xcf\x86|\xce\xa6||"
-"\xcf\x96|\xcf\x80|\xce\xa0||"
-"\xcf\xb0|\xce\xba|\xce\x9a||"
-"\xcf\xb1|\xcf\x81|\xce\xa1||"
-"\xcf\xb4|\xce\xb8||\xce\xb8|"
-"\xcf\xb5|\xce\xb5|\xce\x95||"
-"\xd6\x87|\xd5\xa5\xd6\x82|\xd4\xb5\xd5\x92||"
-"\xe1\xba\x96|h\xcc\xb1|H\xcc\xb1||"
-"\xe1\xba\x97|t\xcc\x88|T\xcc\x88||"
-"\xe1\xba\x98|w\xcc\x8a|W\xcc\x8a||"
-"\xe1\xba\x99|y\xcc\x8a|Y\xcc\x8a||"
-"\xe1\xba\x9a|a\xca\xbe|A\xca\xbe||"
-"\xe1\xba\x9b|\xe1\xb9\xa1|\xe1\xb9\xa0||"
-"\xe1\xba\x9e|ss||\xc3\x9f|"
-"\xe1\xbd\x90|\xcf\x85\xcc\x93|\xce\xa5\xcc\x93||"
-"\xe1\xbd\x92|\xcf\x85\xcc\x93\xcc\x80|\xce\xa5\xcc\x93\xcc\x80||"
-"\xe1\xbd\x94|\xcf\x85\xcc\x93\xcc\x81|\xce\xa5\xcc\x93\xcc\x81||"
-"\xe1\xbd\x96|\xcf\x85\xcc\x93\xcd\x82|\xce\xa5\xcc\x93\xcd\x82||"
-"\xe1\xbe\x80|\xe1\xbc\x80\xce\xb9|\xe1\xbc\x88\xce\x99||"
-"\xe1\xbe\x81|\xe1\xbc\x81\xce\xb9|\xe1\xbc\x89\xce\x99||"
-"\xe1\xbe\x82|\xe1\xbc\x82\xce\xb9|\xe1\xbc\x8a\xce\x99||"
-"\xe1\xbe\x83|\xe1\xbc\x83\xce\xb9|\xe1\xbc\x8b\xce\x99||"
-"\xe1\xbe\x84|\xe1\xbc\x84\xce\xb9|\xe1\xbc\x8c\xce\x99||"
-"\xe1\xbe\x85|\xe1\xbc\x85\xce\xb9|\xe1\xbc\x8d\xce\x99||"
-"\xe1\xbe\x86|\xe1\xbc\x86\xce\xb9|\xe1\xbc\x8e\xce\x99||"
-"\xe1\xbe\x87|\xe1\xbc\x87\xce\xb9|\xe1\xbc\x8f\xce\x99||"
-"\xe1\xbe\x88|\xe1\xbc\x80\xce\xb9|\xe1\xbc\x88\xce\x99|\xe1\xbe\x80|"
-"\xe1\xbe\x89|\xe1\xbc\x81\xce\xb9|\xe1\xbc\x89\xce\x99|\xe1\xbe\x81|"
-"\xe1\xbe\x8a|\xe1\xbc\x82\xce\xb9|\xe1\xbc\x8a\xce\x99|\xe1\xbe\x82|"
-"\xe1\xbe\x8b|\xe1\xbc\x83\xce\xb9|\xe1\xbc\x8b\xce\x99|\xe1\xbe\x83|"
-"\xe1\xbe\x8c|\xe1\xbc\x84\xce\xb9|\xe1\xbc\x8c\xce\x99|\xe1\xbe\x84|"
-"\xe1\xbe\x8d|\xe1\xbc\x85\xce\xb9|\xe1\xbc\x8d\xce\x99|\xe1\xbe\x85|"
-"\xe1\xbe\x8e|\xe1\xbc\x86\xce\xb9|\xe1\xbc\x8e\xce\x99|\xe1\xbe\x86|"
-"\xe1\xbe\x8f|\xe1\xbc\x87\xce\xb9|\xe1\xbc\x8f\xce\x99|\xe1\xbe\x87|"
-"\xe1\xbe\x90|\xe1\xbc\xa0\xce\xb9|\xe1\xbc\xa8\xce\x99||"
-"\xe1\xbe\x91|\xe1\xbc\xa1\xce\xb9|\xe1\xbc\xa9\xce\x99||"
-"\xe1\xbe\x92|\xe1\xbc\xa2\xce\xb9|\xe1\xbc\xaa\xce\x99||"
-"\xe1\xbe\x93|\xe1\xbc\xa3\xce\xb9|\xe1\xbc\xab\xce\x99||"
-"\xe1\xbe\x94|\xe1\xbc\xa4\xce\xb9|\xe1\xbc\xac\xce\x99||"
-"\xe1\xbe\x95|\xe1\xbc\xa5\xce\xb9|\xe1\xbc\xad\xce\x99||"
-"\xe1\xbe\x96|\xe1\xbc\xa6\xce\xb9|\xe1\xbc\xae\xce\x99||"
-"\xe1\xbe\x97|\xe1\xbc\xa7\xce\xb9|\xe1\xbc\xaf\xce\x99||"
-"\xe1\xbe\x98|\xe1\xbc\xa0\xce\xb9|\xe1\xbc\xa8\xce\x99|\xe1\xbe\x90|"
-"\xe1\xbe\x99|\xe1\xbc\xa1\xce\xb9|\xe1\xbc\xa9\xce\x99|\xe1\xbe\x91|"
-"\xe1\xbe\x9a|\xe1\xbc\xa2\xce\xb9|\xe1\xbc\xaa\xce\x99|\xe1\xbe\x92|"
-"\xe1\xbe\x9b|\xe1\xbc\xa3\xce\xb9|\xe1\xbc\xab\xce\x99|\xe1\xbe\x93|"
-"\xe1\xbe\x9c|\xe1\xbc\xa4\xce\xb9|\xe1\xbc\xac\xce\x99|\xe1\xbe\x94|"
-"\xe1\xbe\x9d|\xe1\xbc\xa5\xce\xb9|\xe1\xbc\xad\xce\x99|\xe1\xbe\x95|"
-"\xe1\xbe\x9e|\xe1\xbc\xa6\xce\xb9|\xe1\xbc\xae\xce\x99|\xe1\xbe\x96|"
-"\xe1\xbe\x9f|\xe1\xbc\xa7\xce\xb9|\xe1\xbc\xaf\xce\x99|\xe1\xbe\x97|"
-"\xe1\xbe\xa0|\xe1\xbd\xa0\xce\xb9|\xe1\xbd\xa8\xce\x99||"
-"\xe1\xbe\xa1|\xe1\xbd\xa1\xce\xb9|\xe1\xbd\xa9\xce\x99||"
-"\xe1\xbe\xa2|\xe1\xbd\xa2\xce\xb9|\xe1\xbd\xaa\xce\x99||"
-"\xe1\xbe\xa3|\xe1\xbd\xa3\xce\xb9|\xe1\xbd\xab\xce\x99||"
-"\xe1\xbe\xa4|\xe1\xbd\xa4\xce\xb9|\xe1\xbd\xac\xce\x99||"
-"\xe1\xbe\xa5|\xe1\xbd\xa5\xce\xb9|\xe1\xbd\xad\xce\x99||"
-"\xe1\xbe\xa6|\xe1\xbd\xa6\xce\xb9|\xe1\xbd\xae\xce\x99||"
-"\xe1\xbe\xa7|\xe1\xbd\xa7\xce\xb9|\xe1\xbd\xaf\xce\x99||"
-"\xe1\xbe\xa8|\xe1\xbd\xa0\xce\xb9|\xe1\xbd\xa8\xce\x99|\xe1\xbe\xa0|"
-"\xe1\xbe\xa9|\xe1\xbd\xa1\xce\xb9|\xe1\xbd\xa9\xce\x99|\xe1\xbe\xa1|"
-"\xe1\xbe\xaa|\xe1\xbd\xa2\xce\xb9|\xe1\xbd\xaa\xce\x99|\xe1\xbe\xa2|"
-"\xe1\xbe\xab|\xe1\xbd\xa3\xce\xb9|\xe1\xbd\xab\xce\x99|\xe1\xbe\xa3|"
-"\xe1\xbe\xac|\xe1\xbd\xa4\xce\xb9|\xe1\xbd\xac\xce\x99|\xe1\xbe\xa4|"
-"\xe1\xbe\xad|\xe1\xbd\xa5\xce\xb9|\xe1\xbd\xad\xce\x99|\xe1\xbe\xa5|"
-"\xe1\xbe\xae|\xe1\xbd\xa6\xce\xb9|\xe1\xbd\xae\xce\x99|\xe1\xbe\xa6|"
-"\xe1\xbe\xaf|\xe1\xbd\xa7\xce\xb9|\xe1\xbd\xaf\xce\x99|\xe1\xbe\xa7|"
-"\xe1\xbe\xb2|\xe1\xbd\xb0\xce\xb9|\xe1\xbe\xba\xce\x99||"
-"\xe1\xbe\xb3|\xce\xb1\xce\xb9|\xce\x91\xce\x99||"
-"\xe1\xbe\xb4|\xce\xac\xce\xb9|\xce\x86\xce\x99||"
-"\xe1\xbe\xb6|\xce\xb1\xcd\x82|\xce\x91\xcd\x82||"
-"\xe1\xbe\xb7|\xce\xb1\xcd\x82\xce\xb9|\xce\x91\xcd\x82\xce\x99||"
-"\xe1\xbe\xbc|\xce\xb1\xce\xb9|\xce\x91\xce\x99|\xe1\xbe\xb3|"
-"\xe1\xbe\xbe|\xce\xb9|\xce\x99||"
-"\xe1\xbf\x82|\xe1\xbd\xb4\xce\xb9|\xe1\xbf\x8a\xce\x99||"
-"\xe1\xbf\x83|\xce\xb7\xce\xb9|\xce\x97\xce\x99||"
-"\xe1\xbf\x84|\xce\xae\xce\xb9|\xce\x89\xce\x99||"
-"\xe1\xbf\x86|\xce\xb7\xcd\x82|\xce\x97\xcd\x82||"
-"\xe1\xbf\x87|\xce\xb7\xcd\x82\xce\xb9|\xce\x97\xcd\x82\xce\x99||"
-"\xe1\xbf\x8c|\xce\xb7\xce\xb9|\xce\x97\xce\x99|\xe1\xbf\x83|"
-"\xe1\xbf\x92|\xce\xb9\xcc\x88\xcc\x80|\xce\x99\xcc\x88\xcc\x80||"
-"\xe1\xbf\x93|\xce\xb9\xcc\x88\xcc\x81|\xce\x99\xcc\x88\xcc\x81||"
-"\xe1\xbf\x96|\xce\xb9\xcd\x82|\xce\x99\xcd\x82||"
-"\xe1\xbf\x97|\xce\xb9\xcc\x88\xcd\x82|\xce\x99\xcc\x88\xcd\x82||"
-"\xe1\xbf\xa2|\xcf\x85\xcc\x88\xcc\x80|\xce\xa5\xcc\x88\xcc\x80||"
-"\xe1\xbf\xa3|\xcf\x85\xcc\x88\xcc\x81|\xce\xa5\xcc\x88\xcc\x81||"
-"\xe1\xbf\xa4|\xcf\x81\xcc\x93|\xce\xa1\xcc\x93||"
-"\xe1\xbf\xa6|\xcf\x85\xcd\x82|\xce\xa5\xcd\x82||"
-"\xe1\xbf\xa7|\xcf\x85\xcc\x88\xcd\x82|\xce\xa5\xcc\x88\xcd\x82||"
-"\xe1\xbf\xb2|\xe1\xbd\xbc\xce\xb9|\xe1\xbf\xba\xce\x99||"
-"\xe1\xbf\xb3|\xcf\x89\xce\xb9|\xce\xa9\xce\x99||"
-"\xe1\xbf\xb4|\xcf\x8e\xce\xb9|\xce\x8f\xce\x99||"
-"\xe1\xbf\xb6|\xcf\x89\xcd\x82|\xce\xa9\xcd\x82||"
-"\xe1\xbf\xb7|\xcf\x89\xcd\x82\xce\xb9|\xce\xa9\xcd\x82\xce\x99||"
-"\xe1\xbf\xbc|\xcf\x89\xce\xb9|\xce\xa9\xce\x99|\xe1\xbf\xb3|"
-"\xe2\x84\xa6|\xcf\x89||\xcf\x89|"
-"\xe2\x84\xaa|k||k|"
-"\xe2\x84\xab|\xc3\xa5||\xc3\xa5|"
-"\xef\xac\x80|ff|FF||"
-"\xef\xac\x81|fi|FI||"
-"\xef\xac\x82|fl|FL||"
-"\xef\xac\x83|ffi|FFI||"
-"\xef\xac\x84|ffl|FFL||"
-"\xef\xac\x85|st|ST||"
-"\xef\xac\x86|st|ST||"
-"\xef\xac\x93|\xd5\xb4\xd5\xb6|\xd5\x84\xd5\x86||"
-"\xef\xac\x94|\xd5\xb4\xd5\xa5|\xd5\x84\xd4\xb5||"
-"\xef\xac\x95|\xd5\xb4\xd5\xab|\xd5\x84\xd4\xbb||"
-"\xef\xac\x96|\xd5\xbe\xd5\xb6|\xd5\x8e\xd5\x86||"
-"\xef\xac\x97|\xd5\xb4\xd5\xad|\xd5\x84\xd4\xbd||"
+1,59,60,61,5,0,62,63,8,9,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,64,65,66,
+0,0,17,18,0,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,21,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,22,23,24,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,
+0,0,0,0,0,0,0,0,28,
 
 //--Autogenerated -- end of section automatically generated
-;
+};
 
-class CaseConverter : public ICaseConverter {
-	// Maximum length of a case conversion result is 6 bytes in UTF-8
-	enum { maxConversionLength=6 };
-	struct ConversionString {
-		char conversion[maxConversionLength+1];
-		ConversionString() {
-			conversion[0] = '\0';
-		}
-	};
-	// Conversions are initially store in a vector of structs but then decomposed into
-	// parallel arrays as that is about 10% faster to search.
-	struct CharacterConversion {
-		int character;
-		ConversionString conversion;
-		CharacterConversion(int character_=0, const char *conversion_="") : character(character_) {
-			StringCopy(conversion.conversion, conversion_);
-		}
-		bool operator<(const CharacterConversion &other) const {
-			return character < other.character;
-		}
-	};
-	typedef std::vector<CharacterConversion> CharacterToConversion;
-	CharacterToConversion characterToConversion;
-	// The parallel arrays
-	std::vector<int> characters;
-	std::vector<ConversionString> conversions;
+const unsigned short blockConversions[] = {
+//++Autogenerated -- start of section automatically generated
+//**3 \(\*\n\)
+// 0
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 1
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,40,42,43,44,45,46,52,53,55,57,59,60,61,62,63,64,65,66,67,70,72,73,74,76,77,79,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 2
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,575,0,0,0,0,0,0,0,0,0,0,
+111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,130,131,132,133,0,134,135,136,137,138,139,140,68,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 3
+143,0,145,0,147,0,149,0,151,0,153,0,155,0,157,0,159,0,161,0,163,0,165,0,167,0,169,0,171,0,173,0,
+175,0,177,0,179,0,181,0,183,0,185,0,187,0,189,0,56,0,191,0,193,0,195,0,0,197,0,199,0,201,0,203,
+0,205,0,207,0,209,0,211,0,480,213,0,215,0,217,0,219,0,221,0,223,0,225,0,227,0,229,0,231,0,233,0,
+235,0,237,0,239,0,241,0,243,0,245,0,247,0,249,0,251,0,253,0,255,0,257,0,141,260,0,262,0,264,0,67,
+// 4
+0,453,268,0,270,0,454,273,0,455,456,277,0,0,344,457,458,282,0,459,460,0,464,463,289,0,0,0,466,468,0,469,
+296,0,298,0,300,0,471,303,0,472,0,0,306,0,473,309,0,475,476,313,0,315,0,478,318,0,0,0,320,0,0,0,
+0,0,0,0,323,323,0,325,325,0,327,327,0,329,0,331,0,333,0,335,0,337,0,339,0,341,0,343,0,0,346,0,
+348,0,350,0,352,0,354,0,356,0,358,0,360,0,362,0,58,364,364,0,366,0,285,321,370,0,372,0,374,0,376,0,
+// 5
+378,0,380,0,382,0,384,0,386,0,388,0,390,0,392,0,394,0,396,0,398,0,400,0,402,0,404,0,406,0,408,0,
+293,0,411,0,413,0,415,0,417,0,419,0,421,0,423,0,425,0,427,0,0,0,0,0,0,0,1711,430,0,290,1712,0,
+0,436,0,265,474,477,441,0,443,0,445,0,447,0,449,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 6
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,568,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,482,0,484,0,0,0,486,0,0,0,0,0,0,0,0,0,
+// 7
+0,0,0,0,0,0,548,0,550,551,553,0,602,0,603,604,570,554,558,559,560,561,562,563,567,568,573,574,575,576,577,578,
+579,580,0,582,583,584,593,594,595,596,600,601,0,0,0,0,586,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,582,0,0,0,0,0,0,0,0,0,0,0,0,607,558,567,0,0,0,593,579,0,609,0,611,0,613,0,615,0,
+617,0,619,0,621,0,623,0,625,0,627,0,629,0,631,0,573,580,0,0,567,561,0,634,0,632,637,0,0,487,488,489,
+// 8
+721,722,723,724,725,726,727,728,729,730,731,732,733,734,735,736,689,690,691,692,693,694,695,696,697,698,699,700,701,702,703,704,
+705,706,707,708,709,710,711,712,713,714,715,716,717,718,719,720,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+738,0,740,0,742,0,744,0,746,0,748,0,750,0,752,0,754,0,756,0,758,0,760,0,762,0,764,0,766,0,768,0,
+// 9
+770,0,0,0,0,0,0,0,0,0,772,0,774,0,776,0,778,0,780,0,782,0,784,0,786,0,788,0,790,0,792,0,
+794,0,796,0,798,0,800,0,802,0,804,0,806,0,808,0,810,0,812,0,814,0,816,0,818,0,820,0,822,0,824,0,
+840,827,0,829,0,831,0,833,0,835,0,837,0,839,0,0,842,0,844,0,846,0,848,0,850,0,852,0,854,0,856,0,
+858,0,860,0,862,0,864,0,866,0,868,0,870,0,872,0,874,0,876,0,878,0,880,0,882,0,884,0,886,0,888,0,
+// 10
+890,0,892,0,894,0,896,0,898,0,900,0,902,0,904,0,906,0,908,0,910,0,912,0,914,0,916,0,918,0,920,0,
+922,0,924,0,926,0,928,0,0,0,0,0,0,0,0,0,0,973,974,975,976,977,979,980,981,982,983,984,985,986,987,988,
+989,990,991,992,993,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1009,1010,1011,1012,1013,1014,1015,1016,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 11
+0,0,0,0,0,0,0,978,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 12
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1835,1836,1837,1838,1839,1840,1841,1842,1843,1844,1845,1846,1847,1848,1849,1850,1851,1852,1853,1854,1855,1856,1857,1858,1859,1860,1861,1862,1863,1864,1865,1866,
+1867,1868,1869,1870,1871,1872,0,1873,0,0,0,0,0,1874,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 13
+1060,0,1062,0,1064,0,1066,0,1068,0,1070,0,1072,0,1074,0,1076,0,1078,0,1080,0,1082,0,1084,0,1086,0,1088,0,1090,0,
+1092,0,1094,0,1096,0,1098,0,1100,0,1102,0,1104,0,1106,0,1108,0,1110,0,1112,0,1114,0,1116,0,1118,0,1120,0,1122,0,
+1124,0,1126,0,1128,0,1130,0,1132,0,1134,0,1136,0,1138,0,1140,0,1142,0,1144,0,1146,0,1148,0,1150,0,1152,0,1154,0,
+1156,0,1158,0,1160,0,1162,0,1164,0,1166,0,1168,0,1170,0,1172,0,1174,0,1176,0,1178,0,1180,0,1182,0,1184,0,1186,0,
+// 14
+1188,0,1190,0,1192,0,1194,0,1196,0,1198,0,1200,0,1202,0,1204,0,1206,0,1208,0,54,71,75,78,41,1156,0,0,68,0,
+1210,0,1212,0,1214,0,1216,0,1218,0,1220,0,1222,0,1224,0,1226,0,1228,0,1230,0,1232,0,1234,0,1236,0,1238,0,1240,0,
+1242,0,1244,0,1246,0,1248,0,1250,0,1252,0,1254,0,1256,0,1258,0,1260,0,1262,0,1264,0,1266,0,1268,0,1270,0,1272,0,
+1274,0,1276,0,1278,0,1280,0,1282,0,1284,0,1286,0,1288,0,1290,0,1292,0,1294,0,1296,0,1298,0,1300,0,1302,0,1304,0,
+// 15
+0,0,0,0,0,0,0,0,1305,1307,1309,1311,1313,1315,1317,1319,0,0,0,0,0,0,0,0,1337,1338,1339,1340,1341,1342,0,0,
+0,0,0,0,0,0,0,0,1349,1351,1353,1355,1357,1359,1361,1363,0,0,0,0,0,0,0,0,1381,1382,1383,1384,1385,1386,1387,1388,
+0,0,0,0,0,0,0,0,1397,1398,1399,1400,1401,1402,0,0,588,0,589,0,590,0,591,0,0,1409,0,1410,0,1411,0,1412,
+0,0,0,0,0,0,0,0,1417,1419,1421,1423,1425,1427,1429,1431,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 16
+1306,1308,1310,1312,1314,1316,1318,1320,1306,1308,1310,1312,1314,1316,1318,1320,1350,1352,1354,1356,1358,1360,1362,1364,1350,1352,1354,1356,1358,1360,1362,1364,
+1418,1420,1422,1424,1426,1428,1430,1432,1418,1420,1422,1424,1426,1428,1430,1432,0,0,1450,557,549,0,555,556,1490,1491,1449,1451,557,0,568,0,
+0,0,1455,566,552,0,564,565,1452,1453,1454,1456,566,0,0,0,0,0,569,570,0,0,572,571,1504,1505,1457,1458,0,0,0,0,
+0,0,585,586,581,0,592,587,1510,1511,1461,1462,1512,0,0,0,0,0,1464,599,605,0,597,598,1459,1460,1463,1465,599,0,0,0,
+// 17
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,596,0,0,0,59,116,0,0,0,0,0,0,1525,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1542,1543,1544,1545,1546,1547,1548,1549,1550,1551,1552,1553,1554,1555,1556,1557,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 18
+0,0,0,1559,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 19
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1586,1587,1588,1589,1590,1591,1592,1593,1594,1595,
+1596,1597,1598,1599,1600,1601,1602,1603,1604,1605,1606,1607,1608,1609,1610,1611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 20
+1659,1660,1661,1662,1663,1664,1665,1666,1667,1668,1669,1670,1671,1672,1673,1674,1675,1676,1677,1678,1679,1680,1681,1682,1683,1684,1685,1686,1687,1688,1689,1690,
+1691,1692,1693,1694,1695,1696,1697,1698,1699,1700,1701,1702,1703,1704,1705,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1707,0,465,1058,470,0,0,1714,0,1716,0,1718,0,451,467,450,452,0,1724,0,0,1726,0,0,0,0,0,0,0,0,433,434,
+// 21
+1730,0,1732,0,1734,0,1736,0,1738,0,1740,0,1742,0,1744,0,1746,0,1748,0,1750,0,1752,0,1754,0,1756,0,1758,0,1760,0,
+1762,0,1764,0,1766,0,1768,0,1770,0,1772,0,1774,0,1776,0,1778,0,1780,0,1782,0,1784,0,1786,0,1788,0,1790,0,1792,0,
+1794,0,1796,0,1798,0,1800,0,1802,0,1804,0,1806,0,1808,0,1810,0,1812,0,1814,0,1816,0,1818,0,1820,0,1822,0,1824,0,
+1826,0,1828,0,0,0,0,0,0,0,0,1830,0,1832,0,0,0,0,1834,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 22
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1876,0,1878,0,1880,0,1882,0,1884,0,1886,0,1888,0,1890,0,1892,0,1894,0,1896,0,1898,0,1900,0,1902,0,1904,0,1906,0,
+1908,0,1910,0,1912,0,1914,0,1916,0,1918,0,1920,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 23
+1922,0,1924,0,1926,0,1928,0,1930,0,1932,0,1934,0,1936,0,1938,0,1940,0,1942,0,1944,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 24
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1946,0,1948,0,1950,0,1952,0,1954,0,1956,0,1958,0,0,0,1960,0,1962,0,1964,0,1966,0,1968,0,1970,0,1972,0,
+1974,0,1976,0,1978,0,1980,0,1982,0,1984,0,1986,0,1988,0,1990,0,1992,0,1994,0,1996,0,1998,0,2000,0,2002,0,2004,0,
+2006,0,2008,0,2010,0,2012,0,2014,0,2016,0,2018,0,2020,0,0,0,0,0,0,0,0,0,0,2022,0,2024,0,1057,2027,0,
+// 25
+2029,0,2031,0,2033,0,2035,0,0,0,0,2037,0,461,0,0,2040,0,2042,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2044,0,2046,0,2048,0,2050,0,2052,0,462,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 26
+47,50,51,48,49,69,69,0,0,0,0,0,0,0,0,0,0,0,0,997,994,995,1008,996,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 27
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2080,2081,2082,2083,2084,2085,2086,2087,2088,2089,2090,2091,2092,2093,2094,2095,2096,2097,2098,2099,2100,2101,2102,2103,2104,2105,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 28
+2146,2147,2148,2149,2150,2151,2152,2153,2154,2155,2156,2157,2158,2159,2160,2161,2162,2163,2164,2165,2166,2167,2168,2169,2170,2171,2172,2173,2174,2175,2176,2177,
+2178,2179,2180,2181,2182,2183,2184,2185,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 29
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,3,4,5,6,7,13,14,16,17,19,20,21,22,23,24,25,26,27,30,32,33,34,36,37,39,0,0,0,0,0,
+// 30
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,521,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,
+80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,0,103,104,105,106,107,108,109,258,
+// 31
+0,142,0,144,0,146,0,148,0,150,0,152,0,154,0,156,0,158,0,160,0,162,0,164,0,166,0,168,0,170,0,172,
+0,174,0,176,0,178,0,180,0,182,0,184,0,186,0,188,0,16,0,190,0,192,0,194,0,0,196,0,198,0,200,0,
+202,0,204,0,206,0,208,0,210,479,0,212,0,214,0,216,0,218,0,220,0,222,0,224,0,226,0,228,0,230,0,232,
+0,234,0,236,0,238,0,240,0,242,0,244,0,246,0,248,0,250,0,252,0,254,0,256,0,0,259,0,261,0,263,27,
+// 32
+437,0,0,267,0,269,0,0,272,0,0,0,276,0,0,0,0,0,281,0,0,367,0,0,0,288,431,0,0,0,409,0,
+0,295,0,297,0,299,0,0,302,0,0,0,0,305,0,0,308,0,0,0,312,0,314,0,0,317,0,0,0,319,0,368,
+0,0,0,0,0,322,322,0,324,324,0,326,326,0,328,0,330,0,332,0,334,0,336,0,338,0,340,0,342,278,0,345,
+0,347,0,349,0,351,0,353,0,355,0,357,0,359,0,361,18,0,363,363,0,365,0,0,0,369,0,371,0,373,0,375,
+// 33
+0,377,0,379,0,381,0,383,0,385,0,387,0,389,0,391,0,393,0,395,0,397,0,399,0,401,0,403,0,405,0,407,
+0,0,0,410,0,412,0,414,0,416,0,418,0,420,0,422,0,424,0,426,0,0,0,0,0,0,0,0,429,0,0,1727,
+1728,0,435,0,0,0,0,440,0,442,0,444,0,446,0,448,1721,1719,1722,266,271,0,274,275,0,279,0,280,0,0,0,0,
+283,0,0,284,0,2038,2053,0,287,286,0,1708,0,0,0,291,0,1720,292,0,0,294,0,0,0,0,0,0,0,1710,0,0,
+// 34
+301,0,0,304,0,0,0,0,307,438,310,311,439,0,0,0,0,0,316,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 35
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,514,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,481,0,483,0,0,0,485,0,0,0,638,639,640,0,0,
+// 36
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,516,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,490,492,493,495,532,500,504,505,506,507,508,509,513,514,519,520,521,522,523,524,
+525,526,528,528,529,530,539,540,541,542,546,547,496,497,498,0,504,513,0,0,0,539,525,606,0,608,0,610,0,612,0,614,
+0,616,0,618,0,620,0,622,0,624,0,626,0,628,0,630,519,526,635,0,0,507,0,0,633,0,0,636,0,0,0,0,
+// 37
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,657,658,659,660,661,662,663,664,665,666,667,668,669,670,671,672,
+673,674,675,676,677,678,679,680,681,682,683,684,685,686,687,688,641,642,643,644,645,646,647,648,649,650,651,652,653,654,655,656,
+0,737,0,739,0,741,0,743,0,745,0,747,0,749,0,751,0,753,0,755,0,757,0,759,0,761,0,763,0,765,0,767,
+// 38
+0,769,0,0,0,0,0,0,0,0,0,771,0,773,0,775,0,777,0,779,0,781,0,783,0,785,0,787,0,789,0,791,
+0,793,0,795,0,797,0,799,0,801,0,803,0,805,0,807,0,809,0,811,0,813,0,815,0,817,0,819,0,821,0,823,
+0,0,826,0,828,0,830,0,832,0,834,0,836,0,838,825,0,841,0,843,0,845,0,847,0,849,0,851,0,853,0,855,
+0,857,0,859,0,861,0,863,0,865,0,867,0,869,0,871,0,873,0,875,0,877,0,879,0,881,0,883,0,885,0,887,
+// 39
+0,889,0,891,0,893,0,895,0,897,0,899,0,901,0,903,0,905,0,907,0,909,0,911,0,913,0,915,0,917,0,919,
+0,921,0,923,0,925,0,927,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,929,930,931,932,933,935,936,937,938,939,940,941,942,943,944,945,946,947,948,949,954,955,956,957,958,959,960,961,962,963,965,
+// 40
+966,967,968,969,970,971,972,934,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 41
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2025,0,0,0,1709,0,0,
+// 42
+0,1059,0,1061,0,1063,0,1065,0,1067,0,1069,0,1071,0,1073,0,1075,0,1077,0,1079,0,1081,0,1083,0,1085,0,1087,0,1089,
+0,1091,0,1093,0,1095,0,1097,0,1099,0,1101,0,1103,0,1105,0,1107,0,1109,0,1111,0,1113,0,1115,0,1117,0,1119,0,1121,
+0,1123,0,1125,0,1127,0,1129,0,1131,0,1133,0,1135,0,1137,0,1139,0,1141,0,1143,0,1145,0,1147,0,1149,0,1151,0,1153,
+0,1155,0,1157,0,1159,0,1161,0,1163,0,1165,0,1167,0,1169,0,1171,0,1173,0,1175,0,1177,0,1179,0,1181,0,1183,0,1185,
+// 43
+0,1187,0,1189,0,1191,0,1193,0,1195,0,1197,0,1199,0,1201,0,1203,0,1205,0,1207,15,31,35,38,2,1155,0,0,0,0,
+0,1209,0,1211,0,1213,0,1215,0,1217,0,1219,0,1221,0,1223,0,1225,0,1227,0,1229,0,1231,0,1233,0,1235,0,1237,0,1239,
+0,1241,0,1243,0,1245,0,1247,0,1249,0,1251,0,1253,0,1255,0,1257,0,1259,0,1261,0,1263,0,1265,0,1267,0,1269,0,1271,
+0,1273,0,1275,0,1277,0,1279,0,1281,0,1283,0,1285,0,1287,0,1289,0,1291,0,1293,0,1295,0,1297,0,1299,0,1301,0,1303,
+// 44
+1321,1323,1325,1327,1329,1331,1333,1335,0,0,0,0,0,0,0,0,1343,1344,1345,1346,1347,1348,0,0,0,0,0,0,0,0,0,0,
+1365,1367,1369,1371,1373,1375,1377,1379,0,0,0,0,0,0,0,0,1389,1390,1391,1392,1393,1394,1395,1396,0,0,0,0,0,0,0,0,
+1403,1404,1405,1406,1407,1408,0,0,0,0,0,0,0,0,0,0,534,1413,535,1414,536,1415,537,1416,0,0,0,0,0,0,0,0,
+1433,1435,1437,1439,1441,1443,1445,1447,0,0,0,0,0,0,0,0,1495,1497,1499,1500,1501,1503,1508,1509,1519,1520,1515,1516,1521,1523,0,0,
+// 45
+1322,1324,1326,1328,1330,1332,1334,1336,1322,1324,1326,1328,1330,1332,1334,1336,1366,1368,1370,1372,1374,1376,1378,1380,1366,1368,1370,1372,1374,1376,1378,1380,
+1434,1436,1438,1440,1442,1444,1446,1448,1434,1436,1438,1440,1442,1444,1446,1448,1493,1494,1496,503,491,0,501,502,0,0,0,0,503,0,514,0,
+0,0,1502,512,494,0,510,511,0,0,0,0,512,0,0,0,1506,1507,515,516,0,0,518,517,0,0,0,0,0,0,0,0,
+1513,1514,531,532,527,1517,538,533,0,0,0,0,0,0,0,0,0,0,1522,545,499,0,543,544,0,0,0,0,545,0,0,0,
+// 46
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1524,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1526,1527,1528,1529,1530,1531,1532,1533,1534,1535,1536,1537,1538,1539,1540,1541,
+// 47
+0,0,0,0,1558,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 48
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1560,1561,1562,1563,1564,1565,1566,1567,1568,1569,1570,1571,1572,1573,1574,1575,
+1576,1577,1578,1579,1580,1581,1582,1583,1584,1585,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 49
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1612,1613,1614,1615,1616,1617,1618,1619,1620,1621,1622,1623,1624,1625,1626,1627,
+1628,1629,1630,1631,1632,1633,1634,1635,1636,1637,1638,1639,1640,1641,1642,1643,1644,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,1655,1656,1657,1658,0,
+0,1706,0,0,0,428,432,0,1713,0,1715,0,1717,0,0,0,0,0,0,1723,0,0,1725,0,0,0,0,0,0,0,0,0,
+// 50
+0,1729,0,1731,0,1733,0,1735,0,1737,0,1739,0,1741,0,1743,0,1745,0,1747,0,1749,0,1751,0,1753,0,1755,0,1757,0,1759,
+0,1761,0,1763,0,1765,0,1767,0,1769,0,1771,0,1773,0,1775,0,1777,0,1779,0,1781,0,1783,0,1785,0,1787,0,1789,0,1791,
+0,1793,0,1795,0,1797,0,1799,0,1801,0,1803,0,1805,0,1807,0,1809,0,1811,0,1813,0,1815,0,1817,0,1819,0,1821,0,1823,
+0,1825,0,1827,0,0,0,0,0,0,0,0,1829,0,1831,0,0,0,0,1833,0,0,0,0,0,0,0,0,0,0,0,0,
+// 51
+1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1028,1029,1030,1031,1032,1033,1034,1035,1036,1037,1038,1039,1040,1041,1042,1043,1044,1045,1046,1047,1048,
+1049,1050,1051,1052,1053,1054,0,1055,0,0,0,0,0,1056,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 52
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1875,0,1877,0,1879,0,1881,0,1883,0,1885,0,1887,0,1889,0,1891,0,1893,0,1895,0,1897,0,1899,0,1901,0,1903,0,1905,
+0,1907,0,1909,0,1911,0,1913,0,1915,0,1917,0,1919,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 53
+0,1921,0,1923,0,1925,0,1927,0,1929,0,1931,0,1933,0,1935,0,1937,0,1939,0,1941,0,1943,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 54
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1945,0,1947,0,1949,0,1951,0,1953,0,1955,0,1957,0,0,0,1959,0,1961,0,1963,0,1965,0,1967,0,1969,0,1971,
+0,1973,0,1975,0,1977,0,1979,0,1981,0,1983,0,1985,0,1987,0,1989,0,1991,0,1993,0,1995,0,1997,0,1999,0,2001,0,2003,
+0,2005,0,2007,0,2009,0,2011,0,2013,0,2015,0,2017,0,2019,0,0,0,0,0,0,0,0,0,0,2021,0,2023,0,0,2026,
+// 55
+0,2028,0,2030,0,2032,0,2034,0,0,0,0,2036,0,0,0,0,2039,0,2041,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2043,0,2045,0,2047,0,2049,0,2051,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 56
+8,11,12,9,10,29,29,0,0,0,0,0,0,0,0,0,0,0,0,953,950,951,964,952,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 57
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2054,2055,2056,2057,2058,2059,2060,2061,2062,2063,2064,2065,2066,2067,2068,2069,2070,2071,2072,2073,2074,2075,2076,2077,2078,2079,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 58
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2106,2107,2108,2109,2110,2111,2112,2113,2114,2115,2116,2117,2118,2119,2120,2121,2122,2123,2124,2125,2126,2127,2128,2129,
+2130,2131,2132,2133,2134,2135,2136,2137,2138,2139,2140,2141,2142,2143,2144,2145,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 59
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,130,131,132,133,0,134,135,136,137,138,139,140,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 60
+143,0,145,0,147,0,149,0,151,0,153,0,155,0,157,0,159,0,161,0,163,0,165,0,167,0,169,0,171,0,173,0,
+175,0,177,0,179,0,181,0,183,0,185,0,187,0,189,0,56,0,191,0,193,0,195,0,0,197,0,199,0,201,0,203,
+0,205,0,207,0,209,0,211,0,0,213,0,215,0,217,0,219,0,221,0,223,0,225,0,227,0,229,0,231,0,233,0,
+235,0,237,0,239,0,241,0,243,0,245,0,247,0,249,0,251,0,253,0,255,0,257,0,141,260,0,262,0,264,0,0,
+// 61
+0,453,268,0,270,0,454,273,0,455,456,277,0,0,344,457,458,282,0,459,460,0,464,463,289,0,0,0,466,468,0,469,
+296,0,298,0,300,0,471,303,0,472,0,0,306,0,473,309,0,475,476,313,0,315,0,478,318,0,0,0,320,0,0,0,
+0,0,0,0,323,323,0,325,325,0,327,327,0,329,0,331,0,333,0,335,0,337,0,339,0,341,0,343,0,0,346,0,
+348,0,350,0,352,0,354,0,356,0,358,0,360,0,362,0,0,364,364,0,366,0,285,321,370,0,372,0,374,0,376,0,
+// 62
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,482,0,484,0,0,0,486,0,0,0,0,0,0,0,0,0,
+// 63
+0,0,0,0,0,0,548,0,550,551,553,0,602,0,603,604,0,554,558,559,560,561,562,563,567,568,573,574,575,576,577,578,
+579,580,0,582,583,584,593,594,595,596,600,601,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,607,0,0,0,0,0,0,0,0,609,0,611,0,613,0,615,0,
+617,0,619,0,621,0,623,0,625,0,627,0,629,0,631,0,0,0,0,0,567,0,0,634,0,632,637,0,0,487,488,489,
+// 64
+1188,0,1190,0,1192,0,1194,0,1196,0,1198,0,1200,0,1202,0,1204,0,1206,0,1208,0,0,0,0,0,0,0,0,0,110,0,
+1210,0,1212,0,1214,0,1216,0,1218,0,1220,0,1222,0,1224,0,1226,0,1228,0,1230,0,1232,0,1234,0,1236,0,1238,0,1240,0,
+1242,0,1244,0,1246,0,1248,0,1250,0,1252,0,1254,0,1256,0,1258,0,1260,0,1262,0,1264,0,1266,0,1268,0,1270,0,1272,0,
+1274,0,1276,0,1278,0,1280,0,1282,0,1284,0,1286,0,1288,0,1290,0,1292,0,1294,0,1296,0,1298,0,1300,0,1302,0,1304,0,
+// 65
+0,0,0,0,0,0,0,0,1305,1307,1309,1311,1313,1315,1317,1319,0,0,0,0,0,0,0,0,1337,1338,1339,1340,1341,1342,0,0,
+0,0,0,0,0,0,0,0,1349,1351,1353,1355,1357,1359,1361,1363,0,0,0,0,0,0,0,0,1381,1382,1383,1384,1385,1386,1387,1388,
+0,0,0,0,0,0,0,0,1397,1398,1399,1400,1401,1402,0,0,0,0,0,0,0,0,0,0,0,1409,0,1410,0,1411,0,1412,
+0,0,0,0,0,0,0,0,1417,1419,1421,1423,1425,1427,1429,1431,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+// 66
+0,0,0,0,0,0,0,0,1466,1467,1468,1469,1470,1471,1472,1473,0,0,0,0,0,0,0,0,1474,1475,1476,1477,1478,1479,1480,1481,
+0,0,0,0,0,0,0,0,1482,1483,1484,1485,1486,1487,1488,1489,0,0,0,0,0,0,0,0,1490,1491,1449,1451,1492,0,0,0,
+0,0,0,0,0,0,0,0,1452,1453,1454,1456,1498,0,0,0,0,0,0,0,0,0,0,0,1504,1505,1457,1458,0,0,0,0,
+0,0,0,0,0,0,0,0,1510,1511,1461,1462,1512,0,0,0,0,0,0,0,0,0,0,0,1459,1460,1463,1465,1518,0,0,0,
+
+//--Autogenerated -- end of section automatically generated
+};
+
+// Conversions in UTF-8 ordered by code points with the empty string for no conversion first.
+const char caseConversionStrings[][maxConversionLength+1] = {
+"",
+//++Autogenerated -- start of section automatically generated
+//**4 \(\*\n\)
+"A",
+"A\xca\xbe",
+"B",
+"C",
+"D",
+"E",
+"F",
+"FF",
+"FFI",
+"FFL",
+"FI",
+"FL",
+"G",
+"H",
+"H\xcc\xb1",
+"I",
+"J",
+"J\xcc\x8c",
+"K",
+"L",
+"M",
+"N",
+"O",
+"P",
+"Q",
+"R",
+"S",
+"SS",
+"ST",
+"T",
+"T\xcc\x88",
+"U",
+"V",
+"W",
+"W\xcc\x8a",
+"X",
+"Y",
+"Y\xcc\x8a",
+"Z",
+"a",
+"a\xca\xbe",
+"b",
+"c",
+"d",
+"e",
+"f",
+"ff",
+"ffi",
+"ffl",
+"fi",
+"fl",
+"g",
+"h",
+"h\xcc\xb1",
+"i",
+"i\xcc\x87",
+"j",
+"j\xcc\x8c",
+"k",
+"l",
+"m",
+"n",
+"o",
+"p",
+"q",
+"r",
+"s",
+"ss",
+"st",
+"t",
+"t\xcc\x88",
+"u",
+"v",
+"w",
+"w\xcc\x8a",
+"x",
+"y",
+"y\xcc\x8a",
+"z",
+"\xc3\x80",
+"\xc3\x81",
+"\xc3\x82",
+"\xc3\x83",
+"\xc3\x84",
+"\xc3\x85",
+"\xc3\x86",
+"\xc3\x87",
+"\xc3\x88",
+"\xc3\x89",
+"\xc3\x8a",
+"\xc3\x8b",
+"\xc3\x8c",
+"\xc3\x8d",
+"\xc3\x8e",
+"\xc3\x8f",
+"\xc3\x90",
+"\xc3\x91",
+"\xc3\x92",
+"\xc3\x93",
+"\xc3\x94",
+"\xc3\x95",
+"\xc3\x96",
+"\xc3\x98",
+"\xc3\x99",
+"\xc3\x9a",
+"\xc3\x9b",
+"\xc3\x9c",
+"\xc3\x9d",
+"\xc3\x9e",
+"\xc3\x9f",
+"\xc3\xa0",
+"\xc3\xa1",
+"\xc3\xa2",
+"\xc3\xa3",
+"\xc3\xa4",
+"\xc3\xa5",
+"\xc3\xa6",
+"\xc3\xa7",
+"\xc3\xa8",
+"\xc3\xa9",
+"\xc3\xaa",
+"\xc3\xab",
+"\xc3\xac",
+"\xc3\xad",
+"\xc3\xae",
+"\xc3\xaf",
+"\xc3\xb0",
+"\xc3\xb1",
+"\xc3\xb2",
+"\xc3\xb3",
+"\xc3\xb4",
+"\xc3\xb5",
+"\xc3\xb6",
+"\xc3\xb8",
+"\xc3\xb9",
+"\xc3\xba",
+"\xc3\xbb",
+"\xc3\xbc",
+"\xc3\xbd",
+"\xc3\xbe",
+"\xc3\xbf",
+"\xc4\x80",
+"\xc4\x81",
+"\xc4\x82",
+"\xc4\x83",
+"\xc4\x84",
+"\xc4\x85",
+"\xc4\x86",
+"\xc4\x87",
+"\xc4\x88",
+"\xc4\x89",
+"\xc4\x8a",
+"\xc4\x8b",
+"\xc4\x8c",
+"\xc4\x8d",
+"\xc4\x8e",
+"\xc4\x8f",
+"\xc4\x90",
+"\xc4\x91",
+"\xc4\x92",
+"\xc4\x93",
+"\xc4\x94",
+"\xc4\x95",
+"\xc4\x96",
+"\xc4\x97",
+"\xc4\x98",
+"\xc4\x99",
+"\xc4\x9a",
+"\xc4\x9b",
+"\xc4\x9c",
+"\xc4\x9d",
+"\xc4\x9e",
+"\xc4\x9f",
+"\xc4\xa0",
+"\xc4\xa1",
+"\xc4\xa2",
+"\xc4\xa3",
+"\xc4\xa4",
+"\xc4\xa5",
+"\xc4\xa6",
+"\xc4\xa7",
+"\xc4\xa8",
+"\xc4\xa9",
+"\xc4\xaa",
+"\xc4\xab",
+"\xc4\xac",
+"\xc4\xad",
+"\xc4\xae",
+"\xc4\xaf",
+"\xc4\xb2",
+"\xc4\xb3",
+"\xc4\xb4",
+"\xc4\xb5",
+"\xc4\xb6",
+"\xc4\xb7",
+"\xc4\xb9",
+"\xc4\xba",
+"\xc4\xbb",
+"\xc4\xbc",
+"\xc4\xbd",
+"\xc4\xbe",
+"\xc4\xbf",
+"\xc5\x80",
+"\xc5\x81",
+"\xc5\x82",
+"\xc5\x83",
+"\xc5\x84",
+"\xc5\x85",
+"\xc5\x86",
+"\xc5\x87",
+"\xc5\x88",
+"\xc5\x8a",
+"\xc5\x8b",
+"\xc5\x8c",
+"\xc5\x8d",
+"\xc5\x8e",
+"\xc5\x8f",
+"\xc5\x90",
+"\xc5\x91",
+"\xc5\x92",
+"\xc5\x93",
+"\xc5\x94",
+"\xc5\x95",
+"\xc5\x96",
+"\xc5\x97",
+"\xc5\x98",
+"\xc5\x99",
+"\xc5\x9a",
+"\xc5\x9b",
+"\xc5\x9c",
+"\xc5\x9d",
+"\xc5\x9e",
+"\xc5\x9f",
+"\xc5\xa0",
+"\xc5\xa1",
+"\xc5\xa2",
+"\xc5\xa3",
+"\xc5\xa4",
+"\xc5\xa5",
+"\xc5\xa6",
+"\xc5\xa7",
+"\xc5\xa8",
+"\xc5\xa9",
+"\xc5\xaa",
+"\xc5\xab",
+"\xc5\xac",
+"\xc5\xad",
+"\xc5\xae",
+"\xc5\xaf",
+"\xc5\xb0",
+"\xc5\xb1",
+"\xc5\xb2",
+"\xc5\xb3",
+"\xc5\xb4",
+"\xc5\xb5",
+"\xc5\xb6",
+"\xc5\xb7",
+"\xc5\xb8",
+"\xc5\xb9",
+"\xc5\xba",
+"\xc5\xbb",
+"\xc5\xbc",
+"\xc5\xbd",
+"\xc5\xbe",
+"\xc6\x80",
+"\xc6\x81",
+"\xc6\x82",
+"\xc6\x83",
+"\xc6\x84",
+"\xc6\x85",
+"\xc6\x86",
+"\xc6\x87",
+"\xc6\x88",
+"\xc6\x89",
+"\xc6\x8a",
+"\xc6\x8b",
+"\xc6\x8c",
+"\xc6\x8e",
+"\xc6\x8f",
+"\xc6\x90",
+"\xc6\x91",
+"\xc6\x92",
+"\xc6\x93",
+"\xc6\x94",
+"\xc6\x95",
+"\xc6\x96",
+"\xc6\x97",
+"\xc6\x98",
+"\xc6\x99",
+"\xc6\x9a",
+"\xc6\x9c",
+"\xc6\x9d",
+"\xc6\x9e",
+"\xc6\x9f",
+"\xc6\xa0",
+"\xc6\xa1",
+"\xc6\xa2",
+"\xc6\xa3",
+"\xc6\xa4",
+"\xc6\xa5",
+"\xc6\xa6",
+"\xc6\xa7",
+"\xc6\xa8",
+"\xc6\xa9",
+"\xc6\xac",
+"\xc6\xad",
+"\xc6\xae",
+"\xc6\xaf",
+"\xc6\xb0",
+"\xc6\xb1",
+"\xc6\xb2",
+"\xc6\xb3",
+"\xc6\xb4",
+"\xc6\xb5",
+"\xc6\xb6",
+"\xc6\xb7",
+"\xc6\xb8",
+"\xc6\xb9",
+"\xc6\xbc",
+"\xc6\xbd",
+"\xc6\xbf",
+"\xc7\x84",
+"\xc7\x86",
+"\xc7\x87",
+"\xc7\x89",
+"\xc7\x8a",
+"\xc7\x8c",
+"\xc7\x8d",
+"\xc7\x8e",
+"\xc7\x8f",
+"\xc7\x90",
+"\xc7\x91",
+"\xc7\x92",
+"\xc7\x93",
+"\xc7\x94",
+"\xc7\x95",
+"\xc7\x96",
+"\xc7\x97",
+"\xc7\x98",
+"\xc7\x99",
+"\xc7\x9a",
+"\xc7\x9b",
+"\xc7\x9c",
+"\xc7\x9d",
+"\xc7\x9e",
+"\xc7\x9f",
+"\xc7\xa0",
+"\xc7\xa1",
+"\xc7\xa2",
+"\xc7\xa3",
+"\xc7\xa4",
+"\xc7\xa5",
+"\xc7\xa6",
+"\xc7\xa7",
+"\xc7\xa8",
+"\xc7\xa9",
+"\xc7\xaa",
+"\xc7\xab",
+"\xc7\xac",
+"\xc7\xad",
+"\xc7\xae",
+"\xc7\xaf",
+"\xc7\xb1",
+"\xc7\xb3",
+"\xc7\xb4",
+"\xc7\xb5",
+"\xc7\xb6",
+"\xc7\xb7",
+"\xc7\xb8",
+"\xc7\xb9",
+"\xc7\xba",
+"\xc7\xbb",
+"\xc7\xbc",
+"\xc7\xbd",
+"\xc7\xbe",
+"\xc7\xbf",
+"\xc8\x80",
+"\xc8\x81",
+"\xc8\x82",
+"\xc8\x83",
+"\xc8\x84",
+"\xc8\x85",
+"\xc8\x86",
+"\xc8\x87",
+"\xc8\x88",
+"\xc8\x89",
+"\xc8\x8a",
+"\xc8\x8b",
+"\xc8\x8c",
+"\xc8\x8d",
+"\xc8\x8e",
+"\xc8\x8f",
+"\xc8\x90",
+"\xc8\x91",
+"\xc8\x92",
+"\xc8\x93",
+"\xc8\x94",
+"\xc8\x95",
+"\xc8\x96",
+"\xc8\x97",
+"\xc8\x98",
+"\xc8\x99",
+"\xc8\x9a",
+"\xc8\x9b",
+"\xc8\x9c",
+"\xc8\x9d",
+"\xc8\x9e",
+"\xc8\x9f",
+"\xc8\xa0",
+"\xc8\xa2",
+"\xc8\xa3",
+"\xc8\xa4",
+"\xc8\xa5",
+"\xc8\xa6",
+"\xc8\xa7",
+"\xc8\xa8",
+"\xc8\xa9",
+"\xc8\xaa",
+"\xc8\xab",
+"\xc8\xac",
+"\xc8\xad",
+"\xc8\xae",
+"\xc8\xaf",
+"\xc8\xb0",
+"\xc8\xb1",
+"\xc8\xb2",
+"\xc8\xb3",
+"\xc8\xba",
+"\xc8\xbb",
+"\xc8\xbc",
+"\xc8\xbd",
+"\xc8\xbe",
+"\xc8\xbf",
+"\xc9\x80",
+"\xc9\x81",
+"\xc9\x82",
+"\xc9\x83",
+"\xc9\x84",
+"\xc9\x85",
+"\xc9\x86",
+"\xc9\x87",
+"\xc9\x88",
+"\xc9\x89",
+"\xc9\x8a",
+"\xc9\x8b",
+"\xc9\x8c",
+"\xc9\x8d",
+"\xc9\x8e",
+"\xc9\x8f",
+"\xc9\x90",
+"\xc9\x91",
+"\xc9\x92",
+"\xc9\x93",
+"\xc9\x94",
+"\xc9\x96",
+"\xc9\x97",
+"\xc9\x99",
+"\xc9\x9b",
+"\xc9\xa0",
+"\xc9\xa3",
+"\xc9\xa5",
+"\xc9\xa6",
+"\xc9\xa8",
+"\xc9\xa9",
+"\xc9\xab",
+"\xc9\xaf",
+"\xc9\xb1",
+"\xc9\xb2",
+"\xc9\xb5",
+"\xc9\xbd",
+"\xca\x80",
+"\xca\x83",
+"\xca\x88",
+"\xca\x89",
+"\xca\x8a",
+"\xca\x8b",
+"\xca\x8c",
+"\xca\x92",
+"\xca\xbcN",
+"\xca\xbcn",
+"\xcd\xb0",
+"\xcd\xb1",
+"\xcd\xb2",
+"\xcd\xb3",
+"\xcd\xb6",
+"\xcd\xb7",
+"\xcd\xbb",
+"\xcd\xbc",
+"\xcd\xbd",
+"\xce\x86",
+"\xce\x86\xce\x99",
+"\xce\x88",
+"\xce\x89",
+"\xce\x89\xce\x99",
+"\xce\x8a",
+"\xce\x8c",
+"\xce\x8e",
+"\xce\x8f",
+"\xce\x8f\xce\x99",
+"\xce\x91",
+"\xce\x91\xcd\x82",
+"\xce\x91\xcd\x82\xce\x99",
+"\xce\x91\xce\x99",
+"\xce\x92",
+"\xce\x93",
+"\xce\x94",
+"\xce\x95",
+"\xce\x96",
+"\xce\x97",
+"\xce\x97\xcd\x82",
+"\xce\x97\xcd\x82\xce\x99",
+"\xce\x97\xce\x99",
+"\xce\x98",
+"\xce\x99",
+"\xce\x99\xcc\x88\xcc\x80",
+"\xce\x99\xcc\x88\xcc\x81",
+"\xce\x99\xcc\x88\xcd\x82",
+"\xce\x99\xcd\x82",
+"\xce\x9a",
+"\xce\x9b",
+"\xce\x9c",
+"\xce\x9d",
+"\xce\x9e",
+"\xce\x9f",
+"\xce\xa0",
+"\xce\xa1",
+"\xce\xa1\xcc\x93",
+"\xce\xa3",
+"\xce\xa4",
+"\xce\xa5",
+"\xce\xa5\xcc\x88\xcc\x80",
+"\xce\xa5\xcc\x88\xcc\x81",
+"\xce\xa5\xcc\x88\xcd\x82",
+"\xce\xa5\xcc\x93",
+"\xce\xa5\xcc\x93\xcc\x80",
+"\xce\xa5\xcc\x93\xcc\x81",
+"\xce\xa5\xcc\x93\xcd\x82",
+"\xce\xa5\xcd\x82",
+"\xce\xa6",
+"\xce\xa7",
+"\xce\xa8",
+"\xce\xa9",
+"\xce\xa9\xcd\x82",
+"\xce\xa9\xcd\x82\xce\x99",
+"\xce\xa9\xce\x99",
+"\xce\xaa",
+"\xce\xab",
+"\xce\xac",
+"\xce\xac\xce\xb9",
+"\xce\xad",
+"\xce\xae",
+"\xce\xae\xce\xb9",
+"\xce\xaf",
+"\xce\xb1",
+"\xce\xb1\xcd\x82",
+"\xce\xb1\xcd\x82\xce\xb9",
+"\xce\xb1\xce\xb9",
+"\xce\xb2",
+"\xce\xb3",
+"\xce\xb4",
+"\xce\xb5",
+"\xce\xb6",
+"\xce\xb7",
+"\xce\xb7\xcd\x82",
+"\xce\xb7\xcd\x82\xce\xb9",
+"\xce\xb7\xce\xb9",
+"\xce\xb8",
+"\xce\xb9",
+"\xce\xb9\xcc\x88\xcc\x80",
+"\xce\xb9\xcc\x88\xcc\x81",
+"\xce\xb9\xcc\x88\xcd\x82",
+"\xce\xb9\xcd\x82",
+"\xce\xba",
+"\xce\xbb",
+"\xce\xbc",
+"\xce\xbd",
+"\xce\xbe",
+"\xce\xbf",
+"\xcf\x80",
+"\xcf\x81",
+"\xcf\x81\xcc\x93",
+"\xcf\x83",
+"\xcf\x84",
+"\xcf\x85",
+"\xcf\x85\xcc\x88\xcc\x80",
+"\xcf\x85\xcc\x88\xcc\x81",
+"\xcf\x85\xcc\x88\xcd\x82",
+"\xcf\x85\xcc\x93",
+"\xcf\x85\xcc\x93\xcc\x80",
+"\xcf\x85\xcc\x93\xcc\x81",
+"\xcf\x85\xcc\x93\xcd\x82",
+"\xcf\x85\xcd\x82",
+"\xcf\x86",
+"\xcf\x87",
+"\xcf\x88",
+"\xcf\x89",
+"\xcf\x89\xcd\x82",
+"\xcf\x89\xcd\x82\xce\xb9",
+"\xcf\x89\xce\xb9",
+"\xcf\x8a",
+"\xcf\x8b",
+"\xcf\x8c",
+"\xcf\x8d",
+"\xcf\x8e",
+"\xcf\x8e\xce\xb9",
+"\xcf\x8f",
+"\xcf\x97",
+"\xcf\x98",
+"\xcf\x99",
+"\xcf\x9a",
+"\xcf\x9b",
+"\xcf\x9c",
+"\xcf\x9d",
+"\xcf\x9e",
+"\xcf\x9f",
+"\xcf\xa0",
+"\xcf\xa1",
+"\xcf\xa2",
+"\xcf\xa3",
+"\xcf\xa4",
+"\xcf\xa5",
+"\xcf\xa6",
+"\xcf\xa7",
+"\xcf\xa8",
+"\xcf\xa9",
+"\xcf\xaa",
+"\xcf\xab",
+"\xcf\xac",
+"\xcf\xad",
+"\xcf\xae",
+"\xcf\xaf",
+"\xcf\xb2",
+"\xcf\xb7",
+"\xcf\xb8",
+"\xcf\xb9",
+"\xcf\xba",
+"\xcf\xbb",
+"\xcf\xbd",
+"\xcf\xbe",
+"\xcf\xbf",
+"\xd0\x80",
+"\xd0\x81",
+"\xd0\x82",
+"\xd0\x83",
+"\xd0\x84",
+"\xd0\x85",
+"\xd0\x86",
+"\xd0\x87",
+"\xd0\x88",
+"\xd0\x89",
+"\xd0\x8a",
+"\xd0\x8b",
+"\xd0\x8c",
+"\xd0\x8d",
+"\xd0\x8e",
+"\xd0\x8f",
+"\xd0\x90",
+"\xd0\x91",
+"\xd0\x92",
+"\xd0\x93",
+"\xd0\x94",
+"\xd0\x95",
+"\xd0\x96",
+"\xd0\x97",
+"\xd0\x98",
+"\xd0\x99",
+"\xd0\x9a",
+"\xd0\x9b",
+"\xd0\x9c",
+"\xd0\x9d",
+"\xd0\x9e",
+"\xd0\x9f",
+"\xd0\xa0",
+"\xd0\xa1",
+"\xd0\xa2",
+"\xd0\xa3",
+"\xd0\xa4",
+"\xd0\xa5",
+"\xd0\xa6",
+"\xd0\xa7",
+"\xd0\xa8",
+"\xd0\xa9",
+"\xd0\xaa",
+"\xd0\xab",
+"\xd0\xac",
+"\xd0\xad",
+"\xd0\xae",
+"\xd0\xaf",
+"\xd0\xb0",
+"\xd0\xb1",
+"\xd0\xb2",
+"\xd0\xb3",
+"\xd0\xb4",
+"\xd0\xb5",
+"\xd0\xb6",
+"\xd0\xb7",
+"\xd0\xb8",
+"\xd0\xb9",
+"\xd0\xba",
+"\xd0\xbb",
+"\xd0\xbc",
+"\xd0\xbd",
+"\xd0\xbe",
+"\xd0\xbf",
+"\xd1\x80",
+"\xd1\x81",
+"\xd1\x82",
+"\xd1\x83",
+"\xd1\x84",
+"\xd1\x85",
+"\xd1\x86",
+"\xd1\x87",
+"\xd1\x88",
+"\xd1\x89",
+"\xd1\x8a",
+"\xd1\x8b",
+"\xd1\x8c",
+"\xd1\x8d",
+"\xd1\x8e",
+"\xd1\x8f",
+"\xd1\x90",
+"\xd1\x91",
+"\xd1\x92",
+"\xd1\x93",
+"\xd1\x94",
+"\xd1\x95",
+"\xd1\x96",
+"\xd1\x97",
+"\xd1\x98",
+"\xd1\x99",
+"\xd1\x9a",
+"\xd1\x9b",
+"\xd1\x9c",
+"\xd1\x9d",
+"\xd1\x9e",
+"\xd1\x9f",
+"\xd1\xa0",
+"\xd1\xa1",
+"\xd1\xa2",
+"\xd1\xa3",
+"\xd1\xa4",
+"\xd1\xa5",
+"\xd1\xa6",
+"\xd1\xa7",
+"\xd1\xa8",
+"\xd1\xa9",
+"\xd1\xaa",
+"\xd1\xab",
+"\xd1\xac",
+"\xd1\xad",
+"\xd1\xae",
+"\xd1\xaf",
+"\xd1\xb0",
+"\xd1\xb1",
+"\xd1\xb2",
+"\xd1\xb3",
+"\xd1\xb4",
+"\xd1\xb5",
+"\xd1\xb6",
+"\xd1\xb7",
+"\xd1\xb8",
+"\xd1\xb9",
+"\xd1\xba",
+"\xd1\xbb",
+"\xd1\xbc",
+"\xd1\xbd",
+"\xd1\xbe",
+"\xd1\xbf",
+"\xd2\x80",
+"\xd2\x81",
+"\xd2\x8a",
+"\xd2\x8b",
+"\xd2\x8c",
+"\xd2\x8d",
+"\xd2\x8e",
+"\xd2\x8f",
+"\xd2\x90",
+"\xd2\x91",
+"\xd2\x92",
+"\xd2\x93",
+"\xd2\x94",
+"\xd2\x95",
+"\xd2\x96",
+"\xd2\x97",
+"\xd2\x98",
+"\xd2\x99",
+"\xd2\x9a",
+"\xd2\x9b",
+"\xd2\x9c",
+"\xd2\x9d",
+"\xd2\x9e",
+"\xd2\x9f",
+"\xd2\xa0",
+"\xd2\xa1",
+"\xd2\xa2",
+"\xd2\xa3",
+"\xd2\xa4",
+"\xd2\xa5",
+"\xd2\xa6",
+"\xd2\xa7",
+"\xd2\xa8",
+"\xd2\xa9",
+"\xd2\xaa",
+"\xd2\xab",
+"\xd2\xac",
+"\xd2\xad",
+"\xd2\xae",
+"\xd2\xaf",
+"\xd2\xb0",
+"\xd2\xb1",
+"\xd2\xb2",
+"\xd2\xb3",
+"\xd2\xb4",
+"\xd2\xb5",
+"\xd2\xb6",
+"\xd2\xb7",
+"\xd2\xb8",
+"\xd2\xb9",
+"\xd2\xba",
+"\xd2\xbb",
+"\xd2\xbc",
+"\xd2\xbd",
+"\xd2\xbe",
+"\xd2\xbf",
+"\xd3\x80",
+"\xd3\x81",
+"\xd3\x82",
+"\xd3\x83",
+"\xd3\x84",
+"\xd3\x85",
+"\xd3\x86",
+"\xd3\x87",
+"\xd3\x88",
+"\xd3\x89",
+"\xd3\x8a",
+"\xd3\x8b",
+"\xd3\x8c",
+"\xd3\x8d",
+"\xd3\x8e",
+"\xd3\x8f",
+"\xd3\x90",
+"\xd3\x91",
+"\xd3\x92",
+"\xd3\x93",
+"\xd3\x94",
+"\xd3\x95",
+"\xd3\x96",
+"\xd3\x97",
+"\xd3\x98",
+"\xd3\x99",
+"\xd3\x9a",
+"\xd3\x9b",
+"\xd3\x9c",
+"\xd3\x9d",
+"\xd3\x9e",
+"\xd3\x9f",
+"\xd3\xa0",
+"\xd3\xa1",
+"\xd3\xa2",
+"\xd3\xa3",
+"\xd3\xa4",
+"\xd3\xa5",
+"\xd3\xa6",
+"\xd3\xa7",
+"\xd3\xa8",
+"\xd3\xa9",
+"\xd3\xaa",
+"\xd3\xab",
+"\xd3\xac",
+"\xd3\xad",
+"\xd3\xae",
+"\xd3\xaf",
+"\xd3\xb0",
+"\xd3\xb1",
+"\xd3\xb2",
+"\xd3\xb3",
+"\xd3\xb4",
+"\xd3\xb5",
+"\xd3\xb6",
+"\xd3\xb7",
+"\xd3\xb8",
+"\xd3\xb9",
+"\xd3\xba",
+"\xd3\xbb",
+"\xd3\xbc",
+"\xd3\xbd",
+"\xd3\xbe",
+"\xd3\xbf",
+"\xd4\x80",
+"\xd4\x81",
+"\xd4\x82",
+"\xd4\x83",
+"\xd4\x84",
+"\xd4\x85",
+"\xd4\x86",
+"\xd4\x87",
+"\xd4\x88",
+"\xd4\x89",
+"\xd4\x8a",
+"\xd4\x8b",
+"\xd4\x8c",
+"\xd4\x8d",
+"\xd4\x8e",
+"\xd4\x8f",
+"\xd4\x90",
+"\xd4\x91",
+"\xd4\x92",
+"\xd4\x93",
+"\xd4\x94",
+"\xd4\x95",
+"\xd4\x96",
+"\xd4\x97",
+"\xd4\x98",
+"\xd4\x99",
+"\xd4\x9a",
+"\xd4\x9b",
+"\xd4\x9c",
+"\xd4\x9d",
+"\xd4\x9e",
+"\xd4\x9f",
+"\xd4\xa0",
+"\xd4\xa1",
+"\xd4\xa2",
+"\xd4\xa3",
+"\xd4\xa4",
+"\xd4\xa5",
+"\xd4\xa6",
+"\xd4\xa7",
+"\xd4\xb1",
+"\xd4\xb2",
+"\xd4\xb3",
+"\xd4\xb4",
+"\xd4\xb5",
+"\xd4\xb5\xd5\x92",
+"\xd4\xb6",
+"\xd4\xb7",
+"\xd4\xb8",
+"\xd4\xb9",
+"\xd4\xba",
+"\xd4\xbb",
+"\xd4\xbc",
+"\xd4\xbd",
+"\xd4\xbe",
+"\xd4\xbf",
+"\xd5\x80",
+"\xd5\x81",
+"\xd5\x82",
+"\xd5\x83",
+"\xd5\x84",
+"\xd5\x84\xd4\xb5",
+"\xd5\x84\xd4\xbb",
+"\xd5\x84\xd4\xbd",
+"\xd5\x84\xd5\x86",
+"\xd5\x85",
+"\xd5\x86",
+"\xd5\x87",
+"\xd5\x88",
+"\xd5\x89",
+"\xd5\x8a",
+"\xd5\x8b",
+"\xd5\x8c",
+"\xd5\x8d",
+"\xd5\x8e",
+"\xd5\x8e\xd5\x86",
+"\xd5\x8f",
+"\xd5\x90",
+"\xd5\x91",
+"\xd5\x92",
+"\xd5\x93",
+"\xd5\x94",
+"\xd5\x95",
+"\xd5\x96",
+"\xd5\xa1",
+"\xd5\xa2",
+"\xd5\xa3",
+"\xd5\xa4",
+"\xd5\xa5",
+"\xd5\xa5\xd6\x82",
+"\xd5\xa6",
+"\xd5\xa7",
+"\xd5\xa8",
+"\xd5\xa9",
+"\xd5\xaa",
+"\xd5\xab",
+"\xd5\xac",
+"\xd5\xad",
+"\xd5\xae",
+"\xd5\xaf",
+"\xd5\xb0",
+"\xd5\xb1",
+"\xd5\xb2",
+"\xd5\xb3",
+"\xd5\xb4",
+"\xd5\xb4\xd5\xa5",
+"\xd5\xb4\xd5\xab",
+"\xd5\xb4\xd5\xad",
+"\xd5\xb4\xd5\xb6",
+"\xd5\xb5",
+"\xd5\xb6",
+"\xd5\xb7",
+"\xd5\xb8",
+"\xd5\xb9",
+"\xd5\xba",
+"\xd5\xbb",
+"\xd5\xbc",
+"\xd5\xbd",
+"\xd5\xbe",
+"\xd5\xbe\xd5\xb6",
+"\xd5\xbf",
+"\xd6\x80",
+"\xd6\x81",
+"\xd6\x82",
+"\xd6\x83",
+"\xd6\x84",
+"\xd6\x85",
+"\xd6\x86",
+"\xe1\x82\xa0",
+"\xe1\x82\xa1",
+"\xe1\x82\xa2",
+"\xe1\x82\xa3",
+"\xe1\x82\xa4",
+"\xe1\x82\xa5",
+"\xe1\x82\xa6",
+"\xe1\x82\xa7",
+"\xe1\x82\xa8",
+"\xe1\x82\xa9",
+"\xe1\x82\xaa",
+"\xe1\x82\xab",
+"\xe1\x82\xac",
+"\xe1\x82\xad",
+"\xe1\x82\xae",
+"\xe1\x82\xaf",
+"\xe1\x82\xb0",
+"\xe1\x82\xb1",
+"\xe1\x82\xb2",
+"\xe1\x82\xb3",
+"\xe1\x82\xb4",
+"\xe1\x82\xb5",
+"\xe1\x82\xb6",
+"\xe1\x82\xb7",
+"\xe1\x82\xb8",
+"\xe1\x82\xb9",
+"\xe1\x82\xba",
+"\xe1\x82\xbb",
+"\xe1\x82\xbc",
+"\xe1\x82\xbd",
+"\xe1\x82\xbe",
+"\xe1\x82\xbf",
+"\xe1\x83\x80",
+"\xe1\x83\x81",
+"\xe1\x83\x82",
+"\xe1\x83\x83",
+"\xe1\x83\x84",
+"\xe1\x83\x85",
+"\xe1\x83\x87",
+"\xe1\x83\x8d",
+"\xe1\xb5\xb9",
+"\xe1\xb5\xbd",
+"\xe1\xb8\x80",
+"\xe1\xb8\x81",
+"\xe1\xb8\x82",
+"\xe1\xb8\x83",
+"\xe1\xb8\x84",
+"\xe1\xb8\x85",
+"\xe1\xb8\x86",
+"\xe1\xb8\x87",
+"\xe1\xb8\x88",
+"\xe1\xb8\x89",
+"\xe1\xb8\x8a",
+"\xe1\xb8\x8b",
+"\xe1\xb8\x8c",
+"\xe1\xb8\x8d",
+"\xe1\xb8\x8e",
+"\xe1\xb8\x8f",
+"\xe1\xb8\x90",
+"\xe1\xb8\x91",
+"\xe1\xb8\x92",
+"\xe1\xb8\x93",
+"\xe1\xb8\x94",
+"\xe1\xb8\x95",
+"\xe1\xb8\x96",
+"\xe1\xb8\x97",
+"\xe1\xb8\x98",
+"\xe1\xb8\x99",
+"\xe1\xb8\x9a",
+"\xe1\xb8\x9b",
+"\xe1\xb8\x9c",
+"\xe1\xb8\x9d",
+"\xe1\xb8\x9e",
+"\xe1\xb8\x9f",
+"\xe1\xb8\xa0",
+"\xe1\xb8\xa1",
+"\xe1\xb8\xa2",
+"\xe1\xb8\xa3",
+"\xe1\xb8\xa4",
+"\xe1\xb8\xa5",
+"\xe1\xb8\xa6",
+"\xe1\xb8\xa7",
+"\xe1\xb8\xa8",
+"\xe1\xb8\xa9",
+"\xe1\xb8\xaa",
+"\xe1\xb8\xab",
+"\xe1\xb8\xac",
+"\xe1\xb8\xad",
+"\xe1\xb8\xae",
+"\xe1\xb8\xaf",
+"\xe1\xb8\xb0",
+"\xe1\xb8\xb1",
+"\xe1\xb8\xb2",
+"\xe1\xb8\xb3",
+"\xe1\xb8\xb4",
+"\xe1\xb8\xb5",
+"\xe1\xb8\xb6",
+"\xe1\xb8\xb7",
+"\xe1\xb8\xb8",
+"\xe1\xb8\xb9",
+"\xe1\xb8\xba",
+"\xe1\xb8\xbb",
+"\xe1\xb8\xbc",
+"\xe1\xb8\xbd",
+"\xe1\xb8\xbe",
+"\xe1\xb8\xbf",
+"\xe1\xb9\x80",
+"\xe1\xb9\x81",
+"\xe1\xb9\x82",
+"\xe1\xb9\x83",
+"\xe1\xb9\x84",
+"\xe1\xb9\x85",
+"\xe1\xb9\x86",
+"\xe1\xb9\x87",
+"\xe1\xb9\x88",
+"\xe1\xb9\x89",
+"\xe1\xb9\x8a",
+"\xe1\xb9\x8b",
+"\xe1\xb9\x8c",
+"\xe1\xb9\x8d",
+"\xe1\xb9\x8e",
+"\xe1\xb9\x8f",
+"\xe1\xb9\x90",
+"\xe1\xb9\x91",
+"\xe1\xb9\x92",
+"\xe1\xb9\x93",
+"\xe1\xb9\x94",
+"\xe1\xb9\x95",
+"\xe1\xb9\x96",
+"\xe1\xb9\x97",
+"\xe1\xb9\x98",
+"\xe1\xb9\x99",
+"\xe1\xb9\x9a",
+"\xe1\xb9\x9b",
+"\xe1\xb9\x9c",
+"\xe1\xb9\x9d",
+"\xe1\xb9\x9e",
+"\xe1\xb9\x9f",
+"\xe1\xb9\xa0",
+"\xe1\xb9\xa1",
+"\xe1\xb9\xa2",
+"\xe1\xb9\xa3",
+"\xe1\xb9\xa4",
+"\xe1\xb9\xa5",
+"\xe1\xb9\xa6",
+"\xe1\xb9\xa7",
+"\xe1\xb9\xa8",
+"\xe1\xb9\xa9",
+"\xe1\xb9\xaa",
+"\xe1\xb9\xab",
+"\xe1\xb9\xac",
+"\xe1\xb9\xad",
+"\xe1\xb9\xae",
+"\xe1\xb9\xaf",
+"\xe1\xb9\xb0",
+"\xe1\xb9\xb1",
+"\xe1\xb9\xb2",
+"\xe1\xb9\xb3",
+"\xe1\xb9\xb4",
+"\xe1\xb9\xb5",
+"\xe1\xb9\xb6",
+"\xe1\xb9\xb7",
+"\xe1\xb9\xb8",
+"\xe1\xb9\xb9",
+"\xe1\xb9\xba",
+"\xe1\xb9\xbb",
+"\xe1\xb9\xbc",
+"\xe1\xb9\xbd",
+"\xe1\xb9\xbe",
+"\xe1\xb9\xbf",
+"\xe1\xba\x80",
+"\xe1\xba\x81",
+"\xe1\xba\x82",
+"\xe1\xba\x83",
+"\xe1\xba\x84",
+"\xe1\xba\x85",
+"\xe1\xba\x86",
+"\xe1\xba\x87",
+"\xe1\xba\x88",
+"\xe1\xba\x89",
+"\xe1\xba\x8a",
+"\xe1\xba\x8b",
+"\xe1\xba\x8c",
+"\xe1\xba\x8d",
+"\xe1\xba\x8e",
+"\xe1\xba\x8f",
+"\xe1\xba\x90",
+"\xe1\xba\x91",
+"\xe1\xba\x92",
+"\xe1\xba\x93",
+"\xe1\xba\x94",
+"\xe1\xba\x95",
+"\xe1\xba\xa0",
+"\xe1\xba\xa1",
+"\xe1\xba\xa2",
+"\xe1\xba\xa3",
+"\xe1\xba\xa4",
+"\xe1\xba\xa5",
+"\xe1\xba\xa6",
+"\xe1\xba\xa7",
+"\xe1\xba\xa8",
+"\xe1\xba\xa9",
+"\xe1\xba\xaa",
+"\xe1\xba\xab",
+"\xe1\xba\xac",
+"\xe1\xba\xad",
+"\xe1\xba\xae",
+"\xe1\xba\xaf",
+"\xe1\xba\xb0",
+"\xe1\xba\xb1",
+"\xe1\xba\xb2",
+"\xe1\xba\xb3",
+"\xe1\xba\xb4",
+"\xe1\xba\xb5",
+"\xe1\xba\xb6",
+"\xe1\xba\xb7",
+"\xe1\xba\xb8",
+"\xe1\xba\xb9",
+"\xe1\xba\xba",
+"\xe1\xba\xbb",
+"\xe1\xba\xbc",
+"\xe1\xba\xbd",
+"\xe1\xba\xbe",
+"\xe1\xba\xbf",
+"\xe1\xbb\x80",
+"\xe1\xbb\x81",
+"\xe1\xbb\x82",
+"\xe1\xbb\x83",
+"\xe1\xbb\x84",
+"\xe1\xbb\x85",
+"\xe1\xbb\x86",
+"\xe1\xbb\x87",
+"\xe1\xbb\x88",
+"\xe1\xbb\x89",
+"\xe1\xbb\x8a",
+"\xe1\xbb\x8b",
+"\xe1\xbb\x8c",
+"\xe1\xbb\x8d",
+"\xe1\xbb\x8e",
+"\xe1\xbb\x8f",
+"\xe1\xbb\x90",
+"\xe1\xbb\x91",
+"\xe1\xbb\x92",
+"\xe1\xbb\x93",
+"\xe1\xbb\x94",
+"\xe1\xbb\x95",
+"\xe1\xbb\x96",
+"\xe1\xbb\x97",
+"\xe1\xbb\x98",
+"\xe1\xbb\x99",
+"\xe1\xbb\x9a",
+"\xe1\xbb\x9b",
+"\xe1\xbb\x9c",
+"\xe1\xbb\x9d",
+"\xe1\xbb\x9e",
+"\xe1\xbb\x9f",
+"\xe1\xbb\xa0",
+"\xe1\xbb\xa1",
+"\xe1\xbb\xa2",
+"\xe1\xbb\xa3",
+"\xe1\xbb\xa4",
+"\xe1\xbb\xa5",
+"\xe1\xbb\xa6",
+"\xe1\xbb\xa7",
+"\xe1\xbb\xa8",
+"\xe1\xbb\xa9",
+"\xe1\xbb\xaa",
+"\xe1\xbb\xab",
+"\xe1\xbb\xac",
+"\xe1\xbb\xad",
+"\xe1\xbb\xae",
+"\xe1\xbb\xaf",
+"\xe1\xbb\xb0",
+"\xe1\xbb\xb1",
+"\xe1\xbb\xb2",
+"\xe1\xbb\xb3",
+"\xe1\xbb\xb4",
+"\xe1\xbb\xb5",
+"\xe1\xbb\xb6",
+"\xe1\xbb\xb7",
+"\xe1\xbb\xb8",
+"\xe1\xbb\xb9",
+"\xe1\xbb\xba",
+"\xe1\xbb\xbb",
+"\xe1\xbb\xbc",
+"\xe1\xbb\xbd",
+"\xe1\xbb\xbe",
+"\xe1\xbb\xbf",
+"\xe1\xbc\x80",
+"\xe1\xbc\x80\xce\xb9",
+"\xe1\xbc\x81",
+"\xe1\xbc\x81\xce\xb9",
+"\xe1\xbc\x82",
+"\xe1\xbc\x82\xce\xb9",
+"\xe1\xbc\x83",
+"\xe1\xbc\x83\xce\xb9",
+"\xe1\xbc\x84",
+"\xe1\xbc\x84\xce\xb9",
+"\xe1\xbc\x85",
+"\xe1\xbc\x85\xce\xb9",
+"\xe1\xbc\x86",
+"\xe1\xbc\x86\xce\xb9",
+"\xe1\xbc\x87",
+"\xe1\xbc\x87\xce\xb9",
+"\xe1\xbc\x88",
+"\xe1\xbc\x88\xce\x99",
+"\xe1\xbc\x89",
+"\xe1\xbc\x89\xce\x99",
+"\xe1\xbc\x8a",
+"\xe1\xbc\x8a\xce\x99",
+"\xe1\xbc\x8b",
+"\xe1\xbc\x8b\xce\x99",
+"\xe1\xbc\x8c",
+"\xe1\xbc\x8c\xce\x99",
+"\xe1\xbc\x8d",
+"\xe1\xbc\x8d\xce\x99",
+"\xe1\xbc\x8e",
+"\xe1\xbc\x8e\xce\x99",
+"\xe1\xbc\x8f",
+"\xe1\xbc\x8f\xce\x99",
+"\xe1\xbc\x90",
+"\xe1\xbc\x91",
+"\xe1\xbc\x92",
+"\xe1\xbc\x93",
+"\xe1\xbc\x94",
+"\xe1\xbc\x95",
+"\xe1\xbc\x98",
+"\xe1\xbc\x99",
+"\xe1\xbc\x9a",
+"\xe1\xbc\x9b",
+"\xe1\xbc\x9c",
+"\xe1\xbc\x9d",
+"\xe1\xbc\xa0",
+"\xe1\xbc\xa0\xce\xb9",
+"\xe1\xbc\xa1",
+"\xe1\xbc\xa1\xce\xb9",
+"\xe1\xbc\xa2",
+"\xe1\xbc\xa2\xce\xb9",
+"\xe1\xbc\xa3",
+"\xe1\xbc\xa3\xce\xb9",
+"\xe1\xbc\xa4",
+"\xe1\xbc\xa4\xce\xb9",
+"\xe1\xbc\xa5",
+"\xe1\xbc\xa5\xce\xb9",
+"\xe1\xbc\xa6",
+"\xe1\xbc\xa6\xce\xb9",
+"\xe1\xbc\xa7",
+"\xe1\xbc\xa7\xce\xb9",
+"\xe1\xbc\xa8",
+"\xe1\xbc\xa8\xce\x99",
+"\xe1\xbc\xa9",
+"\xe1\xbc\xa9\xce\x99",
+"\xe1\xbc\xaa",
+"\xe1\xbc\xaa\xce\x99",
+"\xe1\xbc\xab",
+"\xe1\xbc\xab\xce\x99",
+"\xe1\xbc\xac",
+"\xe1\xbc\xac\xce\x99",
+"\xe1\xbc\xad",
+"\xe1\xbc\xad\xce\x99",
+"\xe1\xbc\xae",
+"\xe1\xbc\xae\xce\x99",
+"\xe1\xbc\xaf",
+"\xe1\xbc\xaf\xce\x99",
+"\xe1\xbc\xb0",
+"\xe1\xbc\xb1",
+"\xe1\xbc\xb2",
+"\xe1\xbc\xb3",
+"\xe1\xbc\xb4",
+"\xe1\xbc\xb5",
+"\xe1\xbc\xb6",
+"\xe1\xbc\xb7",
+"\xe1\xbc\xb8",
+"\xe1\xbc\xb9",
+"\xe1\xbc\xba",
+"\xe1\xbc\xbb",
+"\xe1\xbc\xbc",
+"\xe1\xbc\xbd",
+"\xe1\xbc\xbe",
+"\xe1\xbc\xbf",
+"\xe1\xbd\x80",
+"\xe1\xbd\x81",
+"\xe1\xbd\x82",
+"\xe1\xbd\x83",
+"\xe1\xbd\x84",
+"\xe1\xbd\x85",
+"\xe1\xbd\x88",
+"\xe1\xbd\x89",
+"\xe1\xbd\x8a",
+"\xe1\xbd\x8b",
+"\xe1\xbd\x8c",
+"\xe1\xbd\x8d",
+"\xe1\xbd\x91",
+"\xe1\xbd\x93",
+"\xe1\xbd\x95",
+"\xe1\xbd\x97",
+"\xe1\xbd\x99",
+"\xe1\xbd\x9b",
+"\xe1\xbd\x9d",
+"\xe1\xbd\x9f",
+"\xe1\xbd\xa0",
+"\xe1\xbd\xa0\xce\xb9",
+"\xe1\xbd\xa1",
+"\xe1\xbd\xa1\xce\xb9",
+"\xe1\xbd\xa2",
+"\xe1\xbd\xa2\xce\xb9",
+"\xe1\xbd\xa3",
+"\xe1\xbd\xa3\xce\xb9",
+"\xe1\xbd\xa4",
+"\xe1\xbd\xa4\xce\xb9",
+"\xe1\xbd\xa5",
+"\xe1\xbd\xa5\xce\xb9",
+"\xe1\xbd\xa6",
+"\xe1\xbd\xa6\xce\xb9",
+"\xe1\xbd\xa7",
+"\xe1\xbd\xa7\xce\xb9",
+"\xe1\xbd\xa8",
+"\xe1\xbd\xa8\xce\x99",
+"\xe1\xbd\xa9",
+"\xe1\xbd\xa9\xce\x99",
+"\xe1\xbd\xaa",
+"\xe1\xbd\xaa\xce\x99",
+"\xe1\xbd\xab",
+"\xe1\xbd\xab\xce\x99",
+"\xe1\xbd\xac",
+"\xe1\xbd\xac\xce\x99",
+"\xe1\xbd\xad",
+"\xe1\xbd\xad\xce\x99",
+"\xe1\xbd\xae",
+"\xe1\xbd\xae\xce\x99",
+"\xe1\xbd\xaf",
+"\xe1\xbd\xaf\xce\x99",
+"\xe1\xbd\xb0",
+"\xe1\xbd\xb0\xce\xb9",
+"\xe1\xbd\xb1",
+"\xe1\xbd\xb2",
+"\xe1\xbd\xb3",
+"\xe1\xbd\xb4",
+"\xe1\xbd\xb4\xce\xb9",
+"\xe1\xbd\xb5",
+"\xe1\xbd\xb6",
+"\xe1\xbd\xb7",
+"\xe1\xbd\xb8",
+"\xe1\xbd\xb9",
+"\xe1\xbd\xba",
+"\xe1\xbd\xbb",
+"\xe1\xbd\xbc",
+"\xe1\xbd\xbc\xce\xb9",
+"\xe1\xbd\xbd",
+"\xe1\xbe\x80",
+"\xe1\xbe\x81",
+"\xe1\xbe\x82",
+"\xe1\xbe\x83",
+"\xe1\xbe\x84",
+"\xe1\xbe\x85",
+"\xe1\xbe\x86",
+"\xe1\xbe\x87",
+"\xe1\xbe\x90",
+"\xe1\xbe\x91",
+"\xe1\xbe\x92",
+"\xe1\xbe\x93",
+"\xe1\xbe\x94",
+"\xe1\xbe\x95",
+"\xe1\xbe\x96",
+"\xe1\xbe\x97",
+"\xe1\xbe\xa0",
+"\xe1\xbe\xa1",
+"\xe1\xbe\xa2",
+"\xe1\xbe\xa3",
+"\xe1\xbe\xa4",
+"\xe1\xbe\xa5",
+"\xe1\xbe\xa6",
+"\xe1\xbe\xa7",
+"\xe1\xbe\xb0",
+"\xe1\xbe\xb1",
+"\xe1\xbe\xb3",
+"\xe1\xbe\xb8",
+"\xe1\xbe\xb9",
+"\xe1\xbe\xba",
+"\xe1\xbe\xba\xce\x99",
+"\xe1\xbe\xbb",
+"\xe1\xbf\x83",
+"\xe1\xbf\x88",
+"\xe1\xbf\x89",
+"\xe1\xbf\x8a",
+"\xe1\xbf\x8a\xce\x99",
+"\xe1\xbf\x8b",
+"\xe1\xbf\x90",
+"\xe1\xbf\x91",
+"\xe1\xbf\x98",
+"\xe1\xbf\x99",
+"\xe1\xbf\x9a",
+"\xe1\xbf\x9b",
+"\xe1\xbf\xa0",
+"\xe1\xbf\xa1",
+"\xe1\xbf\xa5",
+"\xe1\xbf\xa8",
+"\xe1\xbf\xa9",
+"\xe1\xbf\xaa",
+"\xe1\xbf\xab",
+"\xe1\xbf\xac",
+"\xe1\xbf\xb3",
+"\xe1\xbf\xb8",
+"\xe1\xbf\xb9",
+"\xe1\xbf\xba",
+"\xe1\xbf\xba\xce\x99",
+"\xe1\xbf\xbb",
+"\xe2\x84\xb2",
+"\xe2\x85\x8e",
+"\xe2\x85\xa0",
+"\xe2\x85\xa1",
+"\xe2\x85\xa2",
+"\xe2\x85\xa3",
+"\xe2\x85\xa4",
+"\xe2\x85\xa5",
+"\xe2\x85\xa6",
+"\xe2\x85\xa7",
+"\xe2\x85\xa8",
+"\xe2\x85\xa9",
+"\xe2\x85\xaa",
+"\xe2\x85\xab",
+"\xe2\x85\xac",
+"\xe2\x85\xad",
+"\xe2\x85\xae",
+"\xe2\x85\xaf",
+"\xe2\x85\xb0",
+"\xe2\x85\xb1",
+"\xe2\x85\xb2",
+"\xe2\x85\xb3",
+"\xe2\x85\xb4",
+"\xe2\x85\xb5",
+"\xe2\x85\xb6",
+"\xe2\x85\xb7",
+"\xe2\x85\xb8",
+"\xe2\x85\xb9",
+"\xe2\x85\xba",
+"\xe2\x85\xbb",
+"\xe2\x85\xbc",
+"\xe2\x85\xbd",
+"\xe2\x85\xbe",
+"\xe2\x85\xbf",
+"\xe2\x86\x83",
+"\xe2\x86\x84",
+"\xe2\x92\xb6",
+"\xe2\x92\xb7",
+"\xe2\x92\xb8",
+"\xe2\x92\xb9",
+"\xe2\x92\xba",
+"\xe2\x92\xbb",
+"\xe2\x92\xbc",
+"\xe2\x92\xbd",
+"\xe2\x92\xbe",
+"\xe2\x92\xbf",
+"\xe2\x93\x80",
+"\xe2\x93\x81",
+"\xe2\x93\x82",
+"\xe2\x93\x83",
+"\xe2\x93\x84",
+"\xe2\x93\x85",
+"\xe2\x93\x86",
+"\xe2\x93\x87",
+"\xe2\x93\x88",
+"\xe2\x93\x89",
+"\xe2\x93\x8a",
+"\xe2\x93\x8b",
+"\xe2\x93\x8c",
+"\xe2\x93\x8d",
+"\xe2\x93\x8e",
+"\xe2\x93\x8f",
+"\xe2\x93\x90",
+"\xe2\x93\x91",
+"\xe2\x93\x92",
+"\xe2\x93\x93",
+"\xe2\x93\x94",
+"\xe2\x93\x95",
+"\xe2\x93\x96",
+"\xe2\x93\x97",
+"\xe2\x93\x98",
+"\xe2\x93\x99",
+"\xe2\x93\x9a",
+"\xe2\x93\x9b",
+"\xe2\x93\x9c",
+"\xe2\x93\x9d",
+"\xe2\x93\x9e",
+"\xe2\x93\x9f",
+"\xe2\x93\xa0",
+"\xe2\x93\xa1",
+"\xe2\x93\xa2",
+"\xe2\x93\xa3",
+"\xe2\x93\xa4",
+"\xe2\x93\xa5",
+"\xe2\x93\xa6",
+"\xe2\x93\xa7",
+"\xe2\x93\xa8",
+"\xe2\x93\xa9",
+"\xe2\xb0\x80",
+"\xe2\xb0\x81",
+"\xe2\xb0\x82",
+"\xe2\xb0\x83",
+"\xe2\xb0\x84",
+"\xe2\xb0\x85",
+"\xe2\xb0\x86",
+"\xe2\xb0\x87",
+"\xe2\xb0\x88",
+"\xe2\xb0\x89",
+"\xe2\xb0\x8a",
+"\xe2\xb0\x8b",
+"\xe2\xb0\x8c",
+"\xe2\xb0\x8d",
+"\xe2\xb0\x8e",
+"\xe2\xb0\x8f",
+"\xe2\xb0\x90",
+"\xe2\xb0\x91",
+"\xe2\xb0\x92",
+"\xe2\xb0\x93",
+"\xe2\xb0\x94",
+"\xe2\xb0\x95",
+"\xe2\xb0\x96",
+"\xe2\xb0\x97",
+"\xe2\xb0\x98",
+"\xe2\xb0\x99",
+"\xe2\xb0\x9a",
+"\xe2\xb0\x9b",
+"\xe2\xb0\x9c",
+"\xe2\xb0\x9d",
+"\xe2\xb0\x9e",
+"\xe2\xb0\x9f",
+"\xe2\xb0\xa0",
+"\xe2\xb0\xa1",
+"\xe2\xb0\xa2",
+"\xe2\xb0\xa3",
+"\xe2\xb0\xa4",
+"\xe2\xb0\xa5",
+"\xe2\xb0\xa6",
+"\xe2\xb0\xa7",
+"\xe2\xb0\xa8",
+"\xe2\xb0\xa9",
+"\xe2\xb0\xaa",
+"\xe2\xb0\xab",
+"\xe2\xb0\xac",
+"\xe2\xb0\xad",
+"\xe2\xb0\xae",
+"\xe2\xb0\xb0",
+"\xe2\xb0\xb1",
+"\xe2\xb0\xb2",
+"\xe2\xb0\xb3",
+"\xe2\xb0\xb4",
+"\xe2\xb0\xb5",
+"\xe2\xb0\xb6",
+"\xe2\xb0\xb7",
+"\xe2\xb0\xb8",
+"\xe2\xb0\xb9",
+"\xe2\xb0\xba",
+"\xe2\xb0\xbb",
+"\xe2\xb0\xbc",
+"\xe2\xb0\xbd",
+"\xe2\xb0\xbe",
+"\xe2\xb0\xbf",
+"\xe2\xb1\x80",
+"\xe2\xb1\x81",
+"\xe2\xb1\x82",
+"\xe2\xb1\x83",
+"\xe2\xb1\x84",
+"\xe2\xb1\x85",
+"\xe2\xb1\x86",
+"\xe2\xb1\x87",
+"\xe2\xb1\x88",
+"\xe2\xb1\x89",
+"\xe2\xb1\x8a",
+"\xe2\xb1\x8b",
+"\xe2\xb1\x8c",
+"\xe2\xb1\x8d",
+"\xe2\xb1\x8e",
+"\xe2\xb1\x8f",
+"\xe2\xb1\x90",
+"\xe2\xb1\x91",
+"\xe2\xb1\x92",
+"\xe2\xb1\x93",
+"\xe2\xb1\x94",
+"\xe2\xb1\x95",
+"\xe2\xb1\x96",
+"\xe2\xb1\x97",
+"\xe2\xb1\x98",
+"\xe2\xb1\x99",
+"\xe2\xb1\x9a",
+"\xe2\xb1\x9b",
+"\xe2\xb1\x9c",
+"\xe2\xb1\x9d",
+"\xe2\xb1\x9e",
+"\xe2\xb1\xa0",
+"\xe2\xb1\xa1",
+"\xe2\xb1\xa2",
+"\xe2\xb1\xa3",
+"\xe2\xb1\xa4",
+"\xe2\xb1\xa5",
+"\xe2\xb1\xa6",
+"\xe2\xb1\xa7",
+"\xe2\xb1\xa8",
+"\xe2\xb1\xa9",
+"\xe2\xb1\xaa",
+"\xe2\xb1\xab",
+"\xe2\xb1\xac",
+"\xe2\xb1\xad",
+"\xe2\xb1\xae",
+"\xe2\xb1\xaf",
+"\xe2\xb1\xb0",
+"\xe2\xb1\xb2",
+"\xe2\xb1\xb3",
+"\xe2\xb1\xb5",
+"\xe2\xb1\xb6",
+"\xe2\xb1\xbe",
+"\xe2\xb1\xbf",
+"\xe2\xb2\x80",
+"\xe2\xb2\x81",
+"\xe2\xb2\x82",
+"\xe2\xb2\x83",
+"\xe2\xb2\x84",
+"\xe2\xb2\x85",
+"\xe2\xb2\x86",
+"\xe2\xb2\x87",
+"\xe2\xb2\x88",
+"\xe2\xb2\x89",
+"\xe2\xb2\x8a",
+"\xe2\xb2\x8b",
+"\xe2\xb2\x8c",
+"\xe2\xb2\x8d",
+"\xe2\xb2\x8e",
+"\xe2\xb2\x8f",
+"\xe2\xb2\x90",
+"\xe2\xb2\x91",
+"\xe2\xb2\x92",
+"\xe2\xb2\x93",
+"\xe2\xb2\x94",
+"\xe2\xb2\x95",
+"\xe2\xb2\x96",
+"\xe2\xb2\x97",
+"\xe2\xb2\x98",
+"\xe2\xb2\x99",
+"\xe2\xb2\x9a",
+"\xe2\xb2\x9b",
+"\xe2\xb2\x9c",
+"\xe2\xb2\x9d",
+"\xe2\xb2\x9e",
+"\xe2\xb2\x9f",
+"\xe2\xb2\xa0",
+"\xe2\xb2\xa1",
+"\xe2\xb2\xa2",
+"\xe2\xb2\xa3",
+"\xe2\xb2\xa4",
+"\xe2\xb2\xa5",
+"\xe2\xb2\xa6",
+"\xe2\xb2\xa7",
+"\xe2\xb2\xa8",
+"\xe2\xb2\xa9",
+"\xe2\xb2\xaa",
+"\xe2\xb2\xab",
+"\xe2\xb2\xac",
+"\xe2\xb2\xad",
+"\xe2\xb2\xae",
+"\xe2\xb2\xaf",
+"\xe2\xb2\xb0",
+"\xe2\xb2\xb1",
+"\xe2\xb2\xb2",
+"\xe2\xb2\xb3",
+"\xe2\xb2\xb4",
+"\xe2\xb2\xb5",
+"\xe2\xb2\xb6",
+"\xe2\xb2\xb7",
+"\xe2\xb2\xb8",
+"\xe2\xb2\xb9",
+"\xe2\xb2\xba",
+"\xe2\xb2\xbb",
+"\xe2\xb2\xbc",
+"\xe2\xb2\xbd",
+"\xe2\xb2\xbe",
+"\xe2\xb2\xbf",
+"\xe2\xb3\x80",
+"\xe2\xb3\x81",
+"\xe2\xb3\x82",
+"\xe2\xb3\x83",
+"\xe2\xb3\x84",
+"\xe2\xb3\x85",
+"\xe2\xb3\x86",
+"\xe2\xb3\x87",
+"\xe2\xb3\x88",
+"\xe2\xb3\x89",
+"\xe2\xb3\x8a",
+"\xe2\xb3\x8b",
+"\xe2\xb3\x8c",
+"\xe2\xb3\x8d",
+"\xe2\xb3\x8e",
+"\xe2\xb3\x8f",
+"\xe2\xb3\x90",
+"\xe2\xb3\x91",
+"\xe2\xb3\x92",
+"\xe2\xb3\x93",
+"\xe2\xb3\x94",
+"\xe2\xb3\x95",
+"\xe2\xb3\x96",
+"\xe2\xb3\x97",
+"\xe2\xb3\x98",
+"\xe2\xb3\x99",
+"\xe2\xb3\x9a",
+"\xe2\xb3\x9b",
+"\xe2\xb3\x9c",
+"\xe2\xb3\x9d",
+"\xe2\xb3\x9e",
+"\xe2\xb3\x9f",
+"\xe2\xb3\xa0",
+"\xe2\xb3\xa1",
+"\xe2\xb3\xa2",
+"\xe2\xb3\xa3",
+"\xe2\xb3\xab",
+"\xe2\xb3\xac",
+"\xe2\xb3\xad",
+"\xe2\xb3\xae",
+"\xe2\xb3\xb2",
+"\xe2\xb3\xb3",
+"\xe2\xb4\x80",
+"\xe2\xb4\x81",
+"\xe2\xb4\x82",
+"\xe2\xb4\x83",
+"\xe2\xb4\x84",
+"\xe2\xb4\x85",
+"\xe2\xb4\x86",
+"\xe2\xb4\x87",
+"\xe2\xb4\x88",
+"\xe2\xb4\x89",
+"\xe2\xb4\x8a",
+"\xe2\xb4\x8b",
+"\xe2\xb4\x8c",
+"\xe2\xb4\x8d",
+"\xe2\xb4\x8e",
+"\xe2\xb4\x8f",
+"\xe2\xb4\x90",
+"\xe2\xb4\x91",
+"\xe2\xb4\x92",
+"\xe2\xb4\x93",
+"\xe2\xb4\x94",
+"\xe2\xb4\x95",
+"\xe2\xb4\x96",
+"\xe2\xb4\x97",
+"\xe2\xb4\x98",
+"\xe2\xb4\x99",
+"\xe2\xb4\x9a",
+"\xe2\xb4\x9b",
+"\xe2\xb4\x9c",
+"\xe2\xb4\x9d",
+"\xe2\xb4\x9e",
+"\xe2\xb4\x9f",
+"\xe2\xb4\xa0",
+"\xe2\xb4\xa1",
+"\xe2\xb4\xa2",
+"\xe2\xb4\xa3",
+"\xe2\xb4\xa4",
+"\xe2\xb4\xa5",
+"\xe2\xb4\xa7",
+"\xe2\xb4\xad",
+"\xea\x99\x80",
+"\xea\x99\x81",
+"\xea\x99\x82",
+"\xea\x99\x83",
+"\xea\x99\x84",
+"\xea\x99\x85",
+"\xea\x99\x86",
+"\xea\x99\x87",
+"\xea\x99\x88",
+"\xea\x99\x89",
+"\xea\x99\x8a",
+"\xea\x99\x8b",
+"\xea\x99\x8c",
+"\xea\x99\x8d",
+"\xea\x99\x8e",
+"\xea\x99\x8f",
+"\xea\x99\x90",
+"\xea\x99\x91",
+"\xea\x99\x92",
+"\xea\x99\x93",
+"\xea\x99\x94",
+"\xea\x99\x95",
+"\xea\x99\x96",
+"\xea\x99\x97",
+"\xea\x99\x98",
+"\xea\x99\x99",
+"\xea\x99\x9a",
+"\xea\x99\x9b",
+"\xea\x99\x9c",
+"\xea\x99\x9d",
+"\xea\x99\x9e",
+"\xea\x99\x9f",
+"\xea\x99\xa0",
+"\xea\x99\xa1",
+"\xea\x99\xa2",
+"\xea\x99\xa3",
+"\xea\x99\xa4",
+"\xea\x99\xa5",
+"\xea\x99\xa6",
+"\xea\x99\xa7",
+"\xea\x99\xa8",
+"\xea\x99\xa9",
+"\xea\x99\xaa",
+"\xea\x99\xab",
+"\xea\x99\xac",
+"\xea\x99\xad",
+"\xea\x9a\x80",
+"\xea\x9a\x81",
+"\xea\x9a\x82",
+"\xea\x9a\x83",
+"\xea\x9a\x84",
+"\xea\x9a\x85",
+"\xea\x9a\x86",
+"\xea\x9a\x87",
+"\xea\x9a\x88",
+"\xea\x9a\x89",
+"\xea\x9a\x8a",
+"\xea\x9a\x8b",
+"\xea\x9a\x8c",
+"\xea\x9a\x8d",
+"\xea\x9a\x8e",
+"\xea\x9a\x8f",
+"\xea\x9a\x90",
+"\xea\x9a\x91",
+"\xea\x9a\x92",
+"\xea\x9a\x93",
+"\xea\x9a\x94",
+"\xea\x9a\x95",
+"\xea\x9a\x96",
+"\xea\x9a\x97",
+"\xea\x9c\xa2",
+"\xea\x9c\xa3",
+"\xea\x9c\xa4",
+"\xea\x9c\xa5",
+"\xea\x9c\xa6",
+"\xea\x9c\xa7",
+"\xea\x9c\xa8",
+"\xea\x9c\xa9",
+"\xea\x9c\xaa",
+"\xea\x9c\xab",
+"\xea\x9c\xac",
+"\xea\x9c\xad",
+"\xea\x9c\xae",
+"\xea\x9c\xaf",
+"\xea\x9c\xb2",
+"\xea\x9c\xb3",
+"\xea\x9c\xb4",
+"\xea\x9c\xb5",
+"\xea\x9c\xb6",
+"\xea\x9c\xb7",
+"\xea\x9c\xb8",
+"\xea\x9c\xb9",
+"\xea\x9c\xba",
+"\xea\x9c\xbb",
+"\xea\x9c\xbc",
+"\xea\x9c\xbd",
+"\xea\x9c\xbe",
+"\xea\x9c\xbf",
+"\xea\x9d\x80",
+"\xea\x9d\x81",
+"\xea\x9d\x82",
+"\xea\x9d\x83",
+"\xea\x9d\x84",
+"\xea\x9d\x85",
+"\xea\x9d\x86",
+"\xea\x9d\x87",
+"\xea\x9d\x88",
+"\xea\x9d\x89",
+"\xea\x9d\x8a",
+"\xea\x9d\x8b",
+"\xea\x9d\x8c",
+"\xea\x9d\x8d",
+"\xea\x9d\x8e",
+"\xea\x9d\x8f",
+"\xea\x9d\x90",
+"\xea\x9d\x91",
+"\xea\x9d\x92",
+"\xea\x9d\x93",
+"\xea\x9d\x94",
+"\xea\x9d\x95",
+"\xea\x9d\x96",
+"\xea\x9d\x97",
+"\xea\x9d\x98",
+"\xea\x9d\x99",
+"\xea\x9d\x9a",
+"\xea\x9d\x9b",
+"\xea\x9d\x9c",
+"\xea\x9d\x9d",
+"\xea\x9d\x9e",
+"\xea\x9d\x9f",
+"\xea\x9d\xa0",
+"\xea\x9d\xa1",
+"\xea\x9d\xa2",
+"\xea\x9d\xa3",
+"\xea\x9d\xa4",
+"\xea\x9d\xa5",
+"\xea\x9d\xa6",
+"\xea\x9d\xa7",
+"\xea\x9d\xa8",
+"\xea\x9d\xa9",
+"\xea\x9d\xaa",
+"\xea\x9d\xab",
+"\xea\x9d\xac",
+"\xea\x9d\xad",
+"\xea\x9d\xae",
+"\xea\x9d\xaf",
+"\xea\x9d\xb9",
+"\xea\x9d\xba",
+"\xea\x9d\xbb",
+"\xea\x9d\xbc",
+"\xea\x9d\xbd",
+"\xea\x9d\xbe",
+"\xea\x9d\xbf",
+"\xea\x9e\x80",
+"\xea\x9e\x81",
+"\xea\x9e\x82",
+"\xea\x9e\x83",
+"\xea\x9e\x84",
+"\xea\x9e\x85",
+"\xea\x9e\x86",
+"\xea\x9e\x87",
+"\xea\x9e\x8b",
+"\xea\x9e\x8c",
+"\xea\x9e\x8d",
+"\xea\x9e\x90",
+"\xea\x9e\x91",
+"\xea\x9e\x92",
+"\xea\x9e\x93",
+"\xea\x9e\xa0",
+"\xea\x9e\xa1",
+"\xea\x9e\xa2",
+"\xea\x9e\xa3",
+"\xea\x9e\xa4",
+"\xea\x9e\xa5",
+"\xea\x9e\xa6",
+"\xea\x9e\xa7",
+"\xea\x9e\xa8",
+"\xea\x9e\xa9",
+"\xea\x9e\xaa",
+"\xef\xbc\xa1",
+"\xef\xbc\xa2",
+"\xef\xbc\xa3",
+"\xef\xbc\xa4",
+"\xef\xbc\xa5",
+"\xef\xbc\xa6",
+"\xef\xbc\xa7",
+"\xef\xbc\xa8",
+"\xef\xbc\xa9",
+"\xef\xbc\xaa",
+"\xef\xbc\xab",
+"\xef\xbc\xac",
+"\xef\xbc\xad",
+"\xef\xbc\xae",
+"\xef\xbc\xaf",
+"\xef\xbc\xb0",
+"\xef\xbc\xb1",
+"\xef\xbc\xb2",
+"\xef\xbc\xb3",
+"\xef\xbc\xb4",
+"\xef\xbc\xb5",
+"\xef\xbc\xb6",
+"\xef\xbc\xb7",
+"\xef\xbc\xb8",
+"\xef\xbc\xb9",
+"\xef\xbc\xba",
+"\xef\xbd\x81",
+"\xef\xbd\x82",
+"\xef\xbd\x83",
+"\xef\xbd\x84",
+"\xef\xbd\x85",
+"\xef\xbd\x86",
+"\xef\xbd\x87",
+"\xef\xbd\x88",
+"\xef\xbd\x89",
+"\xef\xbd\x8a",
+"\xef\xbd\x8b",
+"\xef\xbd\x8c",
+"\xef\xbd\x8d",
+"\xef\xbd\x8e",
+"\xef\xbd\x8f",
+"\xef\xbd\x90",
+"\xef\xbd\x91",
+"\xef\xbd\x92",
+"\xef\xbd\x93",
+"\xef\xbd\x94",
+"\xef\xbd\x95",
+"\xef\xbd\x96",
+"\xef\xbd\x97",
+"\xef\xbd\x98",
+"\xef\xbd\x99",
+"\xef\xbd\x9a",
+"\xf0\x90\x90\x80",
+"\xf0\x90\x90\x81",
+"\xf0\x90\x90\x82",
+"\xf0\x90\x90\x83",
+"\xf0\x90\x90\x84",
+"\xf0\x90\x90\x85",
+"\xf0\x90\x90\x86",
+"\xf0\x90\x90\x87",
+"\xf0\x90\x90\x88",
+"\xf0\x90\x90\x89",
+"\xf0\x90\x90\x8a",
+"\xf0\x90\x90\x8b",
+"\xf0\x90\x90\x8c",
+"\xf0\x90\x90\x8d",
+"\xf0\x90\x90\x8e",
+"\xf0\x90\x90\x8f",
+"\xf0\x90\x90\x90",
+"\xf0\x90\x90\x91",
+"\xf0\x90\x90\x92",
+"\xf0\x90\x90\x93",
+"\xf0\x90\x90\x94",
+"\xf0\x90\x90\x95",
+"\xf0\x90\x90\x96",
+"\xf0\x90\x90\x97",
+"\xf0\x90\x90\x98",
+"\xf0\x90\x90\x99",
+"\xf0\x90\x90\x9a",
+"\xf0\x90\x90\x9b",
+"\xf0\x90\x90\x9c",
+"\xf0\x90\x90\x9d",
+"\xf0\x90\x90\x9e",
+"\xf0\x90\x90\x9f",
+"\xf0\x90\x90\xa0",
+"\xf0\x90\x90\xa1",
+"\xf0\x90\x90\xa2",
+"\xf0\x90\x90\xa3",
+"\xf0\x90\x90\xa4",
+"\xf0\x90\x90\xa5",
+"\xf0\x90\x90\xa6",
+"\xf0\x90\x90\xa7",
+"\xf0\x90\x90\xa8",
+"\xf0\x90\x90\xa9",
+"\xf0\x90\x90\xaa",
+"\xf0\x90\x90\xab",
+"\xf0\x90\x90\xac",
+"\xf0\x90\x90\xad",
+"\xf0\x90\x90\xae",
+"\xf0\x90\x90\xaf",
+"\xf0\x90\x90\xb0",
+"\xf0\x90\x90\xb1",
+"\xf0\x90\x90\xb2",
+"\xf0\x90\x90\xb3",
+"\xf0\x90\x90\xb4",
+"\xf0\x90\x90\xb5",
+"\xf0\x90\x90\xb6",
+"\xf0\x90\x90\xb7",
+"\xf0\x90\x90\xb8",
+"\xf0\x90\x90\xb9",
+"\xf0\x90\x90\xba",
+"\xf0\x90\x90\xbb",
+"\xf0\x90\x90\xbc",
+"\xf0\x90\x90\xbd",
+"\xf0\x90\x90\xbe",
+"\xf0\x90\x90\xbf",
+"\xf0\x90\x91\x80",
+"\xf0\x90\x91\x81",
+"\xf0\x90\x91\x82",
+"\xf0\x90\x91\x83",
+"\xf0\x90\x91\x84",
+"\xf0\x90\x91\x85",
+"\xf0\x90\x91\x86",
+"\xf0\x90\x91\x87",
+"\xf0\x90\x91\x88",
+"\xf0\x90\x91\x89",
+"\xf0\x90\x91\x8a",
+"\xf0\x90\x91\x8b",
+"\xf0\x90\x91\x8c",
+"\xf0\x90\x91\x8d",
+"\xf0\x90\x91\x8e",
+"\xf0\x90\x91\x8f",
+
+//--Autogenerated -- end of section automatically generated
+};
 
+class CaseConverter : public ICaseConverter {
+	const unsigned char *blocks;
+	int limit;	// Characters from here on have no conversion
 public:
-	CaseConverter() {
-	}
-	bool Initialised() const {
-		return characters.size() > 0;
+	CaseConverter(const unsigned char *blocks_, size_t blocksLength) :
+		blocks(blocks_), limit(static_cast<int>(blocksLength << blockShift)) {
 	}
-	void Add(int character, const char *conversion) {
-		characterToConversion.push_back(CharacterConversion(character, conversion));
-	}
-	const char *Find(int character) {
-		const std::vector<int>::iterator it = std::lower_bound(characters.begin(), characters.end(), character);
-		if (it == characters.end())
-			return 0;
-		else if (*it == character)
-			return conversions[it - characters.begin()].conversion;
-		else
+	const char *Find(int character) const {
+		if ((character < 0) || (character >= limit))
 			return 0;
+		const unsigned short conversion =
+			blockConversions[(blocks[character >> blockShift] << blockShift) | (character & blockMask)];
+		return conversion ? caseConversionStrings[conversion] : 0;
 	}
 	size_t CaseConvertString(char *converted, size_t sizeConverted, const char *mixed, size_t lenMixed) {
 		size_t lenConverted = 0;
@@ -452,144 +2698,11 @@ public:
 		}
 		return lenConverted;
 	}
-	void FinishedAdding() {
-		std::sort(characterToConversion.begin(), characterToConversion.end());
-		characters.reserve(characterToConversion.size());
-		conversions.reserve(characterToConversion.size());
-		for (CharacterToConversion::iterator it = characterToConversion.begin(); it != characterToConversion.end(); ++it) {
-			characters.push_back(it->character);
-			conversions.push_back(it->conversion);
-		}
-		// Empty the original calculated data completely
-		CharacterToConversion().swap(characterToConversion);
-	}
 };
 
-CaseConverter caseConvFold;
-CaseConverter caseConvUp;
-CaseConverter caseConvLow;
-
-void UTF8FromUTF32Character(int uch, char *putf) {
-	size_t k = 0;
-	if (uch < 0x80) {
-		putf[k++] = static_cast<char>(uch);
-	} else if (uch < 0x800) {
-		putf[k++] = static_cast<char>(0xC0 | (uch >> 6));
-		putf[k++] = static_cast<char>(0x80 | (uch & 0x3f));
-	} else if (uch < 0x10000) {
-		putf[k++] = static_cast<char>(0xE0 | (uch >> 12));
-		putf[k++] = static_cast<char>(0x80 | ((uch >> 6) & 0x3f));
-		putf[k++] = static_cast<char>(0x80 | (uch & 0x3f));
-	} else {
-		putf[k++] = static_cast<char>(0xF0 | (uch >> 18));
-		putf[k++] = static_cast<char>(0x80 | ((uch >> 12) & 0x3f));
-		putf[k++] = static_cast<char>(0x80 | ((uch >> 6) & 0x3f));
-		putf[k++] = static_cast<char>(0x80 | (uch & 0x3f));
-	}
-	putf[k] = 0;
-}
-
-void AddSymmetric(enum CaseConversion conversion, int lower,int upper) {
-	char lowerUTF8[UTF8MaxBytes+1];
-	UTF8FromUTF32Character(lower, lowerUTF8);
-	char upperUTF8[UTF8MaxBytes+1];
-	UTF8FromUTF32Character(upper, upperUTF8);
-
-	switch (conversion) {
-	case CaseConversionFold:
-		caseConvFold.Add(upper, lowerUTF8);
-		break;
-	case CaseConversionUpper:
-		caseConvUp.Add(lower, upperUTF8);
-		break;
-	case CaseConversionLower:
-		caseConvLow.Add(upper, lowerUTF8);
-		break;
-	}
-}
-
-void SetupConversions(enum CaseConversion conversion) {
-	// First initialize for the symmetric ranges
-	for (size_t i=0; i<ELEMENTS(symmetricCaseConversionRanges);) {
-		int lower = symmetricCaseConversionRanges[i++];
-		int upper = symmetricCaseConversionRanges[i++];
-		int length = symmetricCaseConversionRanges[i++];
-		int pitch = symmetricCaseConversionRanges[i++];
-		for (int j=0; j<length*pitch; j+=pitch) {
-			AddSymmetric(conversion, lower+j, upper+j);
-		}
-	}
-	// Add the symmetric singletons
-	for (size_t i=0; i<ELEMENTS(symmetricCaseConversions);) {
-		int lower = symmetricCaseConversions[i++];
-		int upper = symmetricCaseConversions[i++];
-		AddSymmetric(conversion, lower, upper);
-	}
-	// Add the complex cases
-	const char *sComplex = complexCaseConversions;
-	while (*sComplex) {
-		// Longest ligature is 3 character so 5 for safety
-		const size_t lenUTF8 = 5*UTF8MaxBytes+1;
-		char originUTF8[lenUTF8];
-		char foldedUTF8[lenUTF8];
-		char lowerUTF8[lenUTF8];
-		char upperUTF8[lenUTF8];
-		size_t i = 0;
-		while (*sComplex && *sComplex != '|') {
-			originUTF8[i++] = *sComplex;
-			sComplex++;
-		}
-		sComplex++;
-		originUTF8[i] = 0;
-		i = 0;
-		while (*sComplex && *sComplex != '|') {
-			foldedUTF8[i++] = *sComplex;
-			sComplex++;
-		}
-		sComplex++;
-		foldedUTF8[i] = 0;
-		i = 0;
-		while (*sComplex && *sComplex != '|') {
-			upperUTF8[i++] = *sComplex;
-			sComplex++;
-		}
-		sComplex++;
-		upperUTF8[i] = 0;
-		i = 0;
-		while (*sComplex && *sComplex != '|') {
-			lowerUTF8[i++] = *sComplex;
-			sComplex++;
-		}
-		sComplex++;
-		lowerUTF8[i] = 0;
-
-		int character = UnicodeFromUTF8(reinterpret_cast<unsigned char *>(originUTF8));
-
-		if (conversion == CaseConversionFold && foldedUTF8[0]) {
-			caseConvFold.Add(character, foldedUTF8);
-		}
-
-		if (conversion == CaseConversionUpper && upperUTF8[0]) {
-			caseConvUp.Add(character, upperUTF8);
-		}
-
-		if (conversion == CaseConversionLower && lowerUTF8[0]) {
-			caseConvLow.Add(character, lowerUTF8);
-		}
-	}
-
-	switch (conversion) {
-	case CaseConversionFold:
-		caseConvFold.FinishedAdding();
-		break;
-	case CaseConversionUpper:
-		caseConvUp.FinishedAdding();
-		break;
-	case CaseConversionLower:
-		caseConvLow.FinishedAdding();
-		break;
-	}
-}
+CaseConverter caseConvFold(foldBlocks, ELEMENTS(foldBlocks));
+CaseConverter caseConvUp(upperBlocks, ELEMENTS(upperBlocks));
+CaseConverter caseConvLow(lowerBlocks, ELEMENTS(lowerBlocks));
 
 CaseConverter *ConverterForConversion(enum CaseConversion conversion) {
 	switch (conversion) {
@@ -610,24 +2723,15 @@ namespace Scintilla {
 #endif
 
 ICaseConverter *ConverterFor(enum CaseConversion conversion) {
-	CaseConverter *pCaseConv = ConverterForConversion(conversion);
-	if (!pCaseConv->Initialised())
-		SetupConversions(conversion);
-	return pCaseConv;
+	return ConverterForConversion(conversion);
 }
 
 const char *CaseConvert(int character, enum CaseConversion conversion) {
-	CaseConverter *pCaseConv = ConverterForConversion(conversion);
-	if (!pCaseConv->Initialised())
-		SetupConversions(conversion);
-	return pCaseConv->Find(character);
+	return ConverterForConversion(conversion)->Find(character);
 }
 
 size_t CaseConvertString(char *converted, size_t sizeConverted, const char *mixed, size_t lenMixed, enum CaseConversion conversion) {
-	CaseConverter *pCaseConv = ConverterForConversion(conversion);
-	if (!pCaseConv->Initialised())
-		SetupConversions(conversion);
-	return pCaseConv->CaseConvertString(converted, sizeConverted, mixed, lenMixed);
+	return ConverterForConversion(conversion)->CaseConvertString(converted, sizeConverted, mixed, lenMixed);
 }
 
 #ifdef SCI_NAMESPACE
@@ -20,6 +20,10 @@ using namespace Scintilla;
 CaseFolder::~CaseFolder() {
 }
 
+const char *CaseFolder::ByteMapping() const {
+	return 0;
+}
+
 CaseFolderTable::CaseFolderTable() {
 	for (size_t iChar=0; iChar<sizeof(mapping); iChar++) {
 		mapping[iChar] = static_cast<char>(iChar);
@@ -40,6 +44,10 @@ size_t CaseFolderTable::Fold(char *folded, size_t sizeFolded, const char *mixed,
 	}
 }
 
+const char *CaseFolderTable::ByteMapping() const {
+	return mapping;
+}
+
 void CaseFolderTable::SetTranslation(char ch, char chTranslation) {
 	mapping[static_cast<unsigned char>(ch)] = chTranslation;
 }
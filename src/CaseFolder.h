@@ -16,6 +16,8 @@ class CaseFolder {
 public:
 	virtual ~CaseFolder();
 	virtual size_t Fold(char *folded, size_t sizeFolded, const char *mixed, size_t lenMixed) = 0;
+	// Table used by Fold for single byte characters or NULL if there is none.
+	virtual const char *ByteMapping() const;
 };
 
 class CaseFolderTable : public CaseFolder {
@@ -25,6 +27,7 @@ public:
 	CaseFolderTable();
 	virtual ~CaseFolderTable();
 	virtual size_t Fold(char *folded, size_t sizeFolded, const char *mixed, size_t lenMixed);
+	virtual const char *ByteMapping() const;
 	void SetTranslation(char ch, char chTranslation);
 	void StandardASCII();
 };
@@ -11,7 +11,14 @@
 #include <stdarg.h>
 
 #include <stdexcept>
+#include <vector>
 #include <algorithm>
+#include <climits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define CELLBUFFER_SSE2
+#endif
 
 #include "Platform.h"
 
@@ -19,6 +26,8 @@
 #include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
+#include "BlockedPartitioning.h"
+#include "RunStyles.h"
 #include "CellBuffer.h"
 #include "UniConversion.h"
 
@@ -26,52 +35,371 @@
 using namespace Scintilla;
 #endif
 
-LineVector::LineVector() : starts(256), perLine(0) {
-	Init();
+#ifdef SCI_NAMESPACE
+namespace Scintilla {
+#endif
+
+template <typename POS, typename STARTS>
+class LineVector : public ILineVector {
+	STARTS starts;
+	PerLine *perLine;
+
+	// Private so LineVector objects can not be copied
+	LineVector(const LineVector &);
+
+public:
+	LineVector() : starts(256), perLine(0) {
+		Init();
+	}
+	~LineVector() {
+	}
+	void Init() {
+		starts.DeleteAll();
+		if (perLine) {
+			perLine->Init();
+		}
+	}
+	void SetPerLine(PerLine *pl) {
+		perLine = pl;
+	}
+	void InsertText(Sci::Line line, Sci::Position delta) {
+		starts.InsertText(static_cast<POS>(line), static_cast<POS>(delta));
+	}
+	void InsertLine(Sci::Line line, Sci::Position position, bool lineStart) {
+		starts.InsertPartition(static_cast<POS>(line), static_cast<POS>(position));
+		if (perLine) {
+			if ((line > 0) && lineStart)
+				line--;
+			perLine->InsertLine(line);
+		}
+	}
+	void InsertLines(Sci::Line line, const Sci::Position *positions, size_t lines, bool lineStart) {
+		const std::vector<POS> positionsInsert(positions, positions + lines);
+		starts.InsertPartitions(static_cast<POS>(line), positionsInsert.data(), lines);
+		if (perLine) {
+			if ((line > 0) && lineStart)
+				line--;
+			perLine->InsertLines(line, lines);
+		}
+	}
+	void SetLineStart(Sci::Line line, Sci::Position position) {
+		starts.SetPartitionStartPosition(static_cast<POS>(line), static_cast<POS>(position));
+	}
+	void RemoveLine(Sci::Line line) {
+		starts.RemovePartition(static_cast<POS>(line));
+		if (perLine) {
+			perLine->RemoveLine(line);
+		}
+	}
+	void RemoveLines(Sci::Line line, Sci::Line lines) {
+		starts.RemovePartitions(static_cast<POS>(line), static_cast<POS>(lines));
+		if (perLine) {
+			perLine->RemoveLines(line, lines);
+		}
+	}
+	Sci::Line Lines() const {
+		return starts.Partitions();
+	}
+	Sci::Line LineFromPosition(Sci::Position pos) const {
+		return starts.PartitionFromPosition(static_cast<POS>(pos));
+	}
+	Sci::Position LineStart(Sci::Line line) const {
+		return starts.PositionFromPartition(static_cast<POS>(line));
+	}
+};
+
+#ifdef SCI_NAMESPACE
 }
+#endif
 
-LineVector::~LineVector() {
-	starts.DeleteAll();
+namespace {
+
+#if defined(CELLBUFFER_SSE2) && defined(__GNUC__)
+inline int FirstBit(int mask) {
+	return __builtin_ctz(mask);
+}
+#elif defined(CELLBUFFER_SSE2)
+inline int FirstBit(int mask) {
+	int bit = 0;
+	while (!(mask & (1 << bit)))
+		bit++;
+	return bit;
 }
+#endif
 
-void LineVector::Init() {
-	starts.DeleteAll();
-	if (perLine) {
-		perLine->Init();
+// Bytes that may end a line: CR, LF and, for Unicode line ends, the last byte of NEL (C2 85)
+// and of LS and PS (E2 80 A8 and E2 80 A9).
+inline bool IsLineEndCandidate(unsigned char ch, bool utf8LineEnds) {
+	return (ch == '\r') || (ch == '\n') || (utf8LineEnds && ((ch == 0x85) || ((ch & 0xFE) == 0xA8)));
+}
+
+// Return the index of the first byte from start that may end a line or length if there is none.
+// Most text has long runs without line ends so checks 16 bytes at a time when SSE2 is available.
+Sci::Position NextLineEndCandidate(const char *s, Sci::Position start, Sci::Position length, bool utf8LineEnds) {
+	Sci::Position i = start;
+#ifdef CELLBUFFER_SSE2
+	const __m128i cr = _mm_set1_epi8('\r');
+	const __m128i lf = _mm_set1_epi8('\n');
+	const __m128i nel = _mm_set1_epi8(static_cast<char>(0x85));
+	const __m128i separatorMask = _mm_set1_epi8(static_cast<char>(0xFE));
+	const __m128i separator = _mm_set1_epi8(static_cast<char>(0xA8));
+	for (; i + 16 <= length; i += 16) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+		__m128i found = _mm_or_si128(_mm_cmpeq_epi8(chunk, cr), _mm_cmpeq_epi8(chunk, lf));
+		if (utf8LineEnds) {
+			found = _mm_or_si128(found, _mm_cmpeq_epi8(chunk, nel));
+			found = _mm_or_si128(found, _mm_cmpeq_epi8(_mm_and_si128(chunk, separatorMask), separator));
+		}
+		const int mask = _mm_movemask_epi8(found);
+		if (mask) {
+			return i + FirstBit(mask);
+		}
 	}
+#endif
+	for (; i < length; i++) {
+		if (IsLineEndCandidate(s[i], utf8LineEnds))
+			return i;
+	}
+	return length;
 }
 
-void LineVector::SetPerLine(PerLine *pl) {
-	perLine = pl;
 }
 
-void LineVector::InsertText(int line, int delta) {
-	starts.InsertText(line, delta);
+namespace {
+
+// A simple LZ77 codec for the text of large undo actions.
+// The compressed form is a sequence of tokens. Each token byte has a literal count in its
+// high 4 bits and a match length - 4 in its low 4 bits. A count of 15 is continued with
+// following bytes that are added until a byte that is not 255. The literals follow the
+// literal count, then, unless the output is complete, a 2 byte little-endian offset back
+// to the start of the match and any continuation of the match length.
+
+const int lzHashBits = 14;
+const Sci::Position lzMinMatch = 4;
+const Sci::Position lzMaxOffset = 0xFFFF;
+
+// Space needed for compressing length bytes when no matches are found.
+Sci::Position LZBound(Sci::Position length) {
+	return length + length / 255 + 16;
 }
 
-void LineVector::InsertLine(int line, int position, bool lineStart) {
-	starts.InsertPartition(line, position);
-	if (perLine) {
-		if ((line > 0) && lineStart)
-			line--;
-		perLine->InsertLine(line);
+inline unsigned int LZRead32(const unsigned char *p) {
+	unsigned int value;
+	memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+inline unsigned char *LZWriteCount(unsigned char *out, Sci::Position count) {
+	for (; count >= 255; count -= 255) {
+		*out++ = 255;
+	}
+	*out++ = static_cast<unsigned char>(count);
+	return out;
+}
+
+unsigned char *LZWriteSequence(unsigned char *out, const unsigned char *literals, Sci::Position lengthLiterals,
+	Sci::Position offset, Sci::Position lengthMatch) {
+	const Sci::Position matchCount = (lengthMatch > 0) ? (lengthMatch - lzMinMatch) : 0;
+	const int tokenLiterals = static_cast<int>((lengthLiterals < 15) ? lengthLiterals : 15);
+	const int tokenMatch = static_cast<int>((matchCount < 15) ? matchCount : 15);
+	*out++ = static_cast<unsigned char>((tokenLiterals << 4) | tokenMatch);
+	if (tokenLiterals == 15)
+		out = LZWriteCount(out, lengthLiterals - 15);
+	memcpy(out, literals, lengthLiterals);
+	out += lengthLiterals;
+	if (lengthMatch > 0) {
+		*out++ = static_cast<unsigned char>(offset & 0xFF);
+		*out++ = static_cast<unsigned char>(offset >> 8);
+		if (tokenMatch == 15)
+			out = LZWriteCount(out, matchCount - 15);
+	}
+	return out;
+}
+
+// Compress length bytes of source into dest which must have room for LZBound(length) bytes.
+// Returns the compressed length.
+Sci::Position LZCompress(const char *source, Sci::Position length, char *dest) {
+	const unsigned char *src = reinterpret_cast<const unsigned char *>(source);
+	unsigned char *out = reinterpret_cast<unsigned char *>(dest);
+	std::vector<Sci::Position> table(1 << lzHashBits, -1);
+	Sci::Position anchor = 0;	// Start of literals not yet written
+	Sci::Position pos = 0;
+	while (pos + lzMinMatch <= length) {
+		const unsigned int sequence = LZRead32(src + pos);
+		const size_t hash = (sequence * 2654435761U) >> (32 - lzHashBits);
+		const Sci::Position candidate = table[hash];
+		table[hash] = pos;
+		if ((candidate >= 0) && (pos - candidate <= lzMaxOffset) && (LZRead32(src + candidate) == sequence)) {
+			Sci::Position lengthMatch = lzMinMatch;
+			while ((pos + lengthMatch < length) && (src[candidate + lengthMatch] == src[pos + lengthMatch])) {
+				lengthMatch++;
+			}
+			out = LZWriteSequence(out, src + anchor, pos - anchor, pos - candidate, lengthMatch);
+			pos += lengthMatch;
+			anchor = pos;
+		} else {
+			pos++;
+		}
+	}
+	out = LZWriteSequence(out, src + anchor, length - anchor, 0, 0);
+	return out - reinterpret_cast<unsigned char *>(dest);
+}
+
+inline Sci::Position LZReadCount(const unsigned char *&in) {
+	Sci::Position count = 0;
+	unsigned char b;
+	do {
+		b = *in++;
+		count += b;
+	} while (b == 255);
+	return count;
+}
+
+// Expand compressed data into dest which has room for exactly length bytes.
+void LZDecompress(const char *source, Sci::Position lengthSource, char *dest, Sci::Position length) {
+	const unsigned char *in = reinterpret_cast<const unsigned char *>(source);
+	const unsigned char *inEnd = in + lengthSource;
+	Sci::Position pos = 0;
+	while (in < inEnd) {
+		const unsigned int token = *in++;
+		Sci::Position lengthLiterals = token >> 4;
+		if (lengthLiterals == 15)
+			lengthLiterals += LZReadCount(in);
+		memcpy(dest + pos, in, lengthLiterals);
+		in += lengthLiterals;
+		pos += lengthLiterals;
+		if (pos >= length)
+			break;
+		const Sci::Position offset = in[0] | (in[1] << 8);
+		in += 2;
+		Sci::Position lengthMatch = (token & 0xF) + lzMinMatch;
+		if ((token & 0xF) == 15)
+			lengthMatch += LZReadCount(in);
+		PLATFORM_ASSERT((offset > 0) && (offset <= pos) && (pos + lengthMatch <= length));
+		// Matches may overlap the output being written so copy forwards a byte at a time
+		const char *from = dest + pos - offset;
+		char *to = dest + pos;
+		for (Sci::Position i = 0; i < lengthMatch; i++) {
+			to[i] = from[i];
+		}
+		pos += lengthMatch;
 	}
 }
 
-void LineVector::SetLineStart(int line, int position) {
-	starts.SetPartitionStartPosition(line, position);
 }
 
-void LineVector::RemoveLine(int line) {
-	starts.RemovePartition(line);
-	if (perLine) {
-		perLine->RemoveLine(line);
+#ifdef SCI_NAMESPACE
+namespace Scintilla {
+#endif
+
+// Append-only store for the text of undo actions.
+// Text is copied into large chunks so recording an action rarely allocates memory.
+// The undo history is a stack so Release discards all text from a mark onwards, which
+// happens when a redo branch is replaced. Released chunks are kept for reuse.
+// Positions increase continuously over all the chunks so marks are simple numbers.
+class UndoArena {
+	struct Chunk {
+		char *bytes;
+		Sci::Position capacity;
+		Sci::Position start;	// Arena position of bytes[0]
+		Sci::Position used;
+	};
+	std::vector<Chunk> chunks;	// Text is in chunks[0] .. chunks[current], any following chunk is spare
+	size_t current;
+	Sci::Position top;	// Arena position of next byte to allocate
+	enum { chunkSize = 0x10000 };
+
+	// Private so UndoArena objects can not be copied
+	UndoArena(const UndoArena &);
+
+	void FreeChunks(size_t first, size_t last) {
+		for (size_t chunk = first; chunk < last; chunk++) {
+			delete []chunks[chunk].bytes;
+		}
+		chunks.erase(chunks.begin() + first, chunks.begin() + last);
 	}
-}
 
-int LineVector::LineFromPosition(int pos) const {
-	return starts.PartitionFromPosition(pos);
+	void NextChunk(Sci::Position length) {
+		const size_t next = chunks.empty() ? 0 : current + 1;
+		if ((next < chunks.size()) && (chunks[next].capacity < length)) {
+			// Spare chunk is too small
+			FreeChunks(next, chunks.size());
+		}
+		if (next >= chunks.size()) {
+			Chunk chunk;
+			chunk.capacity = (length > chunkSize) ? length : static_cast<Sci::Position>(chunkSize);
+			chunk.bytes = new char[chunk.capacity];
+			chunks.push_back(chunk);
+		}
+		current = next;
+		chunks[current].start = top;
+		chunks[current].used = 0;
+	}
+
+public:
+	UndoArena() : current(0), top(0) {
+	}
+	~UndoArena() {
+		FreeChunks(0, chunks.size());
+	}
+	Sci::Position Mark() const {
+		return top;
+	}
+	Sci::Position Start() const {
+		return chunks.empty() ? top : chunks[0].start;
+	}
+	Sci::Position Capacity() const {
+		Sci::Position capacity = 0;
+		for (size_t chunk = 0; chunk < chunks.size(); chunk++) {
+			capacity += chunks[chunk].capacity;
+		}
+		return capacity;
+	}
+	char *Allocate(Sci::Position length) {
+		if (chunks.empty() || ((chunks[current].capacity - chunks[current].used) < length)) {
+			NextChunk(length);
+		}
+		Chunk &chunk = chunks[current];
+		char *allocation = chunk.bytes + chunk.used;
+		chunk.used += length;
+		top += length;
+		return allocation;
+	}
+	/// Discard all text allocated at or after mark.
+	void Release(Sci::Position mark) {
+		if (chunks.empty() || (mark >= top))
+			return;
+		while ((current > 0) && (chunks[current].start >= mark)) {
+			current--;
+		}
+		chunks[current].used = mark - chunks[current].start;
+		top = mark;
+		// Keep one spare chunk for reuse
+		if (current + 2 < chunks.size()) {
+			FreeChunks(current + 2, chunks.size());
+		}
+	}
+	/// Free the chunks that only contain text before mark.
+	void DiscardBefore(Sci::Position mark) {
+		size_t discard = 0;
+		while ((discard < current) && (chunks[discard + 1].start <= mark)) {
+			discard++;
+		}
+		if (discard > 0) {
+			FreeChunks(0, discard);
+			current -= discard;
+		}
+	}
+	void Clear() {
+		FreeChunks(0, chunks.size());
+		current = 0;
+		top = 0;
+	}
+};
+
+#ifdef SCI_NAMESPACE
 }
+#endif
 
 Action::Action() {
 	at = startAction;
@@ -79,40 +407,37 @@ Action::Action() {
 	data = 0;
 	lenData = 0;
 	mayCoalesce = false;
+	mark = 0;
+	lenCompressed = 0;
 }
 
 Action::~Action() {
 	Destroy();
 }
 
-void Action::Create(actionType at_, int position_, const char *data_, int lenData_, bool mayCoalesce_) {
-	delete []data;
-	data = NULL;
+// The data is owned by the undo history and is not copied.
+void Action::Create(actionType at_, Sci::Position position_, char *data_, Sci::Position lenData_, bool mayCoalesce_) {
 	position = position_;
 	at = at_;
-	if (lenData_) {
-		data = new char[lenData_];
-		memcpy(data, data_, lenData_);
-	}
+	data = data_;
 	lenData = lenData_;
 	mayCoalesce = mayCoalesce_;
+	lenCompressed = 0;
 }
 
 void Action::Destroy() {
-	delete []data;
 	data = 0;
 }
 
 void Action::Grab(Action *source) {
-	delete []data;
-
 	position = source->position;
 	at = source->at;
 	data = source->data;
 	lenData = source->lenData;
 	mayCoalesce = source->mayCoalesce;
+	mark = source->mark;
+	lenCompressed = source->lenCompressed;
 
-	// Ownership of source data transferred to this
 	source->position = 0;
 	source->at = startAction;
 	source->data = 0;
@@ -147,13 +472,139 @@ UndoHistory::UndoHistory() {
 	undoSequenceDepth = 0;
 	savePoint = 0;
 	tentativePoint = -1;
+	arena = new UndoArena();
+	limitBytes = 0;
+	compressionThreshold = 0;
+	scratch = 0;
+	lenScratch = 0;
+	expansion = 0;
+	actionExpanded = -1;
 
-	actions[currentAction].Create(startAction);
+	CreateAction(currentAction, startAction);
 }
 
 UndoHistory::~UndoHistory() {
 	delete []actions;
 	actions = 0;
+	delete arena;
+	arena = 0;
+	FreeExpansion();
+	FreeScratch();
+}
+
+void UndoHistory::FreeScratch() {
+	delete []scratch;
+	scratch = 0;
+	lenScratch = 0;
+}
+
+void UndoHistory::FreeExpansion() const {
+	delete []expansion;
+	expansion = 0;
+	actionExpanded = -1;
+}
+
+char *UndoHistory::AllocateExpansion(int act, Sci::Position length) const {
+	FreeExpansion();
+	expansion = new char[length];
+	actionExpanded = act;
+	return expansion;
+}
+
+// Return the action with its text decompressed when needed. The result is valid until
+// another action is expanded or an action with text is created.
+const Action &UndoHistory::ExpandedAction(int act) const {
+	const Action &action = actions[act];
+	if (!action.lenCompressed)
+		return action;
+	if (actionExpanded != act) {
+		LZDecompress(action.data, action.lenCompressed, AllocateExpansion(act, action.lenData), action.lenData);
+	}
+	actionExpansion.Create(action.at, action.position, expansion, action.lenData, action.mayCoalesce);
+	return actionExpansion;
+}
+
+// Creating an action discards any following actions so their text is released and the
+// text of this action follows that of the previous action in the arena.
+void UndoHistory::CreateAction(int act, actionType at, Sci::Position position, const char *data, Sci::Position lengthData, bool mayCoalesce) {
+	if (act == 0) {
+		arena->Clear();
+	}
+	if ((lengthData > 0) || (actionExpanded >= act)) {
+		FreeExpansion();
+	}
+	const Sci::Position mark = (act > 0) ? (actions[act-1].mark + actions[act-1].StoredLength()) : arena->Mark();
+	arena->Release(mark);
+	char *text = 0;
+	Sci::Position lenCompressed = 0;
+	if ((compressionThreshold > 0) && (lengthData >= compressionThreshold)) {
+		// Compress into scratch space so the arena only grows by the compressed length
+		const Sci::Position lenBound = LZBound(lengthData);
+		if (lenScratch < lenBound) {
+			delete []scratch;
+			scratch = 0;
+			lenScratch = 0;
+			scratch = new char[lenBound];
+			lenScratch = lenBound;
+		}
+		lenCompressed = LZCompress(data, lengthData, scratch);
+		if (lenCompressed < lengthData) {
+			text = arena->Allocate(lenCompressed);
+			memcpy(text, scratch, lenCompressed);
+			// Callers use the returned text for notifications so keep it uncompressed until replaced
+			memcpy(AllocateExpansion(act, lengthData), data, lengthData);
+		} else {
+			lenCompressed = 0;
+		}
+	}
+	if ((lengthData > 0) && !text) {
+		text = arena->Allocate(lengthData);
+		memcpy(text, data, lengthData);
+	}
+	actions[act].Create(at, position, text, lengthData, mayCoalesce);
+	actions[act].mark = mark;
+	actions[act].lenCompressed = lenCompressed;
+}
+
+// Remove the first actionsDropped actions. actions[actionsDropped] must be a startAction.
+void UndoHistory::DropOldActions(int actionsDropped) {
+	for (int act = actionsDropped; act <= maxAction; act++) {
+		actions[act - actionsDropped].Grab(&actions[act]);
+	}
+	maxAction -= actionsDropped;
+	currentAction -= actionsDropped;
+	if (savePoint >= actionsDropped)
+		savePoint -= actionsDropped;
+	else
+		savePoint = -1;
+	if (tentativePoint >= 0)
+		tentativePoint -= actionsDropped;
+	if (actionExpanded >= actionsDropped)
+		actionExpanded -= actionsDropped;
+	else
+		FreeExpansion();
+	arena->DiscardBefore(actions[0].mark);
+}
+
+// Drop whole user operations from the start of the history until its text fits in limitBytes
+// with some room to spare so that dropping is not needed for each following action.
+// The most recent user operation and any tentative actions are always kept.
+void UndoHistory::EnforceLimit() {
+	if ((limitBytes <= 0) || (UndoBytes() <= limitBytes))
+		return;
+	const Sci::Position target = limitBytes - limitBytes / 4;
+	const int lastDroppable = (tentativePoint >= 0) ? tentativePoint : (currentAction - 1);
+	int actionsDropped = 0;
+	for (int act = 1; act <= lastDroppable; act++) {
+		if (actions[act].at == startAction) {
+			actionsDropped = act;
+			if ((arena->Mark() - actions[act].mark) <= target)
+				break;
+		}
+	}
+	if (actionsDropped > 0) {
+		DropOldActions(actionsDropped);
+	}
 }
 
 void UndoHistory::EnsureUndoRoom() {
@@ -171,7 +622,7 @@ void UndoHistory::EnsureUndoRoom() {
 	}
 }
 
-const char *UndoHistory::AppendAction(actionType at, int position, const char *data, int lengthData,
+const char *UndoHistory::AppendAction(actionType at, Sci::Position position, const char *data, Sci::Position lengthData,
 	bool &startSequence, bool mayCoalesce) {
 	EnsureUndoRoom();
 	//Platform::DebugPrintf("%% %d action %d %d %d\n", at, position, lengthData, currentAction);
@@ -239,12 +690,13 @@ const char *UndoHistory::AppendAction(actionType at, int position, const char *d
 		currentAction++;
 	}
 	startSequence = oldCurrentAction != currentAction;
-	int actionWithData = currentAction;
-	actions[currentAction].Create(at, position, data, lengthData, mayCoalesce);
+	CreateAction(currentAction, at, position, data, lengthData, mayCoalesce);
+	const char *dataAction = ExpandedAction(currentAction).data;
 	currentAction++;
-	actions[currentAction].Create(startAction);
+	CreateAction(currentAction, startAction);
 	maxAction = currentAction;
-	return actions[actionWithData].data;
+	EnforceLimit();
+	return dataAction;
 }
 
 void UndoHistory::BeginUndoAction() {
@@ -252,7 +704,7 @@ void UndoHistory::BeginUndoAction() {
 	if (undoSequenceDepth == 0) {
 		if (actions[currentAction].at != startAction) {
 			currentAction++;
-			actions[currentAction].Create(startAction);
+			CreateAction(currentAction, startAction);
 			maxAction = currentAction;
 		}
 		actions[currentAction].mayCoalesce = false;
@@ -267,7 +719,7 @@ void UndoHistory::EndUndoAction() {
 	if (0 == undoSequenceDepth) {
 		if (actions[currentAction].at != startAction) {
 			currentAction++;
-			actions[currentAction].Create(startAction);
+			CreateAction(currentAction, startAction);
 			maxAction = currentAction;
 		}
 		actions[currentAction].mayCoalesce = false;
@@ -283,9 +735,25 @@ void UndoHistory::DeleteUndoHistory() {
 		actions[i].Destroy();
 	maxAction = 0;
 	currentAction = 0;
-	actions[currentAction].Create(startAction);
+	CreateAction(currentAction, startAction);
 	savePoint = 0;
 	tentativePoint = -1;
+	FreeScratch();
+}
+
+void UndoHistory::SetUndoLimitBytes(Sci::Position bytes) {
+	limitBytes = bytes;
+	EnforceLimit();
+}
+
+// Bytes of text held for undo and redo.
+Sci::Position UndoHistory::UndoBytes() const {
+	return arena->Mark() - actions[0].mark;
+}
+
+// Bytes allocated by the arena including unused space at the end of chunks.
+Sci::Position UndoHistory::UndoCapacity() const {
+	return arena->Capacity();
 }
 
 void UndoHistory::SetSavePoint() {
@@ -334,7 +802,7 @@ int UndoHistory::StartUndo() {
 }
 
 const Action &UndoHistory::GetUndoStep() const {
-	return actions[currentAction];
+	return ExpandedAction(currentAction);
 }
 
 void UndoHistory::CompletedUndoStep() {
@@ -359,70 +827,126 @@ int UndoHistory::StartRedo() {
 }
 
 const Action &UndoHistory::GetRedoStep() const {
-	return actions[currentAction];
+	return ExpandedAction(currentAction);
 }
 
 void UndoHistory::CompletedRedoStep() {
 	currentAction++;
 }
 
-CellBuffer::CellBuffer() {
+CellBuffer::CellBuffer(bool largeDocument_, bool styleRuns_, bool stylesLazy_) :
+	styleRuns(0), stylesDeferred(stylesLazy_ && !styleRuns_),
+	largeDocument(largeDocument_), perLine(0), mappedText(0), mappedLength(0) {
 	readOnly = false;
 	utf8LineEnds = 0;
 	collectingUndo = true;
+	if (largeDocument)
+		plv = new LineVector<Sci::Position, BlockedPartitioning<Sci::Position> >();
+	else
+		plv = new LineVector<int, Partitioning<int> >();
+	if (styleRuns_)
+		styleRuns = new RunStyles<Sci::Position, char>();
 }
 
 CellBuffer::~CellBuffer() {
+	delete plv;
+	plv = 0;
+	delete styleRuns;
+	styleRuns = 0;
 }
 
-char CellBuffer::CharAt(int position) const {
+char CellBuffer::CharAt(Sci::Position position) const {
+	if (mappedText) {
+		if ((position < 0) || (position >= mappedLength))
+			return 0;
+		return mappedText[position];
+	}
 	return substance.ValueAt(position);
 }
 
-void CellBuffer::GetCharRange(char *buffer, int position, int lengthRetrieve) const {
+void CellBuffer::GetCharRange(char *buffer, Sci::Position position, Sci::Position lengthRetrieve) const {
 	if (lengthRetrieve <= 0)
 		return;
 	if (position < 0)
 		return;
-	if ((position + lengthRetrieve) > substance.Length()) {
-		Platform::DebugPrintf("Bad GetCharRange %d for %d of %d\n", position,
-		                      lengthRetrieve, substance.Length());
+	if ((position + lengthRetrieve) > Length()) {
+		Platform::DebugPrintf("Bad GetCharRange %.0f for %.0f of %.0f\n", static_cast<double>(position),
+		                      static_cast<double>(lengthRetrieve), static_cast<double>(Length()));
+		return;
+	}
+	if (mappedText) {
+		memcpy(buffer, mappedText + position, lengthRetrieve);
 		return;
 	}
 	substance.GetRange(buffer, position, lengthRetrieve);
 }
 
-char CellBuffer::StyleAt(int position) const {
+char CellBuffer::StyleAt(Sci::Position position) const {
+	if (styleRuns) {
+		if ((position < 0) || (position >= styleRuns->Length()))
+			return 0;
+		return styleRuns->ValueAt(position);
+	}
+	if (stylesDeferred)
+		return 0;
 	return style.ValueAt(position);
 }
 
-void CellBuffer::GetStyleRange(unsigned char *buffer, int position, int lengthRetrieve) const {
+void CellBuffer::GetStyleRange(unsigned char *buffer, Sci::Position position, Sci::Position lengthRetrieve) const {
 	if (lengthRetrieve < 0)
 		return;
 	if (position < 0)
 		return;
-	if ((position + lengthRetrieve) > style.Length()) {
-		Platform::DebugPrintf("Bad GetStyleRange %d for %d of %d\n", position,
-		                      lengthRetrieve, style.Length());
+	if ((position + lengthRetrieve) > Length()) {
+		Platform::DebugPrintf("Bad GetStyleRange %.0f for %.0f of %.0f\n", static_cast<double>(position),
+		                      static_cast<double>(lengthRetrieve), static_cast<double>(Length()));
+		return;
+	}
+	if (styleRuns) {
+		// Fill each run in one go so retrieving the styles of a line is quick
+		const Sci::Position end = position + lengthRetrieve;
+		while (position < end) {
+			const Sci::Position endRun = std::min(styleRuns->EndRun(position), end);
+			memset(buffer, static_cast<unsigned char>(styleRuns->ValueAt(position)), endRun - position);
+			buffer += endRun - position;
+			position = endRun;
+		}
+		return;
+	}
+	if (stylesDeferred) {
+		memset(buffer, 0, lengthRetrieve);
 		return;
 	}
 	style.GetRange(reinterpret_cast<char *>(buffer), position, lengthRetrieve);
 }
 
 const char *CellBuffer::BufferPointer() {
+	// Mapped text may not be followed by a NUL so must be copied
+	MaterializeMappedText();
 	return substance.BufferPointer();
 }
 
-const char *CellBuffer::RangePointer(int position, int rangeLength) {
+const char *CellBuffer::RangePointer(Sci::Position position, Sci::Position rangeLength) {
+	if (mappedText)
+		return mappedText + position;
 	return substance.RangePointer(position, rangeLength);
 }
 
-int CellBuffer::GapPosition() const {
+Sci::Position CellBuffer::GapPosition() const {
+	if (mappedText)
+		return mappedLength;
 	return substance.GapPosition();
 }
 
+GapText CellBuffer::TextAroundGap() const {
+	const Sci::Position gap = GapPosition();
+	if (mappedText)
+		return GapText(mappedText, gap, mappedText + gap, Length());
+	return GapText(substance.ElementPointer(0), gap, substance.ElementPointer(gap), Length());
+}
+
 // The char* returned is to an allocation owned by the undo history
-const char *CellBuffer::InsertString(int position, const char *s, int insertLength, bool &startSequence) {
+const char *CellBuffer::InsertString(Sci::Position position, const char *s, Sci::Position insertLength, bool &startSequence) {
 	// InsertString and DeleteChars are the bottleneck though which all changes occur
 	const char *data = s;
 	if (!readOnly) {
@@ -437,7 +961,18 @@ const char *CellBuffer::InsertString(int position, const char *s, int insertLeng
 	return data;
 }
 
-bool CellBuffer::SetStyleAt(int position, char styleValue) {
+bool CellBuffer::SetStyleAt(Sci::Position position, char styleValue) {
+	if (styleRuns) {
+		if ((position < 0) || (position >= styleRuns->Length()) || (styleRuns->ValueAt(position) == styleValue))
+			return false;
+		styleRuns->SetValueAt(position, styleValue);
+		return true;
+	}
+	if (stylesDeferred) {
+		if ((styleValue == 0) || (position < 0) || (position >= Length()))
+			return false;
+		AllocateStyles();
+	}
 	char curVal = style.ValueAt(position);
 	if (curVal != styleValue) {
 		style.SetValueAt(position, styleValue);
@@ -447,10 +982,20 @@ bool CellBuffer::SetStyleAt(int position, char styleValue) {
 	}
 }
 
-bool CellBuffer::SetStyleFor(int position, int lengthStyle, char styleValue) {
+bool CellBuffer::SetStyleFor(Sci::Position position, Sci::Position lengthStyle, char styleValue) {
 	bool changed = false;
 	PLATFORM_ASSERT(lengthStyle == 0 ||
-		(lengthStyle > 0 && lengthStyle + position <= style.Length()));
+		(lengthStyle > 0 && lengthStyle + position <= Length()));
+	if (styleRuns) {
+		if ((lengthStyle <= 0) || (position < 0) || (lengthStyle + position > styleRuns->Length()))
+			return false;
+		return styleRuns->FillRange(position, styleValue, lengthStyle);
+	}
+	if (stylesDeferred) {
+		if ((styleValue == 0) || (lengthStyle <= 0) || (position < 0) || (lengthStyle + position > Length()))
+			return false;
+		AllocateStyles();
+	}
 	while (lengthStyle--) {
 		char curVal = style.ValueAt(position);
 		if (curVal != styleValue) {
@@ -463,7 +1008,7 @@ bool CellBuffer::SetStyleFor(int position, int lengthStyle, char styleValue) {
 }
 
 // The char* returned is to an allocation owned by the undo history
-const char *CellBuffer::DeleteChars(int position, int deleteLength, bool &startSequence) {
+const char *CellBuffer::DeleteChars(Sci::Position position, Sci::Position deleteLength, bool &startSequence) {
 	// InsertString and DeleteChars are the bottleneck though which all changes occur
 	PLATFORM_ASSERT(deleteLength > 0);
 	const char *data = 0;
@@ -480,13 +1025,16 @@ const char *CellBuffer::DeleteChars(int position, int deleteLength, bool &startS
 	return data;
 }
 
-int CellBuffer::Length() const {
+Sci::Position CellBuffer::Length() const {
+	if (mappedText)
+		return mappedLength;
 	return substance.Length();
 }
 
-void CellBuffer::Allocate(int newSize) {
+void CellBuffer::Allocate(Sci::Position newSize) {
 	substance.ReAllocate(newSize);
-	style.ReAllocate(newSize);
+	if (!styleRuns && !stylesDeferred)
+		style.ReAllocate(newSize);
 }
 
 void CellBuffer::SetLineEndTypes(int utf8LineEnds_) {
@@ -496,10 +1044,10 @@ void CellBuffer::SetLineEndTypes(int utf8LineEnds_) {
 	}
 }
 
-bool CellBuffer::ContainsLineEnd(const char *s, int length) const {
+bool CellBuffer::ContainsLineEnd(const char *s, Sci::Position length) const {
 	unsigned char chBeforePrev = 0;
 	unsigned char chPrev = 0;
-	for (int i = 0; i < length; i++) {
+	for (Sci::Position i = 0; i < length; i++) {
 		const unsigned char ch = s[i];
 		if ((ch == '\r') || (ch == '\n')) {
 			return true;
@@ -516,20 +1064,21 @@ bool CellBuffer::ContainsLineEnd(const char *s, int length) const {
 }
 
 void CellBuffer::SetPerLine(PerLine *pl) {
-	lv.SetPerLine(pl);
+	perLine = pl;
+	plv->SetPerLine(pl);
 }
 
-int CellBuffer::Lines() const {
-	return lv.Lines();
+Sci::Line CellBuffer::Lines() const {
+	return plv->Lines();
 }
 
-int CellBuffer::LineStart(int line) const {
+Sci::Position CellBuffer::LineStart(Sci::Line line) const {
 	if (line < 0)
 		return 0;
 	else if (line >= Lines())
 		return Length();
 	else
-		return lv.LineStart(line);
+		return plv->LineStart(line);
 }
 
 bool CellBuffer::IsReadOnly() const {
@@ -537,6 +1086,9 @@ bool CellBuffer::IsReadOnly() const {
 }
 
 void CellBuffer::SetReadOnly(bool set) {
+	if (!set) {
+		MaterializeMappedText();
+	}
 	readOnly = set;
 }
 
@@ -566,15 +1118,76 @@ bool CellBuffer::TentativeActive() const {
 
 // Without undo
 
-void CellBuffer::InsertLine(int line, int position, bool lineStart) {
-	lv.InsertLine(line, position, lineStart);
+void CellBuffer::InsertLine(Sci::Line line, Sci::Position position, bool lineStart) {
+	plv->InsertLine(line, position, lineStart);
 }
 
-void CellBuffer::RemoveLine(int line) {
-	lv.RemoveLine(line);
+void CellBuffer::RemoveLine(Sci::Line line) {
+	plv->RemoveLine(line);
 }
 
-bool CellBuffer::UTF8LineEndOverlaps(int position) const {
+// Switch the line start table to pointer sized positions, copying the current line starts.
+// Per-line data is unaffected as the set of lines does not change.
+void CellBuffer::PromoteToLargeDocument() {
+	ILineVector *plvLarge = new LineVector<Sci::Position, BlockedPartitioning<Sci::Position> >();
+	const Sci::Line lines = plv->Lines();
+	plvLarge->InsertText(0, Length());
+	std::vector<Sci::Position> lineStarts;
+	for (Sci::Line line = 1; line < lines; line++) {
+		lineStarts.push_back(plv->LineStart(line));
+	}
+	plvLarge->InsertLines(1, lineStarts.data(), lineStarts.size(), false);
+	plvLarge->SetPerLine(perLine);
+	delete plv;
+	plv = plvLarge;
+	largeDocument = true;
+}
+
+// Refer to text owned by the caller which must stay valid and unchanged until the
+// document is no longer read-only. The buffer must be empty.
+void CellBuffer::SetMappedText(const char *s, Sci::Position length) {
+	PLATFORM_ASSERT(Length() == 0);
+	if (!largeDocument && (length > INT_MAX)) {
+		PromoteToLargeDocument();
+	}
+	InsertStyleSpace(0, length);
+	mappedText = s;
+	mappedLength = length;
+	readOnly = true;
+	ResetLineEnds();
+}
+
+// Inserted text has style 0 until it is styled
+void CellBuffer::InsertStyleSpace(Sci::Position position, Sci::Position insertLength) {
+	if (styleRuns) {
+		// RunStyles extends the neighbouring run so reset the inserted range
+		styleRuns->InsertSpace(position, insertLength);
+		Sci::Position fillPosition = position;
+		Sci::Position fillLength = insertLength;
+		styleRuns->FillRange(fillPosition, 0, fillLength);
+	} else if (!stylesDeferred) {
+		style.InsertValue(position, insertLength, 0);
+	}
+}
+
+// Called when the first non-zero style is set.
+void CellBuffer::AllocateStyles() {
+	style.InsertValue(0, Length(), 0);
+	stylesDeferred = false;
+}
+
+// Copy mapped text into substance so it can be modified.
+// Substance is not allocated for mapped documents until this point.
+void CellBuffer::MaterializeMappedText() {
+	if (mappedText) {
+		substance.ReAllocate(mappedLength + mappedLength / 8 + 1);
+		substance.InsertFromArray(0, mappedText, 0, mappedLength);
+		mappedText = 0;
+		mappedLength = 0;
+	}
+}
+
+bool CellBuffer::UTF8LineEndOverlaps(Sci::Position position) const {
 	unsigned char bytes[] = {
 		static_cast<unsigned char>(substance.ValueAt(position-2)),
 		static_cast<unsigned char>(substance.ValueAt(position-1)),
@@ -584,47 +1197,86 @@ bool CellBuffer::UTF8LineEndOverlaps(int position) const {
 	return UTF8IsSeparator(bytes) || UTF8IsSeparator(bytes+1) || UTF8IsNEL(bytes+1);
 }
 
-void CellBuffer::ResetLineEnds() {
-	// Reinitialize line data -- too much work to preserve
-	lv.Init();
-
-	int position = 0;
-	int length = Length();
-	int lineInsert = 1;
-	bool atLineStart = true;
-	lv.InsertText(lineInsert-1, length);
-	unsigned char chBeforePrev = 0;
-	unsigned char chPrev = 0;
-	for (int i = 0; i < length; i++) {
-		unsigned char ch = substance.ValueAt(position + i);
+// Add the line starts after the line ends in s which is at position in the document.
+// chBeforePrev and chPrev are the two bytes before s and are updated to the last two bytes of s.
+// Line starts are collected and added to the line vector in blocks.
+// Returns the line following the last line added.
+Sci::Line CellBuffer::InsertLineEnds(const char *s, Sci::Position position, Sci::Position length, Sci::Line lineInsert,
+	bool atLineStart, unsigned char &chBeforePrev, unsigned char &chPrev) {
+	const size_t blockLines = 1024;
+	Sci::Position lineStarts[blockLines];
+	size_t pending = 0;
+	Sci::Position i = NextLineEndCandidate(s, 0, length, utf8LineEnds);
+	while (i < length) {
+		const unsigned char ch = s[i];
+		const unsigned char ch1 = (i >= 1) ? s[i-1] : chPrev;
+		const unsigned char ch2 = (i >= 2) ? s[i-2] : ((i == 1) ? chPrev : chBeforePrev);
+		bool lineEnd = false;
 		if (ch == '\r') {
-			InsertLine(lineInsert, (position + i) + 1, atLineStart);
-			lineInsert++;
+			lineEnd = true;
 		} else if (ch == '\n') {
-			if (chPrev == '\r') {
+			if (ch1 == '\r') {
 				// Patch up what was end of line
-				lv.SetLineStart(lineInsert - 1, (position + i) + 1);
+				if (pending > 0)
+					lineStarts[pending - 1] = (position + i) + 1;
+				else
+					plv->SetLineStart(lineInsert - 1, (position + i) + 1);
 			} else {
-				InsertLine(lineInsert, (position + i) + 1, atLineStart);
-				lineInsert++;
+				lineEnd = true;
 			}
-		} else if (utf8LineEnds) {
-			unsigned char back3[3] = {chBeforePrev, chPrev, ch};
-			if (UTF8IsSeparator(back3) || UTF8IsNEL(back3+1)) {
-				InsertLine(lineInsert, (position + i) + 1, atLineStart);
-				lineInsert++;
+		} else {
+			const unsigned char back3[3] = {ch2, ch1, ch};
+			lineEnd = UTF8IsSeparator(back3) || UTF8IsNEL(back3+1);
+		}
+		if (lineEnd) {
+			lineStarts[pending++] = (position + i) + 1;
+			lineInsert++;
+			if (pending == blockLines) {
+				plv->InsertLines(lineInsert - pending, lineStarts, pending, atLineStart);
+				pending = 0;
 			}
 		}
+		i = NextLineEndCandidate(s, i + 1, length, utf8LineEnds);
+	}
+	if (pending > 0) {
+		plv->InsertLines(lineInsert - pending, lineStarts, pending, atLineStart);
+	}
+	if (length >= 2) {
+		chBeforePrev = s[length-2];
+	} else if (length == 1) {
 		chBeforePrev = chPrev;
-		chPrev = ch;
 	}
+	if (length >= 1) {
+		chPrev = s[length-1];
+	}
+	return lineInsert;
 }
 
-void CellBuffer::BasicInsertString(int position, const char *s, int insertLength) {
+void CellBuffer::ResetLineEnds() {
+	// Reinitialize line data -- too much work to preserve
+	plv->Init();
+
+	Sci::Position position = 0;
+	Sci::Position length = Length();
+	Sci::Line lineInsert = 1;
+	bool atLineStart = true;
+	plv->InsertText(lineInsert-1, length);
+	// Scan contiguous text: either the mapped text or substance with its gap moved out of the way
+	const char *text = RangePointer(0, length);
+	unsigned char chBeforePrev = 0;
+	unsigned char chPrev = 0;
+	InsertLineEnds(text, position, length, lineInsert, atLineStart, chBeforePrev, chPrev);
+}
+
+void CellBuffer::BasicInsertString(Sci::Position position, const char *s, Sci::Position insertLength) {
 	if (insertLength == 0)
 		return;
 	PLATFORM_ASSERT(insertLength > 0);
 
+	if (!largeDocument && (insertLength > INT_MAX - Length())) {
+		PromoteToLargeDocument();
+	}
+
 	unsigned char chAfter = substance.ValueAt(position);
 	bool breakingUTF8LineEnd = false;
 	if (utf8LineEnds && UTF8IsTrailByte(chAfter)) {
@@ -632,12 +1284,12 @@ void CellBuffer::BasicInsertString(int position, const char *s, int insertLength
 	}
 
 	substance.InsertFromArray(position, s, 0, insertLength);
-	style.InsertValue(position, insertLength, 0);
+	InsertStyleSpace(position, insertLength);
 
-	int lineInsert = lv.LineFromPosition(position) + 1;
-	bool atLineStart = lv.LineStart(lineInsert-1) == position;
+	Sci::Line lineInsert = plv->LineFromPosition(position) + 1;
+	bool atLineStart = plv->LineStart(lineInsert-1) == position;
 	// Point all the lines after the insertion point further along in the buffer
-	lv.InsertText(lineInsert-1, insertLength);
+	plv->InsertText(lineInsert-1, insertLength);
 	unsigned char chBeforePrev = substance.ValueAt(position - 2);
 	unsigned char chPrev = substance.ValueAt(position - 1);
 	if (chPrev == '\r' && chAfter == '\n') {
@@ -648,30 +1300,8 @@ void CellBuffer::BasicInsertString(int position, const char *s, int insertLength
 	if (breakingUTF8LineEnd) {
 		RemoveLine(lineInsert);
 	}
-	unsigned char ch = ' ';
-	for (int i = 0; i < insertLength; i++) {
-		ch = s[i];
-		if (ch == '\r') {
-			InsertLine(lineInsert, (position + i) + 1, atLineStart);
-			lineInsert++;
-		} else if (ch == '\n') {
-			if (chPrev == '\r') {
-				// Patch up what was end of line
-				lv.SetLineStart(lineInsert - 1, (position + i) + 1);
-			} else {
-				InsertLine(lineInsert, (position + i) + 1, atLineStart);
-				lineInsert++;
-			}
-		} else if (utf8LineEnds) {
-			unsigned char back3[3] = {chBeforePrev, chPrev, ch};
-			if (UTF8IsSeparator(back3) || UTF8IsNEL(back3+1)) {
-				InsertLine(lineInsert, (position + i) + 1, atLineStart);
-				lineInsert++;
-			}
-		}
-		chBeforePrev = chPrev;
-		chPrev = ch;
-	}
+	const unsigned char ch = s[insertLength - 1];
+	lineInsert = InsertLineEnds(s, position, insertLength, lineInsert, atLineStart, chBeforePrev, chPrev);
 	// Joining two lines where last insertion is cr and following substance starts with lf
 	if (chAfter == '\n') {
 		if (ch == '\r') {
@@ -697,72 +1327,80 @@ void CellBuffer::BasicInsertString(int position, const char *s, int insertLength
 	}
 }
 
-void CellBuffer::BasicDeleteChars(int position, int deleteLength) {
+void CellBuffer::BasicDeleteChars(Sci::Position position, Sci::Position deleteLength) {
 	if (deleteLength == 0)
 		return;
 
 	if ((position == 0) && (deleteLength == substance.Length())) {
 		// If whole buffer is being deleted, faster to reinitialise lines data
 		// than to delete each line.
-		lv.Init();
+		plv->Init();
 	} else {
 		// Have to fix up line positions before doing deletion as looking at text in buffer
 		// to work out which lines have been removed
 
-		int lineRemove = lv.LineFromPosition(position) + 1;
-		lv.InsertText(lineRemove-1, - (deleteLength));
+		Sci::Line lineRemove = plv->LineFromPosition(position) + 1;
+		plv->InsertText(lineRemove-1, - (deleteLength));
 		unsigned char chPrev = substance.ValueAt(position - 1);
 		unsigned char chBefore = chPrev;
 		unsigned char chNext = substance.ValueAt(position);
 		bool ignoreNL = false;
 		if (chPrev == '\r' && chNext == '\n') {
 			// Move back one
-			lv.SetLineStart(lineRemove, position);
+			plv->SetLineStart(lineRemove, position);
 			lineRemove++;
 			ignoreNL = true; 	// First \n is not real deletion
 		}
+		// Each line end deleted removes the line at lineRemove so count them and remove together
+		Sci::Line linesRemoved = 0;
 		if (utf8LineEnds && UTF8IsTrailByte(chNext)) {
 			if (UTF8LineEndOverlaps(position)) {
-				RemoveLine(lineRemove);
+				linesRemoved++;
 			}
 		}
 
 		unsigned char ch = chNext;
-		for (int i = 0; i < deleteLength; i++) {
+		for (Sci::Position i = 0; i < deleteLength; i++) {
 			chNext = substance.ValueAt(position + i + 1);
 			if (ch == '\r') {
 				if (chNext != '\n') {
-					RemoveLine(lineRemove);
+					linesRemoved++;
 				}
 			} else if (ch == '\n') {
 				if (ignoreNL) {
 					ignoreNL = false; 	// Further \n are real deletions
 				} else {
-					RemoveLine(lineRemove);
+					linesRemoved++;
 				}
 			} else if (utf8LineEnds) {
 				if (!UTF8IsAscii(ch)) {
 					unsigned char next3[3] = {ch, chNext,
 						static_cast<unsigned char>(substance.ValueAt(position + i + 2))};
 					if (UTF8IsSeparator(next3) || UTF8IsNEL(next3)) {
-						RemoveLine(lineRemove);
+						linesRemoved++;
 					}
 				}
 			}
 
 			ch = chNext;
 		}
+		if (linesRemoved > 0) {
+			plv->RemoveLines(lineRemove, linesRemoved);
+		}
 		// May have to fix up end if last deletion causes cr to be next to lf
 		// or removes one of a crlf pair
 		char chAfter = substance.ValueAt(position + deleteLength);
 		if (chBefore == '\r' && chAfter == '\n') {
 			// Using lineRemove-1 as cr ended line before start of deletion
 			RemoveLine(lineRemove - 1);
-			lv.SetLineStart(lineRemove - 1, position + 1);
+			plv->SetLineStart(lineRemove - 1, position + 1);
 		}
 	}
 	substance.DeleteRange(position, deleteLength);
-	style.DeleteRange(position, deleteLength);
+	if (styleRuns)
+		styleRuns->DeleteRange(position, deleteLength);
+	else if (!stylesDeferred)
+		style.DeleteRange(position, deleteLength);
 }
 
 bool CellBuffer::SetUndoCollection(bool collectUndo) {
@@ -792,6 +1430,30 @@ void CellBuffer::DeleteUndoHistory() {
 	uh.DeleteUndoHistory();
 }
 
+void CellBuffer::SetUndoLimitBytes(Sci::Position bytes) {
+	uh.SetUndoLimitBytes(bytes);
+}
+
+Sci::Position CellBuffer::GetUndoLimitBytes() const {
+	return uh.GetUndoLimitBytes();
+}
+
+Sci::Position CellBuffer::UndoBytes() const {
+	return uh.UndoBytes();
+}
+
+Sci::Position CellBuffer::UndoCapacity() const {
+	return uh.UndoCapacity();
+}
+
+void CellBuffer::SetUndoCompressionThreshold(Sci::Position bytes) {
+	uh.SetCompressionThreshold(bytes);
+}
+
+Sci::Position CellBuffer::GetUndoCompressionThreshold() const {
+	return uh.GetCompressionThreshold();
+}
+
 bool CellBuffer::CanUndo() const {
 	return uh.CanUndo();
 }
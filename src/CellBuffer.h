@@ -12,79 +12,70 @@
 namespace Scintilla {
 #endif
 
+template <typename DISTANCE, typename STYLE>
+class RunStyles;
+
 // Interface to per-line data that wants to see each line insertion and deletion
 class PerLine {
 public:
 	virtual ~PerLine() {}
 	virtual void Init()=0;
-	virtual void InsertLine(int line)=0;
-	virtual void RemoveLine(int line)=0;
+	virtual void InsertLine(Sci::Line line)=0;
+	virtual void InsertLines(Sci::Line line, Sci::Line lines)=0;
+	virtual void RemoveLine(Sci::Line line)=0;
+	virtual void RemoveLines(Sci::Line line, Sci::Line lines)=0;
 };
 
 /**
  * The line vector contains information about each of the lines in a cell buffer.
+ * Implemented by LineVector<POS, STARTS> so the line start table can use a 32-bit
+ * Partitioning for documents that fit and a BlockedPartitioning, with pointer sized
+ * bases and 32-bit offsets, for larger documents.
  */
-class LineVector {
-
-	Partitioning starts;
-	PerLine *perLine;
-
+class ILineVector {
 public:
-
-	LineVector();
-	~LineVector();
-	void Init();
-	void SetPerLine(PerLine *pl);
-
-	void InsertText(int line, int delta);
-	void InsertLine(int line, int position, bool lineStart);
-	void SetLineStart(int line, int position);
-	void RemoveLine(int line);
-	int Lines() const {
-		return starts.Partitions();
-	}
-	int LineFromPosition(int pos) const;
-	int LineStart(int line) const {
-		return starts.PositionFromPartition(line);
-	}
-
-	int MarkValue(int line);
-	int AddMark(int line, int marker);
-	void MergeMarkers(int pos);
-	void DeleteMark(int line, int markerNum, bool all);
-	void DeleteMarkFromHandle(int markerHandle);
-	int LineFromHandle(int markerHandle);
-
-	void ClearLevels();
-	int SetLevel(int line, int level);
-	int GetLevel(int line);
-
-	int SetLineState(int line, int state);
-	int GetLineState(int line);
-	int GetMaxLineState();
-
+	virtual ~ILineVector() {}
+	virtual void Init() = 0;
+	virtual void SetPerLine(PerLine *pl) = 0;
+	virtual void InsertText(Sci::Line line, Sci::Position delta) = 0;
+	virtual void InsertLine(Sci::Line line, Sci::Position position, bool lineStart) = 0;
+	virtual void InsertLines(Sci::Line line, const Sci::Position *positions, size_t lines, bool lineStart) = 0;
+	virtual void SetLineStart(Sci::Line line, Sci::Position position) = 0;
+	virtual void RemoveLine(Sci::Line line) = 0;
+	virtual void RemoveLines(Sci::Line line, Sci::Line lines) = 0;
+	virtual Sci::Line Lines() const = 0;
+	virtual Sci::Line LineFromPosition(Sci::Position pos) const = 0;
+	virtual Sci::Position LineStart(Sci::Line line) const = 0;
 };
 
 enum actionType { insertAction, removeAction, startAction, containerAction };
 
 /**
  * Actions are used to store all the information required to perform one undo/redo step.
+ * The text of an action is owned by the UndoArena of the history holding the action.
  */
 class Action {
 public:
 	actionType at;
-	int position;
+	Sci::Position position;
 	char *data;
-	int lenData;
+	Sci::Position lenData;
 	bool mayCoalesce;
+	/// Arena position when the action was created: its text and that of later actions follow this.
+	Sci::Position mark;
+	/// When not 0, data holds this many bytes of compressed text that expand to lenData bytes.
+	Sci::Position lenCompressed;
 
 	Action();
 	~Action();
-	void Create(actionType at_, int position_=0, const char *data_=0, int lenData_=0, bool mayCoalesce_=true);
+	void Create(actionType at_, Sci::Position position_=0, char *data_=0, Sci::Position lenData_=0, bool mayCoalesce_=true);
 	void Destroy();
 	void Grab(Action *source);
+	Sci::Position StoredLength() const { return lenCompressed ? lenCompressed : lenData; }
 };
 
+class UndoArena;
+
 /**
  *
  */
@@ -96,8 +87,29 @@ class UndoHistory {
 	int undoSequenceDepth;
 	int savePoint;
 	int tentativePoint;
+	/// Action text is appended to the arena so there are few allocations
+	UndoArena *arena;
+	/// When not 0, the oldest user operations are dropped to keep the arena below this size
+	Sci::Position limitBytes;
+	/// When not 0, the text of actions at least this long is compressed
+	Sci::Position compressionThreshold;
+	/// Reused space that text is compressed into before it is copied to the arena
+	char *scratch;
+	Sci::Position lenScratch;
+	/// Expanded text of the compressed action actionExpanded. This is only kept until another
+	/// action is expanded or an action with text is created.
+	mutable char *expansion;
+	mutable int actionExpanded;
+	mutable Action actionExpansion;
 
 	void EnsureUndoRoom();
+	void CreateAction(int act, actionType at, Sci::Position position=0, const char *data=0, Sci::Position lengthData=0, bool mayCoalesce=true);
+	void DropOldActions(int actionsDropped);
+	void EnforceLimit();
+	void FreeExpansion() const;
+	void FreeScratch();
+	char *AllocateExpansion(int act, Sci::Position length) const;
+	const Action &ExpandedAction(int act) const;
 
 	// Private so UndoHistory objects can not be copied
 	UndoHistory(const UndoHistory &);
@@ -106,12 +118,18 @@ public:
 	UndoHistory();
 	~UndoHistory();
 
-	const char *AppendAction(actionType at, int position, const char *data, int length, bool &startSequence, bool mayCoalesce=true);
+	const char *AppendAction(actionType at, Sci::Position position, const char *data, Sci::Position lengthData, bool &startSequence, bool mayCoalesce=true);
 
 	void BeginUndoAction();
 	void EndUndoAction();
 	void DropUndoSequence();
 	void DeleteUndoHistory();
+	void SetUndoLimitBytes(Sci::Position bytes);
+	Sci::Position GetUndoLimitBytes() const { return limitBytes; }
+	Sci::Position UndoBytes() const;
+	Sci::Position UndoCapacity() const;
+	void SetCompressionThreshold(Sci::Position bytes) { compressionThreshold = bytes; }
+	Sci::Position GetCompressionThreshold() const { return compressionThreshold; }
 
 	/// The save point is a marker in the undo stack where the container has stated that
 	/// the buffer was saved. Undo and redo can move over the save point.
@@ -136,6 +154,39 @@ public:
 	void CompletedRedoStep();
 };
 
+/**
+ * Reads bytes from the two sides of the gap without moving it.
+ * Positions outside the text read as 0 like CellBuffer::CharAt.
+ * Only valid until the buffer is next modified.
+ */
+class GapText {
+	const char *before;
+	Sci::Position gap;
+	const char *after;
+	Sci::Position length;
+public:
+	GapText(const char *before_, Sci::Position gap_, const char *after_, Sci::Position length_) :
+		before(before_), gap(gap_), after(after_), length(length_) {
+	}
+	const char *Before() const {
+		return before;
+	}
+	const char *After() const {
+		return after;
+	}
+	Sci::Position Gap() const {
+		return gap;
+	}
+	Sci::Position Length() const {
+		return length;
+	}
+	char CharAt(Sci::Position position) const {
+		if (position < gap)
+			return (position >= 0) ? before[position] : 0;
+		return (position < length) ? after[position - gap] : 0;
+	}
+};
+
 /**
  * Holder for an expandable array of characters that supports undo and line markers.
  * Based on article "Data Structures in a Bit-Mapped Text Editor"
@@ -145,53 +196,83 @@ class CellBuffer {
 private:
 	SplitVector<char> substance;
 	SplitVector<char> style;
+	/// When not null, styles are held as runs here and style is unused. Runs take much
+	/// less memory than a byte per character when styles change rarely, as in plain
+	/// text or logs.
+	RunStyles<Sci::Position, char> *styleRuns;
+	/// While no style has been set to a non-zero value, style is left empty and all
+	/// styles are 0. This avoids a byte per character for documents that are never styled.
+	bool stylesDeferred;
 	bool readOnly;
 	int utf8LineEnds;
 
 	bool collectingUndo;
 	UndoHistory uh;
 
-	LineVector lv;
-
-	bool UTF8LineEndOverlaps(int position) const;
+	/// Line starts are held in 32-bit form until the document grows past 2 GB.
+	bool largeDocument;
+	PerLine *perLine;
+	ILineVector *plv;
+
+	/// A mapped document refers to read-only text owned by the application, often a
+	/// memory mapped file, instead of holding it in substance. The text is copied into
+	/// substance when the document stops being read-only.
+	const char *mappedText;
+	Sci::Position mappedLength;
+
+	// Private so CellBuffer objects can not be copied
+	CellBuffer(const CellBuffer &);
+
+	void PromoteToLargeDocument();
+	void MaterializeMappedText();
+	void InsertStyleSpace(Sci::Position position, Sci::Position insertLength);
+	void AllocateStyles();
+	bool UTF8LineEndOverlaps(Sci::Position position) const;
+	Sci::Line InsertLineEnds(const char *s, Sci::Position position, Sci::Position length, Sci::Line lineInsert,
+		bool atLineStart, unsigned char &chBeforePrev, unsigned char &chPrev);
 	void ResetLineEnds();
 	/// Actions without undo
-	void BasicInsertString(int position, const char *s, int insertLength);
-	void BasicDeleteChars(int position, int deleteLength);
+	void BasicInsertString(Sci::Position position, const char *s, Sci::Position insertLength);
+	void BasicDeleteChars(Sci::Position position, Sci::Position deleteLength);
 
 public:
 
-	CellBuffer();
+	explicit CellBuffer(bool largeDocument_=false, bool styleRuns_=false, bool stylesLazy_=false);
 	~CellBuffer();
 
 	/// Retrieving positions outside the range of the buffer works and returns 0
-	char CharAt(int position) const;
-	void GetCharRange(char *buffer, int position, int lengthRetrieve) const;
-	char StyleAt(int position) const;
-	void GetStyleRange(unsigned char *buffer, int position, int lengthRetrieve) const;
+	char CharAt(Sci::Position position) const;
+	void GetCharRange(char *buffer, Sci::Position position, Sci::Position lengthRetrieve) const;
+	char StyleAt(Sci::Position position) const;
+	void GetStyleRange(unsigned char *buffer, Sci::Position position, Sci::Position lengthRetrieve) const;
 	const char *BufferPointer();
-	const char *RangePointer(int position, int rangeLength);
-	int GapPosition() const;
-
-	int Length() const;
-	void Allocate(int newSize);
+	const char *RangePointer(Sci::Position position, Sci::Position rangeLength);
+	Sci::Position GapPosition() const;
+	GapText TextAroundGap() const;
+
+	Sci::Position Length() const;
+	void Allocate(Sci::Position newSize);
+	bool IsLarge() const { return largeDocument; }
+	void SetMappedText(const char *s, Sci::Position length);
+	bool IsMapped() const { return mappedText != 0; }
+	bool StylesAllocated() const { return !stylesDeferred; }
 	int GetLineEndTypes() const { return utf8LineEnds; }
 	void SetLineEndTypes(int utf8LineEnds_);
-	bool ContainsLineEnd(const char *s, int length) const;
+	bool ContainsLineEnd(const char *s, Sci::Position length) const;
 	void SetPerLine(PerLine *pl);
-	int Lines() const;
-	int LineStart(int line) const;
-	int LineFromPosition(int pos) const { return lv.LineFromPosition(pos); }
-	void InsertLine(int line, int position, bool lineStart);
-	void RemoveLine(int line);
-	const char *InsertString(int position, const char *s, int insertLength, bool &startSequence);
+	Sci::Line Lines() const;
+	Sci::Position LineStart(Sci::Line line) const;
+	Sci::Line LineFromPosition(Sci::Position pos) const { return plv->LineFromPosition(pos); }
+	void InsertLine(Sci::Line line, Sci::Position position, bool lineStart);
+	void RemoveLine(Sci::Line line);
+	const char *InsertString(Sci::Position position, const char *s, Sci::Position insertLength, bool &startSequence);
 
 	/// Setting styles for positions outside the range of the buffer is safe and has no effect.
 	/// @return true if the style of a character is changed.
-	bool SetStyleAt(int position, char styleValue);
-	bool SetStyleFor(int position, int length, char styleValue);
+	bool SetStyleAt(Sci::Position position, char styleValue);
+	bool SetStyleFor(Sci::Position position, Sci::Position lengthStyle, char styleValue);
 
-	const char *DeleteChars(int position, int deleteLength, bool &startSequence);
+	const char *DeleteChars(Sci::Position position, Sci::Position deleteLength, bool &startSequence);
 
 	bool IsReadOnly() const;
 	void SetReadOnly(bool set);
@@ -212,6 +293,12 @@ public:
 	void EndUndoAction();
 	void AddUndoAction(int token, bool mayCoalesce);
 	void DeleteUndoHistory();
+	void SetUndoLimitBytes(Sci::Position bytes);
+	Sci::Position GetUndoLimitBytes() const;
+	Sci::Position UndoBytes() const;
+	Sci::Position UndoCapacity() const;
+	void SetUndoCompressionThreshold(Sci::Position bytes);
+	Sci::Position GetUndoCompressionThreshold() const;
 
 	/// To perform an undo, StartUndo is called to retrieve the number of steps, then UndoStep is
 	/// called that many times. Similarly for redo.
@@ -16,7 +16,7 @@
 using namespace Scintilla;
 #endif
 
-CharClassify::CharClassify() {
+CharClassify::CharClassify() : version(0) {
 	SetDefaultCharClasses(true);
 }
 
@@ -32,6 +32,7 @@ void CharClassify::SetDefaultCharClasses(bool includeWordClass) {
 		else
 			charClass[ch] = ccPunctuation;
 	}
+	version++;
 }
 
 void CharClassify::SetCharClasses(const unsigned char *chars, cc newCharClass) {
@@ -42,6 +43,7 @@ void CharClassify::SetCharClasses(const unsigned char *chars, cc newCharClass) {
 			chars++;
 		}
 	}
+	version++;
 }
 
 int CharClassify::GetCharsOfClass(cc characterClass, unsigned char *buffer) const {
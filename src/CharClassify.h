@@ -22,10 +22,12 @@ public:
 	int GetCharsOfClass(cc charClass, unsigned char *buffer) const;
 	cc GetClass(unsigned char ch) const { return static_cast<cc>(charClass[ch]);}
 	bool IsWord(unsigned char ch) const { return static_cast<cc>(charClass[ch]) == ccWord;}
+	int Version() const { return version; }
 
 private:
 	enum { maxChar=256 };
 	unsigned char charClass[maxChar];    // not type cc to save space
+	int version;	// Incremented on each change so users can discard derived data
 };
 
 #ifdef SCI_NAMESPACE
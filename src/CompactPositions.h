@@ -0,0 +1,54 @@
+// Scintilla source code edit control
+/** @file CompactPositions.h
+ ** Store the positions of a line layout as 16-bit character widths.
+ **/
+// Copyright 2017 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef COMPACTPOSITIONS_H
+#define COMPACTPOSITIONS_H
+
+#ifdef SCI_NAMESPACE
+namespace Scintilla {
+#endif
+
+// Compact positions are character widths in 1/64ths of a pixel.
+const int compactScale = 64;
+
+/**
+ * Store the width of each character from positions[1..length] in compact[1..length].
+ * Widths are rounded to the nearest 1/64 pixel from the start of the line so rounding
+ * does not accumulate along the line.
+ * Return false when a character is 1024 or more pixels wide, has a negative width, or
+ * the line is too wide, in which case compact is not completely written.
+ */
+inline bool CompactPositionsStore(const XYPOSITION *positions, int length, unsigned short *compact) {
+	if (positions[length] >= 0x1000000)
+		return false;
+	int fixedPrevious = 0;
+	for (int i = 1; i <= length; i++) {
+		const int fixed = static_cast<int>(floor(positions[i] * compactScale + 0.5));
+		const int width = fixed - fixedPrevious;
+		if ((width < 0) || (width > 0xFFFF))
+			return false;
+		compact[i] = static_cast<unsigned short>(width);
+		fixedPrevious = fixed;
+	}
+	return true;
+}
+
+// Recreate positions[0..length] from the widths stored by CompactPositionsStore.
+inline void CompactPositionsLoad(const unsigned short *compact, int length, XYPOSITION *positions) {
+	positions[0] = 0;
+	int fixed = 0;
+	for (int i = 1; i <= length; i++) {
+		fixed += compact[i];
+		positions[i] = static_cast<XYPOSITION>(fixed) / compactScale;
+	}
+}
+
+#ifdef SCI_NAMESPACE
+}
+#endif
+
+#endif
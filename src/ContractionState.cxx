@@ -32,10 +32,10 @@ ContractionState::~ContractionState() {
 
 void ContractionState::EnsureData() {
 	if (OneToOne()) {
-		visible = new RunStyles();
-		expanded = new RunStyles();
-		heights = new RunStyles();
-		displayLines = new Partitioning(4);
+		visible = new RunStyles<int, char>();
+		expanded = new RunStyles<int, char>();
+		heights = new RunStyles<int, int>();
+		displayLines = new Partitioning<int>(4);
 		InsertLines(0, linesInDocument);
 	}
 }
@@ -16,10 +16,10 @@ namespace Scintilla {
  */
 class ContractionState {
 	// These contain 1 element for every document line.
-	RunStyles *visible;
-	RunStyles *expanded;
-	RunStyles *heights;
-	Partitioning *displayLines;
+	RunStyles<int, char> *visible;
+	RunStyles<int, char> *expanded;
+	RunStyles<int, int> *heights;
+	Partitioning<int> *displayLines;
 	int linesInDocument;
 
 	void EnsureData();
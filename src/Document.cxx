@@ -14,12 +14,19 @@
 #include <stdexcept>
 #include <string>
 #include <vector>
+#include <map>
 #include <algorithm>
 
 #ifndef NO_CXX11_REGEX
 #include <regex>
 #endif
 
+#ifndef NO_CXX11_THREADS
+#include <functional>
+#include <atomic>
+#include <thread>
+#endif
+
 #include "Platform.h"
 
 #include "ILexer.h"
@@ -38,6 +45,7 @@
 #include "CaseFolder.h"
 #include "Document.h"
 #include "RESearch.h"
+#include "MultilineRegex.h"
 #include "UniConversion.h"
 #include "UnicodeFromUTF8.h"
 
@@ -45,22 +53,22 @@
 using namespace Scintilla;
 #endif
 
-void LexInterface::Colourise(int start, int end) {
+void LexInterface::Colourise(Sci::Position start, Sci::Position end) {
 	if (pdoc && instance && !performingStyle) {
 		// Protect against reentrance, which may occur, for example, when
 		// fold points are discovered while performing styling and the folding
 		// code looks for child lines which may trigger styling.
 		performingStyle = true;
 
-		int lengthDoc = pdoc->Length();
+		Sci::Position lengthDoc = pdoc->Length();
 		if (end == -1)
 			end = lengthDoc;
-		int len = end - start;
+		Sci::Position len = end - start;
 
 		PLATFORM_ASSERT(len >= 0);
 		PLATFORM_ASSERT(start + len <= lengthDoc);
 
-		int styleStart = 0;
+		Sci::Position styleStart = 0;
 		if (start > 0)
 			styleStart = pdoc->StyleAt(start - 1);
 
@@ -84,7 +92,11 @@ int LexInterface::LineEndTypesSupported() {
 	return 0;
 }
 
-Document::Document() {
+Document::Document(int options_) :
+	options(options_),
+	cb((options_ & SC_DOCUMENTOPTION_TEXT_LARGE) != 0,
+		(options_ & SC_DOCUMENTOPTION_STYLES_RUNS) != 0,
+		(options_ & (SC_DOCUMENTOPTION_STYLES_LAZY | SC_DOCUMENTOPTION_TEXT_MAPPED)) != 0) {
 	refCount = 0;
 	pcf = NULL;
 #ifdef _WIN32
@@ -95,7 +107,6 @@ Document::Document() {
 	dbcsCodePage = 0;
 	lineEndBitSet = SC_LINE_END_TYPE_DEFAULT;
 	endStyled = 0;
-	styleClock = 0;
 	enteredModification = 0;
 	enteredStyling = 0;
 	enteredReadOnlyCount = 0;
@@ -181,20 +192,34 @@ bool Document::SetLineEndTypesAllowed(int lineEndBitSet_) {
 	}
 }
 
-void Document::InsertLine(int line) {
+void Document::InsertLine(Sci::Line line) {
 	for (int j=0; j<ldSize; j++) {
 		if (perLineData[j])
 			perLineData[j]->InsertLine(line);
 	}
 }
 
-void Document::RemoveLine(int line) {
+void Document::InsertLines(Sci::Line line, Sci::Line lines) {
+	for (int j=0; j<ldSize; j++) {
+		if (perLineData[j])
+			perLineData[j]->InsertLines(line, lines);
+	}
+}
+
+void Document::RemoveLine(Sci::Line line) {
 	for (int j=0; j<ldSize; j++) {
 		if (perLineData[j])
 			perLineData[j]->RemoveLine(line);
 	}
 }
 
+void Document::RemoveLines(Sci::Line line, Sci::Line lines) {
+	for (int j=0; j<ldSize; j++) {
+		if (perLineData[j])
+			perLineData[j]->RemoveLines(line, lines);
+	}
+}
+
 // Increase reference count and return its previous value.
 int Document::AddRef() {
 	return refCount++;
@@ -226,7 +251,7 @@ void Document::TentativeUndo() {
 			int steps = cb.TentativeSteps();
 			//Platform::DebugPrintf("Steps=%d\n", steps);
 			for (int step = 0; step < steps; step++) {
-				const int prevLinesTotal = LinesTotal();
+				const Sci::Line prevLinesTotal = LinesTotal();
 				const Action &action = cb.GetUndoStep();
 				if (action.at == removeAction) {
 					NotifyModified(DocModification(
@@ -253,7 +278,7 @@ void Document::TentativeUndo() {
 				}
 				if (steps > 1)
 					modFlags |= SC_MULTISTEPUNDOREDO;
-				const int linesAdded = LinesTotal() - prevLinesTotal;
+				const Sci::Line linesAdded = LinesTotal() - prevLinesTotal;
 				if (linesAdded != 0)
 					multiLine = true;
 				if (step == steps - 1) {
@@ -275,15 +300,15 @@ void Document::TentativeUndo() {
 	}
 }
 
-int Document::GetMark(int line) {
+int Document::GetMark(Sci::Line line) {
 	return static_cast<LineMarkers *>(perLineData[ldMarkers])->MarkValue(line);
 }
 
-int Document::MarkerNext(int lineStart, int mask) const {
+Sci::Line Document::MarkerNext(Sci::Line lineStart, int mask) const {
 	return static_cast<LineMarkers *>(perLineData[ldMarkers])->MarkerNext(lineStart, mask);
 }
 
-int Document::AddMark(int line, int markerNum) {
+int Document::AddMark(Sci::Line line, int markerNum) {
 	if (line >= 0 && line <= LinesTotal()) {
 		int prev = static_cast<LineMarkers *>(perLineData[ldMarkers])->
 			AddMark(line, markerNum, LinesTotal());
@@ -295,7 +320,7 @@ int Document::AddMark(int line, int markerNum) {
 	}
 }
 
-void Document::AddMarkSet(int line, int valueSet) {
+void Document::AddMarkSet(Sci::Line line, int valueSet) {
 	if (line < 0 || line > LinesTotal()) {
 		return;
 	}
@@ -308,7 +333,7 @@ void Document::AddMarkSet(int line, int valueSet) {
 	NotifyModified(mh);
 }
 
-void Document::DeleteMark(int line, int markerNum) {
+void Document::DeleteMark(Sci::Line line, int markerNum) {
 	static_cast<LineMarkers *>(perLineData[ldMarkers])->DeleteMark(line, markerNum, false);
 	DocModification mh(SC_MOD_CHANGEMARKER, LineStart(line), 0, 0, 0, line);
 	NotifyModified(mh);
@@ -323,7 +348,7 @@ void Document::DeleteMarkFromHandle(int markerHandle) {
 
 void Document::DeleteAllMarks(int markerNum) {
 	bool someChanges = false;
-	for (int line = 0; line < LinesTotal(); line++) {
+	for (Sci::Line line = 0; line < LinesTotal(); line++) {
 		if (static_cast<LineMarkers *>(perLineData[ldMarkers])->DeleteMark(line, markerNum, true))
 			someChanges = true;
 	}
@@ -334,7 +359,7 @@ void Document::DeleteAllMarks(int markerNum) {
 	}
 }
 
-int Document::LineFromHandle(int markerHandle) {
+Sci::Line Document::LineFromHandle(int markerHandle) {
 	return static_cast<LineMarkers *>(perLineData[ldMarkers])->LineFromHandle(markerHandle);
 }
 
@@ -342,7 +367,7 @@ Sci_Position SCI_METHOD Document::LineStart(Sci_Position line) const {
 	return cb.LineStart(line);
 }
 
-bool Document::IsLineStartPosition(int position) const {
+bool Document::IsLineStartPosition(Sci::Position position) const {
 	return LineStart(LineFromPosition(position)) == position;
 }
 
@@ -350,7 +375,7 @@ Sci_Position SCI_METHOD Document::LineEnd(Sci_Position line) const {
 	if (line >= LinesTotal() - 1) {
 		return LineStart(line + 1);
 	} else {
-		int position = LineStart(line + 1);
+		Sci::Position position = LineStart(line + 1);
 		if (SC_CP_UTF8 == dbcsCodePage) {
 			unsigned char bytes[] = {
 				static_cast<unsigned char>(cb.CharAt(position-3)),
@@ -384,23 +409,23 @@ Sci_Position SCI_METHOD Document::LineFromPosition(Sci_Position pos) const {
 	return cb.LineFromPosition(pos);
 }
 
-int Document::LineEndPosition(int position) const {
+Sci::Position Document::LineEndPosition(Sci::Position position) const {
 	return LineEnd(LineFromPosition(position));
 }
 
-bool Document::IsLineEndPosition(int position) const {
+bool Document::IsLineEndPosition(Sci::Position position) const {
 	return LineEnd(LineFromPosition(position)) == position;
 }
 
-bool Document::IsPositionInLineEnd(int position) const {
+bool Document::IsPositionInLineEnd(Sci::Position position) const {
 	return position >= LineEnd(LineFromPosition(position));
 }
 
-int Document::VCHomePosition(int position) const {
-	int line = LineFromPosition(position);
-	int startPosition = LineStart(line);
-	int endLine = LineEnd(line);
-	int startText = startPosition;
+Sci::Position Document::VCHomePosition(Sci::Position position) const {
+	Sci::Line line = LineFromPosition(position);
+	Sci::Position startPosition = LineStart(line);
+	Sci::Position endLine = LineEnd(line);
+	Sci::Position startText = startPosition;
 	while (startText < endLine && (cb.CharAt(startText) == ' ' || cb.CharAt(startText) == '\t'))
 		startText++;
 	if (position == startText)
@@ -436,12 +461,12 @@ static bool IsSubordinate(int levelStart, int levelTry) {
 		return LevelNumber(levelStart) < LevelNumber(levelTry);
 }
 
-int Document::GetLastChild(int lineParent, int level, int lastLine) {
+Sci::Line Document::GetLastChild(Sci::Line lineParent, int level, Sci::Line lastLine) {
 	if (level == -1)
 		level = LevelNumber(GetLevel(lineParent));
-	int maxLine = LinesTotal();
-	int lookLastLine = (lastLine != -1) ? Platform::Minimum(LinesTotal() - 1, lastLine) : -1;
-	int lineMaxSubord = lineParent;
+	Sci::Line maxLine = LinesTotal();
+	Sci::Line lookLastLine = (lastLine != -1) ? Platform::Minimum(LinesTotal() - 1, lastLine) : -1;
+	Sci::Line lineMaxSubord = lineParent;
 	while (lineMaxSubord < maxLine - 1) {
 		EnsureStyledTo(LineStart(lineMaxSubord + 2));
 		if (!IsSubordinate(level, GetLevel(lineMaxSubord + 1)))
@@ -461,9 +486,9 @@ int Document::GetLastChild(int lineParent, int level, int lastLine) {
 	return lineMaxSubord;
 }
 
-int Document::GetFoldParent(int line) const {
+Sci::Line Document::GetFoldParent(Sci::Line line) const {
 	int level = LevelNumber(GetLevel(line));
-	int lineLook = line - 1;
+	Sci::Line lineLook = line - 1;
 	while ((lineLook > 0) && (
 	            (!(GetLevel(lineLook) & SC_FOLDLEVELHEADERFLAG)) ||
 	            (LevelNumber(GetLevel(lineLook)) >= level))
@@ -478,11 +503,11 @@ int Document::GetFoldParent(int line) const {
 	}
 }
 
-void Document::GetHighlightDelimiters(HighlightDelimiter &highlightDelimiter, int line, int lastLine) {
+void Document::GetHighlightDelimiters(HighlightDelimiter &highlightDelimiter, Sci::Line line, Sci::Line lastLine) {
 	int level = GetLevel(line);
-	int lookLastLine = Platform::Maximum(line, lastLine) + 1;
+	Sci::Line lookLastLine = Platform::Maximum(line, lastLine) + 1;
 
-	int lookLine = line;
+	Sci::Line lookLine = line;
 	int lookLineLevel = level;
 	int lookLineLevelNum = LevelNumber(lookLineLevel);
 	while ((lookLine > 0) && ((lookLineLevel & SC_FOLDLEVELWHITEFLAG) ||
@@ -491,14 +516,14 @@ void Document::GetHighlightDelimiters(HighlightDelimiter &highlightDelimiter, in
 		lookLineLevelNum = LevelNumber(lookLineLevel);
 	}
 
-	int beginFoldBlock = (lookLineLevel & SC_FOLDLEVELHEADERFLAG) ? lookLine : GetFoldParent(lookLine);
+	Sci::Line beginFoldBlock = (lookLineLevel & SC_FOLDLEVELHEADERFLAG) ? lookLine : GetFoldParent(lookLine);
 	if (beginFoldBlock == -1) {
 		highlightDelimiter.Clear();
 		return;
 	}
 
-	int endFoldBlock = GetLastChild(beginFoldBlock, -1, lookLastLine);
-	int firstChangeableLineBefore = -1;
+	Sci::Line endFoldBlock = GetLastChild(beginFoldBlock, -1, lookLastLine);
+	Sci::Line firstChangeableLineBefore = -1;
 	if (endFoldBlock < line) {
 		lookLine = beginFoldBlock - 1;
 		lookLineLevel = GetLevel(lookLine);
@@ -530,7 +555,7 @@ void Document::GetHighlightDelimiters(HighlightDelimiter &highlightDelimiter, in
 	if (firstChangeableLineBefore == -1)
 		firstChangeableLineBefore = beginFoldBlock - 1;
 
-	int firstChangeableLineAfter = -1;
+	Sci::Line firstChangeableLineAfter = -1;
 	for (lookLine = line + 1, lookLineLevel = GetLevel(lookLine), lookLineLevelNum = LevelNumber(lookLineLevel);
 		lookLine <= endFoldBlock;
 		lookLineLevel = GetLevel(++lookLine), lookLineLevelNum = LevelNumber(lookLineLevel)) {
@@ -548,11 +573,11 @@ void Document::GetHighlightDelimiters(HighlightDelimiter &highlightDelimiter, in
 	highlightDelimiter.firstChangeableLineAfter = firstChangeableLineAfter;
 }
 
-int Document::ClampPositionIntoDocument(int pos) const {
+Sci::Position Document::ClampPositionIntoDocument(Sci::Position pos) const {
 	return Platform::Clamp(pos, 0, Length());
 }
 
-bool Document::IsCrLf(int pos) const {
+bool Document::IsCrLf(Sci::Position pos) const {
 	if (pos < 0)
 		return false;
 	if (pos >= (Length() - 1))
@@ -560,7 +585,7 @@ bool Document::IsCrLf(int pos) const {
 	return (cb.CharAt(pos) == '\r') && (cb.CharAt(pos + 1) == '\n');
 }
 
-int Document::LenChar(int pos) {
+int Document::LenChar(Sci::Position pos) {
 	if (pos < 0) {
 		return 1;
 	} else if (IsCrLf(pos)) {
@@ -568,7 +593,7 @@ int Document::LenChar(int pos) {
 	} else if (SC_CP_UTF8 == dbcsCodePage) {
 		const unsigned char leadByte = static_cast<unsigned char>(cb.CharAt(pos));
 		const int widthCharBytes = UTF8BytesOfLead[leadByte];
-		int lengthDoc = Length();
+		Sci::Position lengthDoc = Length();
 		if ((pos + widthCharBytes) > lengthDoc)
 			return lengthDoc - pos;
 		else
@@ -580,8 +605,8 @@ int Document::LenChar(int pos) {
 	}
 }
 
-bool Document::InGoodUTF8(int pos, int &start, int &end) const {
-	int trail = pos;
+bool Document::InGoodUTF8(Sci::Position pos, Sci::Position &start, Sci::Position &end) const {
+	Sci::Position trail = pos;
 	while ((trail>0) && (pos-trail < UTF8MaxBytes) && UTF8IsTrailByte(static_cast<unsigned char>(cb.CharAt(trail-1))))
 		trail--;
 	start = (trail > 0) ? trail-1 : trail;
@@ -592,7 +617,7 @@ bool Document::InGoodUTF8(int pos, int &start, int &end) const {
 		return false;
 	} else {
 		int trailBytes = widthCharBytes - 1;
-		int len = pos - start;
+		Sci::Position len = pos - start;
 		if (len > trailBytes)
 			// pos too far from lead
 			return false;
@@ -612,7 +637,7 @@ bool Document::InGoodUTF8(int pos, int &start, int &end) const {
 // When lines are terminated with \r\n pairs which should be treated as one character.
 // When displaying DBCS text such as Japanese.
 // If moving, move the position in the indicated direction.
-int Document::MovePositionOutsideChar(int pos, int moveDir, bool checkLineEnd) const {
+Sci::Position Document::MovePositionOutsideChar(Sci::Position pos, int moveDir, bool checkLineEnd) const {
 	//Platform::DebugPrintf("NoCRLF %d %d\n", pos, moveDir);
 	// If out of range, just return minimum/maximum value.
 	if (pos <= 0)
@@ -633,8 +658,8 @@ int Document::MovePositionOutsideChar(int pos, int moveDir, bool checkLineEnd) c
 			unsigned char ch = static_cast<unsigned char>(cb.CharAt(pos));
 			// If ch is not a trail byte then pos is valid intercharacter position
 			if (UTF8IsTrailByte(ch)) {
-				int startUTF = pos;
-				int endUTF = pos;
+				Sci::Position startUTF = pos;
+				Sci::Position endUTF = pos;
 				if (InGoodUTF8(pos, startUTF, endUTF)) {
 					// ch is a trail byte within a UTF-8 character
 					if (moveDir > 0)
@@ -647,12 +672,12 @@ int Document::MovePositionOutsideChar(int pos, int moveDir, bool checkLineEnd) c
 		} else {
 			// Anchor DBCS calculations at start of line because start of line can
 			// not be a DBCS trail byte.
-			int posStartLine = LineStart(LineFromPosition(pos));
+			Sci::Position posStartLine = LineStart(LineFromPosition(pos));
 			if (pos == posStartLine)
 				return pos;
 
 			// Step back until a non-lead-byte is found.
-			int posCheck = pos;
+			Sci::Position posCheck = pos;
 			while ((posCheck > posStartLine) && IsDBCSLeadByte(cb.CharAt(posCheck-1)))
 				posCheck--;
 
@@ -679,9 +704,9 @@ int Document::MovePositionOutsideChar(int pos, int moveDir, bool checkLineEnd) c
 // NextPosition moves between valid positions - it can not handle a position in the middle of a
 // multi-byte character. It is used to iterate through text more efficiently than MovePositionOutsideChar.
 // A \r\n pair is treated as two characters.
-int Document::NextPosition(int pos, int moveDir) const {
+Sci::Position Document::NextPosition(Sci::Position pos, int moveDir) const {
 	// If out of range, just return minimum/maximum value.
-	int increment = (moveDir > 0) ? 1 : -1;
+	Sci::Position increment = (moveDir > 0) ? 1 : -1;
 	if (pos + increment <= 0)
 		return 0;
 	if (pos + increment >= Length())
@@ -713,8 +738,8 @@ int Document::NextPosition(int pos, int moveDir) const {
 				// If ch is not a trail byte then pos is valid intercharacter position
 				if (UTF8IsTrailByte(ch)) {
 					// If ch is a trail byte in a valid UTF-8 character then return start of character
-					int startUTF = pos;
-					int endUTF = pos;
+					Sci::Position startUTF = pos;
+					Sci::Position endUTF = pos;
 					if (InGoodUTF8(pos, startUTF, endUTF)) {
 						pos = startUTF;
 					}
@@ -730,7 +755,7 @@ int Document::NextPosition(int pos, int moveDir) const {
 			} else {
 				// Anchor DBCS calculations at start of line because start of line can
 				// not be a DBCS trail byte.
-				int posStartLine = LineStart(LineFromPosition(pos));
+				Sci::Position posStartLine = LineStart(LineFromPosition(pos));
 				// See http://msdn.microsoft.com/en-us/library/cc194792%28v=MSDN.10%29.aspx
 				// http://msdn.microsoft.com/en-us/library/cc194790.aspx
 				if ((pos - 1) <= posStartLine) {
@@ -740,7 +765,7 @@ int Document::NextPosition(int pos, int moveDir) const {
 					return pos - 2;
 				} else {
 					// Otherwise, step back until a non-lead-byte is found.
-					int posTemp = pos - 1;
+					Sci::Position posTemp = pos - 1;
 					while (posStartLine <= --posTemp && IsDBCSLeadByte(cb.CharAt(posTemp)))
 						;
 					// Now posTemp+1 must point to the beginning of a character,
@@ -757,9 +782,9 @@ int Document::NextPosition(int pos, int moveDir) const {
 	return pos;
 }
 
-bool Document::NextCharacter(int &pos, int moveDir) const {
+bool Document::NextCharacter(Sci::Position &pos, int moveDir) const {
 	// Returns true if pos changed
-	int posNext = NextPosition(pos, moveDir);
+	Sci::Position posNext = NextPosition(pos, moveDir);
 	if (posNext == pos) {
 		return false;
 	} else {
@@ -768,7 +793,7 @@ bool Document::NextCharacter(int &pos, int moveDir) const {
 	}
 }
 
-Document::CharacterExtracted Document::CharacterAfter(int position) const {
+Document::CharacterExtracted Document::CharacterAfter(Sci::Position position) const {
 	if (position >= Length()) {
 		return CharacterExtracted(unicodeReplacementChar, 0);
 	}
@@ -798,7 +823,7 @@ Document::CharacterExtracted Document::CharacterAfter(int position) const {
 	}
 }
 
-Document::CharacterExtracted Document::CharacterBefore(int position) const {
+Document::CharacterExtracted Document::CharacterBefore(Sci::Position position) const {
 	if (position <= 0) {
 		return CharacterExtracted(unicodeReplacementChar, 0);
 	}
@@ -814,8 +839,8 @@ Document::CharacterExtracted Document::CharacterBefore(int position) const {
 		// If previousByte is not a trail byte then its invalid
 		if (UTF8IsTrailByte(previousByte)) {
 			// If previousByte is a trail byte in a valid UTF-8 character then find start of character
-			int startUTF = position;
-			int endUTF = position;
+			Sci::Position startUTF = position;
+			Sci::Position endUTF = position;
 			if (InGoodUTF8(position, startUTF, endUTF)) {
 				const int widthCharBytes = endUTF - startUTF;
 				unsigned char charBytes[UTF8MaxBytes] = { 0, 0, 0, 0 };
@@ -834,18 +859,18 @@ Document::CharacterExtracted Document::CharacterBefore(int position) const {
 		return CharacterExtracted(unicodeReplacementChar, 1);
 	} else {
 		// Moving backwards in DBCS is complex so use NextPosition
-		const int posStartCharacter = NextPosition(position, -1);
+		const Sci::Position posStartCharacter = NextPosition(position, -1);
 		return CharacterAfter(posStartCharacter);
 	}
 }
 
 // Return -1  on out-of-bounds
 Sci_Position SCI_METHOD Document::GetRelativePosition(Sci_Position positionStart, Sci_Position characterOffset) const {
-	int pos = positionStart;
+	Sci::Position pos = positionStart;
 	if (dbcsCodePage) {
-		const int increment = (characterOffset > 0) ? 1 : -1;
+		const Sci::Position increment = (characterOffset > 0) ? 1 : -1;
 		while (characterOffset != 0) {
-			const int posNext = NextPosition(pos, increment);
+			const Sci::Position posNext = NextPosition(pos, increment);
 			if (posNext == pos)
 				return INVALID_POSITION;
 			pos = posNext;
@@ -859,12 +884,12 @@ Sci_Position SCI_METHOD Document::GetRelativePosition(Sci_Position positionStart
 	return pos;
 }
 
-int Document::GetRelativePositionUTF16(int positionStart, int characterOffset) const {
-	int pos = positionStart;
+Sci::Position Document::GetRelativePositionUTF16(Sci::Position positionStart, Sci::Position characterOffset) const {
+	Sci::Position pos = positionStart;
 	if (dbcsCodePage) {
-		const int increment = (characterOffset > 0) ? 1 : -1;
+		const Sci::Position increment = (characterOffset > 0) ? 1 : -1;
 		while (characterOffset != 0) {
-			const int posNext = NextPosition(pos, increment);
+			const Sci::Position posNext = NextPosition(pos, increment);
 			if (posNext == pos)
 				return INVALID_POSITION;
 			if (abs(pos-posNext) > 3)	// 4 byte character = 2*UTF16.
@@ -967,12 +992,12 @@ static inline bool IsSpaceOrTab(int ch) {
 //   2) Break before punctuation
 //   3) Break after whole character
 
-int Document::SafeSegment(const char *text, int length, int lengthSegment) const {
+Sci::Position Document::SafeSegment(const char *text, Sci::Position length, Sci::Position lengthSegment) const {
 	if (length <= lengthSegment)
 		return length;
-	int lastSpaceBreak = -1;
-	int lastPunctuationBreak = -1;
-	int lastEncodingAllowedBreak = 0;
+	Sci::Position lastSpaceBreak = -1;
+	Sci::Position lastPunctuationBreak = -1;
+	Sci::Position lastEncodingAllowedBreak = 0;
 	for (int j=0; j < lengthSegment;) {
 		unsigned char ch = static_cast<unsigned char>(text[j]);
 		if (j > 0) {
@@ -1010,7 +1035,7 @@ EncodingFamily Document::CodePageFamily() const {
 		return efEightBit;
 }
 
-void Document::ModifiedAt(int pos) {
+void Document::ModifiedAt(Sci::Position pos) {
 	if (endStyled > pos)
 		endStyled = pos;
 }
@@ -1026,7 +1051,7 @@ void Document::CheckReadOnly() {
 // Document only modified by gateways DeleteChars, InsertString, Undo, Redo, and SetStyleAt.
 // SetStyleAt does not change the persistent state of a document
 
-bool Document::DeleteChars(int pos, int len) {
+bool Document::DeleteChars(Sci::Position pos, Sci::Position len) {
 	if (pos < 0)
 		return false;
 	if (len <= 0)
@@ -1044,7 +1069,7 @@ bool Document::DeleteChars(int pos, int len) {
 			        SC_MOD_BEFOREDELETE | SC_PERFORMED_USER,
 			        pos, len,
 			        0, 0));
-			int prevLinesTotal = LinesTotal();
+			Sci::Line prevLinesTotal = LinesTotal();
 			bool startSavePoint = cb.IsSavePoint();
 			bool startSequence = false;
 			const char *text = cb.DeleteChars(pos, len, startSequence);
@@ -1068,7 +1093,7 @@ bool Document::DeleteChars(int pos, int len) {
 /**
  * Insert a string with a length.
  */
-int Document::InsertString(int position, const char *s, int insertLength) {
+Sci::Position Document::InsertString(Sci::Position position, const char *s, Sci::Position insertLength) {
 	if (insertLength <= 0) {
 		return 0;
 	}
@@ -1096,7 +1121,7 @@ int Document::InsertString(int position, const char *s, int insertLength) {
 			SC_MOD_BEFOREINSERT | SC_PERFORMED_USER,
 			position, insertLength,
 			0, s));
-	int prevLinesTotal = LinesTotal();
+	Sci::Line prevLinesTotal = LinesTotal();
 	bool startSavePoint = cb.IsSavePoint();
 	bool startSequence = false;
 	const char *text = cb.InsertString(position, s, insertLength, startSequence);
@@ -1115,15 +1140,29 @@ int Document::InsertString(int position, const char *s, int insertLength) {
 	return insertLength;
 }
 
-void Document::ChangeInsertion(const char *s, int length) {
+void Document::ChangeInsertion(const char *s, Sci::Position length) {
 	insertionSet = true;
 	insertion.assign(s, length);
 }
 
 int SCI_METHOD Document::AddData(char *data, Sci_Position length) {
 	try {
-		int position = Length();
-		InsertString(position, data, length);
+		Sci::Position position = Length();
+		if (options & SC_DOCUMENTOPTION_TEXT_MAPPED) {
+			// Refer to the data instead of copying it so it must all be added at once
+			if ((position != 0) || cb.IsMapped())
+				return SC_STATUS_FAILURE;
+			const Sci::Line prevLinesTotal = LinesTotal();
+			cb.SetMappedText(data, length);
+			ModifiedAt(0);
+			NotifyModified(
+				DocModification(
+					SC_MOD_INSERTTEXT | SC_PERFORMED_USER,
+					0, length,
+					LinesTotal() - prevLinesTotal, data));
+		} else {
+			InsertString(position, data, length);
+		}
 	} catch (std::bad_alloc &) {
 		return SC_STATUS_BADALLOC;
 	} catch (...) {
@@ -1136,8 +1175,8 @@ void * SCI_METHOD Document::ConvertToDocument() {
 	return this;
 }
 
-int Document::Undo() {
-	int newPos = -1;
+Sci::Position Document::Undo() {
+	Sci::Position newPos = -1;
 	CheckReadOnly();
 	if ((enteredModification == 0) && (cb.IsCollectingUndo())) {
 		enteredModification++;
@@ -1146,12 +1185,12 @@ int Document::Undo() {
 			bool multiLine = false;
 			int steps = cb.StartUndo();
 			//Platform::DebugPrintf("Steps=%d\n", steps);
-			int coalescedRemovePos = -1;
-			int coalescedRemoveLen = 0;
-			int prevRemoveActionPos = -1;
-			int prevRemoveActionLen = 0;
+			Sci::Position coalescedRemovePos = -1;
+			Sci::Position coalescedRemoveLen = 0;
+			Sci::Position prevRemoveActionPos = -1;
+			Sci::Position prevRemoveActionLen = 0;
 			for (int step = 0; step < steps; step++) {
-				const int prevLinesTotal = LinesTotal();
+				const Sci::Line prevLinesTotal = LinesTotal();
 				const Action &action = cb.GetUndoStep();
 				if (action.at == removeAction) {
 					NotifyModified(DocModification(
@@ -1200,7 +1239,7 @@ int Document::Undo() {
 				}
 				if (steps > 1)
 					modFlags |= SC_MULTISTEPUNDOREDO;
-				const int linesAdded = LinesTotal() - prevLinesTotal;
+				const Sci::Line linesAdded = LinesTotal() - prevLinesTotal;
 				if (linesAdded != 0)
 					multiLine = true;
 				if (step == steps - 1) {
@@ -1221,8 +1260,8 @@ int Document::Undo() {
 	return newPos;
 }
 
-int Document::Redo() {
-	int newPos = -1;
+Sci::Position Document::Redo() {
+	Sci::Position newPos = -1;
 	CheckReadOnly();
 	if ((enteredModification == 0) && (cb.IsCollectingUndo())) {
 		enteredModification++;
@@ -1231,7 +1270,7 @@ int Document::Redo() {
 			bool multiLine = false;
 			int steps = cb.StartRedo();
 			for (int step = 0; step < steps; step++) {
-				const int prevLinesTotal = LinesTotal();
+				const Sci::Line prevLinesTotal = LinesTotal();
 				const Action &action = cb.GetRedoStep();
 				if (action.at == insertAction) {
 					NotifyModified(DocModification(
@@ -1259,7 +1298,7 @@ int Document::Redo() {
 				}
 				if (steps > 1)
 					modFlags |= SC_MULTISTEPUNDOREDO;
-				const int linesAdded = LinesTotal() - prevLinesTotal;
+				const Sci::Line linesAdded = LinesTotal() - prevLinesTotal;
 				if (linesAdded != 0)
 					multiLine = true;
 				if (step == steps - 1) {
@@ -1281,24 +1320,24 @@ int Document::Redo() {
 	return newPos;
 }
 
-void Document::DelChar(int pos) {
+void Document::DelChar(Sci::Position pos) {
 	DeleteChars(pos, LenChar(pos));
 }
 
-void Document::DelCharBack(int pos) {
+void Document::DelCharBack(Sci::Position pos) {
 	if (pos <= 0) {
 		return;
 	} else if (IsCrLf(pos - 2)) {
 		DeleteChars(pos - 2, 2);
 	} else if (dbcsCodePage) {
-		int startChar = NextPosition(pos, -1);
+		Sci::Position startChar = NextPosition(pos, -1);
 		DeleteChars(startChar, pos - startChar);
 	} else {
 		DeleteChars(pos - 1, 1);
 	}
 }
 
-static int NextTab(int pos, int tabSize) {
+static int NextTab(Sci::Position pos, int tabSize) {
 	return ((pos / tabSize) + 1) * tabSize;
 }
 
@@ -1320,9 +1359,9 @@ static std::string CreateIndentation(int indent, int tabSize, bool insertSpaces)
 int SCI_METHOD Document::GetLineIndentation(Sci_Position line) {
 	int indent = 0;
 	if ((line >= 0) && (line < LinesTotal())) {
-		int lineStart = LineStart(line);
-		int length = Length();
-		for (int i = lineStart; i < length; i++) {
+		Sci::Line lineStart = LineStart(line);
+		Sci::Position length = Length();
+		for (Sci::Position i = lineStart; i < length; i++) {
 			char ch = cb.CharAt(i);
 			if (ch == ' ')
 				indent++;
@@ -1335,14 +1374,14 @@ int SCI_METHOD Document::GetLineIndentation(Sci_Position line) {
 	return indent;
 }
 
-int Document::SetLineIndentation(int line, int indent) {
+int Document::SetLineIndentation(Sci::Line line, int indent) {
 	int indentOfLine = GetLineIndentation(line);
 	if (indent < 0)
 		indent = 0;
 	if (indent != indentOfLine) {
 		std::string linebuf = CreateIndentation(indent, tabInChars, !useTabs);
-		int thisLineStart = LineStart(line);
-		int indentPos = GetLineIndentPosition(line);
+		Sci::Position thisLineStart = LineStart(line);
+		Sci::Position indentPos = GetLineIndentPosition(line);
 		UndoGroup ug(this);
 		DeleteChars(thisLineStart, indentPos - thisLineStart);
 		return thisLineStart + InsertString(thisLineStart, linebuf.c_str(),
@@ -1352,22 +1391,22 @@ int Document::SetLineIndentation(int line, int indent) {
 	}
 }
 
-int Document::GetLineIndentPosition(int line) const {
+Sci::Position Document::GetLineIndentPosition(Sci::Line line) const {
 	if (line < 0)
 		return 0;
-	int pos = LineStart(line);
-	int length = Length();
+	Sci::Position pos = LineStart(line);
+	Sci::Position length = Length();
 	while ((pos < length) && IsSpaceOrTab(cb.CharAt(pos))) {
 		pos++;
 	}
 	return pos;
 }
 
-int Document::GetColumn(int pos) {
-	int column = 0;
-	int line = LineFromPosition(pos);
+Sci::Position Document::GetColumn(Sci::Position pos) {
+	Sci::Position column = 0;
+	Sci::Line line = LineFromPosition(pos);
 	if ((line >= 0) && (line < LinesTotal())) {
-		for (int i = LineStart(line); i < pos;) {
+		for (Sci::Position i = LineStart(line); i < pos;) {
 			char ch = cb.CharAt(i);
 			if (ch == '\t') {
 				column = NextTab(column, tabInChars);
@@ -1387,11 +1426,17 @@ int Document::GetColumn(int pos) {
 	return column;
 }
 
-int Document::CountCharacters(int startPos, int endPos) const {
+Sci::Position Document::CountCharacters(Sci::Position startPos, Sci::Position endPos) const {
 	startPos = MovePositionOutsideChar(startPos, 1, false);
 	endPos = MovePositionOutsideChar(endPos, -1, false);
-	int count = 0;
-	int i = startPos;
+	if (SC_CP_UTF8 == dbcsCodePage) {
+		size_t characters = 0;
+		size_t utf16Length = 0;
+		CountUTF8(startPos, endPos, characters, utf16Length);
+		return static_cast<Sci::Position>(characters);
+	}
+	Sci::Position count = 0;
+	Sci::Position i = startPos;
 	while (i < endPos) {
 		count++;
 		i = NextPosition(i, 1);
@@ -1399,14 +1444,20 @@ int Document::CountCharacters(int startPos, int endPos) const {
 	return count;
 }
 
-int Document::CountUTF16(int startPos, int endPos) const {
+Sci::Position Document::CountUTF16(Sci::Position startPos, Sci::Position endPos) const {
 	startPos = MovePositionOutsideChar(startPos, 1, false);
 	endPos = MovePositionOutsideChar(endPos, -1, false);
-	int count = 0;
-	int i = startPos;
+	if (SC_CP_UTF8 == dbcsCodePage) {
+		size_t characters = 0;
+		size_t utf16Length = 0;
+		CountUTF8(startPos, endPos, characters, utf16Length);
+		return static_cast<Sci::Position>(utf16Length);
+	}
+	Sci::Position count = 0;
+	Sci::Position i = startPos;
 	while (i < endPos) {
 		count++;
-		const int next = NextPosition(i, 1);
+		const Sci::Position next = NextPosition(i, 1);
 		if ((next - i) > 3)
 			count++;
 		i = next;
@@ -1414,10 +1465,36 @@ int Document::CountUTF16(int startPos, int endPos) const {
 	return count;
 }
 
-int Document::FindColumn(int line, int column) {
-	int position = LineStart(line);
+// Counts a block of text at a time so characters can be checked many at once instead of
+// calling NextPosition for each.
+void Document::CountUTF8(Sci::Position startPos, Sci::Position endPos, size_t &characters, size_t &utf16Length) const {
+	if (startPos >= endPos)
+		return;
+	// Text on one side of the gap, including the bytes that may complete its last character,
+	// is counted where it is.
+	const GapText text = cb.TextAroundGap();
+	if ((endPos + UTF8MaxBytes - 1 <= text.Gap()) || (startPos >= text.Gap())) {
+		const bool before = startPos < text.Gap();
+		const char *s = before ? text.Before() + startPos : text.After() + startPos - text.Gap();
+		const Sci::Position lengthAvailable = std::min(endPos - startPos + UTF8MaxBytes - 1, Length() - startPos);
+		UTF8CountCharacters(s, endPos - startPos, lengthAvailable, characters, utf16Length);
+		return;
+	}
+	const Sci::Position lengthBlock = 0x10000;
+	std::vector<char> block(std::min(endPos - startPos, lengthBlock) + UTF8MaxBytes);
+	Sci::Position pos = startPos;
+	while (pos < endPos) {
+		const Sci::Position lengthCount = std::min(endPos - pos, lengthBlock);
+		const Sci::Position lengthAvailable = std::min(lengthCount + UTF8MaxBytes - 1, Length() - pos);
+		cb.GetCharRange(&block[0], pos, lengthAvailable);
+		pos += UTF8CountCharacters(&block[0], lengthCount, lengthAvailable, characters, utf16Length);
+	}
+}
+
+Sci::Position Document::FindColumn(Sci::Line line, Sci::Position column) {
+	Sci::Position position = LineStart(line);
 	if ((line >= 0) && (line < LinesTotal())) {
-		int columnCurrent = 0;
+		Sci::Position columnCurrent = 0;
 		while ((columnCurrent < column) && (position < Length())) {
 			char ch = cb.CharAt(position);
 			if (ch == '\t') {
@@ -1438,9 +1515,9 @@ int Document::FindColumn(int line, int column) {
 	return position;
 }
 
-void Document::Indent(bool forwards, int lineBottom, int lineTop) {
+void Document::Indent(bool forwards, Sci::Line lineBottom, Sci::Line lineTop) {
 	// Dedent - suck white space off the front of the line to dedent by equivalent of a tab
-	for (int line = lineBottom; line >= lineTop; line--) {
+	for (Sci::Line line = lineBottom; line >= lineTop; line--) {
 		int indentOfLine = GetLineIndentation(line);
 		if (forwards) {
 			if (LineStart(line) < LineEnd(line)) {
@@ -1479,7 +1556,7 @@ std::string Document::TransformLineEnds(const char *s, size_t len, int eolModeWa
 void Document::ConvertLineEnds(int eolModeSet) {
 	UndoGroup ug(this);
 
-	for (int pos = 0; pos < Length(); pos++) {
+	for (Sci::Position pos = 0; pos < Length(); pos++) {
 		if (cb.CharAt(pos) == '\r') {
 			if (cb.CharAt(pos + 1) == '\n') {
 				// CRLF
@@ -1514,9 +1591,9 @@ void Document::ConvertLineEnds(int eolModeSet) {
 
 }
 
-bool Document::IsWhiteLine(int line) const {
-	int currentChar = LineStart(line);
-	int endLine = LineEnd(line);
+bool Document::IsWhiteLine(Sci::Line line) const {
+	Sci::Position currentChar = LineStart(line);
+	Sci::Position endLine = LineEnd(line);
 	while (currentChar < endLine) {
 		if (cb.CharAt(currentChar) != ' ' && cb.CharAt(currentChar) != '\t') {
 			return false;
@@ -1526,8 +1603,8 @@ bool Document::IsWhiteLine(int line) const {
 	return true;
 }
 
-int Document::ParaUp(int pos) const {
-	int line = LineFromPosition(pos);
+Sci::Position Document::ParaUp(Sci::Position pos) const {
+	Sci::Line line = LineFromPosition(pos);
 	line--;
 	while (line >= 0 && IsWhiteLine(line)) { // skip empty lines
 		line--;
@@ -1539,8 +1616,8 @@ int Document::ParaUp(int pos) const {
 	return LineStart(line);
 }
 
-int Document::ParaDown(int pos) const {
-	int line = LineFromPosition(pos);
+Sci::Position Document::ParaDown(Sci::Position pos) const {
+	Sci::Line line = LineFromPosition(pos);
 	while (line < LinesTotal() && !IsWhiteLine(line)) { // skip non-empty lines
 		line++;
 	}
@@ -1627,7 +1704,7 @@ CharClassify::cc Document::WordCharacterClass(unsigned int ch) const {
  * Used by commmands that want to select whole words.
  * Finds the start of word at pos when delta < 0 or the end of the word when delta >= 0.
  */
-int Document::ExtendWordSelect(int pos, int delta, bool onlyWordCharacters) const {
+Sci::Position Document::ExtendWordSelect(Sci::Position pos, int delta, bool onlyWordCharacters) const {
 	CharClassify::cc ccStart = CharClassify::ccWord;
 	if (delta < 0) {
 		if (!onlyWordCharacters) {
@@ -1662,7 +1739,7 @@ int Document::ExtendWordSelect(int pos, int delta, bool onlyWordCharacters) cons
  * additional movement to transit white space.
  * Used by cursor movement by word commands.
  */
-int Document::NextWordStart(int pos, int delta) const {
+Sci::Position Document::NextWordStart(Sci::Position pos, int delta) const {
 	if (delta < 0) {
 		while (pos > 0) {
 			const CharacterExtracted ce = CharacterBefore(pos);
@@ -1706,7 +1783,7 @@ int Document::NextWordStart(int pos, int delta) const {
  * additional movement to transit white space.
  * Used by cursor movement by word commands.
  */
-int Document::NextWordEnd(int pos, int delta) const {
+Sci::Position Document::NextWordEnd(Sci::Position pos, int delta) const {
 	if (delta < 0) {
 		if (pos > 0) {
 			CharacterExtracted ce = CharacterBefore(pos);
@@ -1751,7 +1828,7 @@ int Document::NextWordEnd(int pos, int delta) const {
  * Check that the character at the given position is a word or punctuation character and that
  * the previous character is of a different character class.
  */
-bool Document::IsWordStartAt(int pos) const {
+bool Document::IsWordStartAt(Sci::Position pos) const {
 	if (pos >= Length())
 		return false;
 	if (pos > 0) {
@@ -1769,7 +1846,7 @@ bool Document::IsWordStartAt(int pos) const {
  * Check that the character at the given position is a word or punctuation character and that
  * the next character is of a different character class.
  */
-bool Document::IsWordEndAt(int pos) const {
+bool Document::IsWordEndAt(Sci::Position pos) const {
 	if (pos <= 0)
 		return false;
 	if (pos < Length()) {
@@ -1787,11 +1864,11 @@ bool Document::IsWordEndAt(int pos) const {
  * Check that the given range is has transitions between character classes at both
  * ends and where the characters on the inside are word or punctuation characters.
  */
-bool Document::IsWordAt(int start, int end) const {
+bool Document::IsWordAt(Sci::Position start, Sci::Position end) const {
 	return (start < end) && IsWordStartAt(start) && IsWordEndAt(end);
 }
 
-bool Document::MatchesWordOptions(bool word, bool wordStart, int pos, int length) const {
+bool Document::MatchesWordOptions(bool word, bool wordStart, Sci::Position pos, Sci::Position length) const {
 	return (!word && !wordStart) ||
 			(word && IsWordAt(pos, pos + length)) ||
 			(wordStart && IsWordStartAt(pos));
@@ -1806,7 +1883,7 @@ void Document::SetCaseFolder(CaseFolder *pcf_) {
 	pcf = pcf_;
 }
 
-Document::CharacterExtracted Document::ExtractCharacter(int position) const {
+Document::CharacterExtracted Document::ExtractCharacter(Sci::Position position) const {
 	const unsigned char leadByte = static_cast<unsigned char>(cb.CharAt(position));
 	if (UTF8IsAscii(leadByte)) {
 		// Common case: ASCII character
@@ -1825,19 +1902,284 @@ Document::CharacterExtracted Document::ExtractCharacter(int position) const {
 	}
 }
 
+namespace {
+
+/**
+ * Finds a byte string in contiguous memory without regard to character boundaries.
+ * When folding is not NULL, each text byte is mapped through it before comparison with the
+ * already folded pattern.
+ * Exact patterns shorter than bmhMinimum look for their first byte with memchr, other
+ * patterns use Boyer-Moore-Horspool so can skip over text in steps of up to the pattern length.
+ */
+class BytePattern {
+	enum { bmhMinimum = 4 };
+	const char *pattern;
+	ptrdiff_t length;
+	const char *folding;
+	ptrdiff_t skipForward[256];
+	ptrdiff_t skipBackward[256];
+	bool Matches(const char *text, ptrdiff_t pos, ptrdiff_t from) const {
+		if (!folding)
+			return memcmp(text + pos + from, pattern + from, length - from) == 0;
+		for (ptrdiff_t i = from; i < length; i++) {
+			if (folding[static_cast<unsigned char>(text[pos + i])] != pattern[i])
+				return false;
+		}
+		return true;
+	}
+	char Folded(char ch) const {
+		return folding ? folding[static_cast<unsigned char>(ch)] : ch;
+	}
+public:
+	BytePattern(const char *pattern_, ptrdiff_t length_, const char *folding_) :
+		pattern(pattern_), length(length_), folding(folding_) {
+		ptrdiff_t skipFoldedForward[256];
+		ptrdiff_t skipFoldedBackward[256];
+		for (int ch = 0; ch < 256; ch++) {
+			skipFoldedForward[ch] = length;
+			skipFoldedBackward[ch] = length;
+		}
+		for (ptrdiff_t i = 0; i < length - 1; i++)
+			skipFoldedForward[static_cast<unsigned char>(pattern[i])] = length - 1 - i;
+		for (ptrdiff_t i = length - 1; i > 0; i--)
+			skipFoldedBackward[static_cast<unsigned char>(pattern[i])] = i;
+		for (int ch = 0; ch < 256; ch++) {
+			const unsigned char chFolded = static_cast<unsigned char>(Folded(static_cast<char>(ch)));
+			skipForward[ch] = skipFoldedForward[chFolded];
+			skipBackward[ch] = skipFoldedBackward[chFolded];
+		}
+	}
+	// Returns the first start in [first, last] where the pattern matches text or -1.
+	// text must be readable up to last + length.
+	ptrdiff_t FindForward(const char *text, ptrdiff_t first, ptrdiff_t last) const {
+		ptrdiff_t pos = first;
+		if (!folding && (length < bmhMinimum)) {
+			while (pos <= last) {
+				const void *found = memchr(text + pos, pattern[0], last - pos + 1);
+				if (!found)
+					return -1;
+				pos = static_cast<const char *>(found) - text;
+				if (Matches(text, pos, 1))
+					return pos;
+				pos++;
+			}
+		} else {
+			const char chLast = pattern[length - 1];
+			while (pos <= last) {
+				const char ch = text[pos + length - 1];
+				if ((Folded(ch) == chLast) && Matches(text, pos, 0))
+					return pos;
+				pos += skipForward[static_cast<unsigned char>(ch)];
+			}
+		}
+		return -1;
+	}
+	// Returns the last start in [first, last] where the pattern matches text or -1.
+	ptrdiff_t FindBackward(const char *text, ptrdiff_t first, ptrdiff_t last) const {
+		ptrdiff_t pos = last;
+		const char chFirst = pattern[0];
+		if (!folding && (length < bmhMinimum)) {
+			for (; pos >= first; pos--) {
+				if ((text[pos] == chFirst) && Matches(text, pos, 1))
+					return pos;
+			}
+		} else {
+			while (pos >= first) {
+				const char ch = text[pos];
+				if ((Folded(ch) == chFirst) && Matches(text, pos, 1))
+					return pos;
+				pos -= skipBackward[static_cast<unsigned char>(ch)];
+			}
+		}
+		return -1;
+	}
+};
+
+#ifndef NO_CXX11_THREADS
+
+// Parallel searches divide their range into chunks of at least this many bytes
+const Sci::Position minimumSearchChunk = 0x100000;
+
+int SearchThreads() {
+	return std::max(1U, std::thread::hardware_concurrency());
+}
+
+// Enough chunks to share out between the threads with some left over for threads that finish early.
+int SearchChunks(Sci::Position lengthSearch) {
+	const Sci::Position chunks = lengthSearch / minimumSearchChunk;
+	return static_cast<int>(std::max<Sci::Position>(1, std::min<Sci::Position>(chunks, SearchThreads() * 4)));
+}
+
+/**
+ * Call search for each chunk from 0 to chunks-1 on a pool of threads with chunks taken in order.
+ * When search returns true, chunks after that one are not started as only the match in the
+ * earliest chunk is wanted.
+ * @return The earliest chunk where search returned true or -1.
+ */
+int SearchInParallel(int chunks, const std::function<bool(int)> &search) {
+	std::atomic<int> nextChunk(0);
+	std::atomic<int> firstFound(chunks);
+	const std::function<void()> worker = [&]() {
+		for (;;) {
+			const int chunk = nextChunk++;
+			if ((chunk >= chunks) || (chunk > firstFound))
+				return;
+			if (search(chunk)) {
+				int earliest = firstFound;
+				while ((chunk < earliest) && !firstFound.compare_exchange_weak(earliest, chunk)) {
+				}
+			}
+		}
+	};
+	std::vector<std::thread> pool;
+	const int threads = std::min(chunks, SearchThreads());
+	for (int thread = 1; thread < threads; thread++)
+		pool.push_back(std::thread(worker));
+	worker();
+	for (std::vector<std::thread>::iterator it = pool.begin(); it != pool.end(); ++it)
+		it->join();
+	return (firstFound < chunks) ? static_cast<int>(firstFound) : -1;
+}
+
+#endif
+
+}
+
+/**
+ * Search for the first (or when !forward, last) match of a byte string starting in [minStart, maxStart].
+ * When folding is not NULL, search has already been folded and document bytes are folded through it.
+ * Each side of the gap is searched in place so the gap is not moved and only matches that straddle
+ * the gap are checked a byte at a time.
+ * Matches must start on a character so, unless the first byte of search can only start a character,
+ * the position is checked against the encoding.
+ * When found is not NULL, a forward search appends every match that does not overlap an earlier match
+ * to found and returns -1.
+ * When parallel, large ranges are divided into chunks that are searched on several threads. The
+ * document must not be modified until the search returns.
+ */
+Sci::Position Document::FindBytes(Sci::Position minStart, Sci::Position maxStart, bool forward,
+	const char *search, Sci::Position lengthFind, const char *folding, bool word, bool wordStart,
+	std::vector<Range> *found, bool parallel) {
+	if (maxStart < minStart)
+		return -1;
+#ifndef NO_CXX11_THREADS
+	const int chunks = parallel ? SearchChunks(maxStart - minStart + 1) : 1;
+	if (chunks > 1) {
+		const Sci::Position chunkLength = (maxStart - minStart + chunks) / chunks;
+		std::vector<Sci::Position> positions(chunks, -1);
+		std::vector<std::vector<Range> > chunkFound(found ? chunks : 0);
+		// Backwards searches take chunks from the end so the latest match is preferred
+		const int earliest = SearchInParallel(chunks, [&](int order) {
+			const int chunk = forward ? order : chunks - 1 - order;
+			const Sci::Position chunkStart = minStart + chunk * chunkLength;
+			const Sci::Position chunkEnd = std::min(maxStart, chunkStart + chunkLength - 1);
+			positions[order] = FindBytes(chunkStart, chunkEnd, forward, search, lengthFind, folding,
+				word, wordStart, found ? &chunkFound[chunk] : 0);
+			return !found && (positions[order] >= 0);
+		});
+		if (!found)
+			return (earliest >= 0) ? positions[earliest] : -1;
+		Sci::Position endPrevious = minStart;
+		for (int chunk = 0; chunk < chunks; chunk++) {
+			std::vector<Range> &ranges = chunkFound[chunk];
+			if (!ranges.empty() && (ranges.front().start < endPrevious)) {
+				// First match overlaps the previous chunk's last match so search again after that
+				const Sci::Position chunkEnd = std::min(maxStart, minStart + (chunk + 1) * chunkLength - 1);
+				ranges.clear();
+				FindBytes(endPrevious, chunkEnd, true, search, lengthFind, folding, word, wordStart, &ranges);
+			}
+			if (!ranges.empty()) {
+				found->insert(found->end(), ranges.begin(), ranges.end());
+				endPrevious = ranges.back().end;
+			}
+		}
+		return -1;
+	}
+#endif
+	const bool checkCharacterStart = dbcsCodePage &&
+		((SC_CP_UTF8 != dbcsCodePage) || UTF8IsTrailByte(static_cast<unsigned char>(search[0])));
+	const BytePattern pattern(search, lengthFind, folding);
+	const GapText text = cb.TextAroundGap();
+	const Sci::Position gap = text.Gap();
+	// Start positions of matches wholly before the gap, straddling the gap, and wholly after the gap
+	const Sci::Position firstStraddle = std::max(minStart, gap - lengthFind + 1);
+	const Sci::Position lastStraddle = std::min(maxStart, gap - 1);
+	const Sci::Position lastBefore = std::min(maxStart, gap - lengthFind);
+	const Sci::Position firstAfter = std::max(minStart, gap);
+	Sci::Position firstUnfound = minStart;
+	for (int segment = 0; segment < 3; segment++) {
+		const int region = forward ? segment : 2 - segment;
+		Sci::Position first = minStart;
+		Sci::Position last = lastBefore;
+		if (region == 1) {
+			first = firstStraddle;
+			last = lastStraddle;
+		} else if (region == 2) {
+			first = firstAfter;
+			last = maxStart;
+		}
+		if (forward)
+			first = std::max(first, firstUnfound);
+		while (first <= last) {
+			Sci::Position pos = -1;
+			if (region == 0) {
+				pos = forward ? pattern.FindForward(text.Before(), first, last) :
+					pattern.FindBackward(text.Before(), first, last);
+			} else if (region == 2) {
+				pos = forward ? pattern.FindForward(text.After(), first - gap, last - gap) :
+					pattern.FindBackward(text.After(), first - gap, last - gap);
+				if (pos >= 0)
+					pos += gap;
+			} else {
+				for (Sci::Position start = forward ? first : last; (start >= first) && (start <= last);
+					start += forward ? 1 : -1) {
+					Sci::Position indexSearch = 0;
+					while (indexSearch < lengthFind) {
+						const char ch = text.CharAt(start + indexSearch);
+						if ((folding ? folding[static_cast<unsigned char>(ch)] : ch) != search[indexSearch])
+							break;
+						indexSearch++;
+					}
+					if (indexSearch == lengthFind) {
+						pos = start;
+						break;
+					}
+				}
+			}
+			if (pos < 0)
+				break;
+			if ((!checkCharacterStart || (MovePositionOutsideChar(pos, 1, false) == pos)) &&
+				MatchesWordOptions(word, wordStart, pos, lengthFind)) {
+				if (!found)
+					return pos;
+				found->push_back(Range(pos, pos + lengthFind));
+				firstUnfound = pos + lengthFind;
+				first = firstUnfound;
+				continue;
+			}
+			if (forward)
+				first = pos + 1;
+			else
+				last = pos - 1;
+		}
+	}
+	return -1;
+}
+
 /**
  * Find text in document, supporting both forward and backward
  * searches (just pass minPos > maxPos to do a backward search)
  * Has not been tested with backwards DBCS searches yet.
  */
-long Document::FindText(int minPos, int maxPos, const char *search,
-                        int flags, int *length) {
+Sci::Position Document::FindText(Sci::Position minPos, Sci::Position maxPos, const char *search,
+                        int flags, Sci::Position *length) {
 	if (*length <= 0)
 		return minPos;
 	const bool caseSensitive = (flags & SCFIND_MATCHCASE) != 0;
 	const bool word = (flags & SCFIND_WHOLEWORD) != 0;
 	const bool wordStart = (flags & SCFIND_WORDSTART) != 0;
 	const bool regExp = (flags & SCFIND_REGEXP) != 0;
+	const bool parallel = (flags & SCFIND_PARALLEL) != 0;
 	if (regExp) {
 		if (!regex)
 			regex = CreateRegexSearch(&charClass);
@@ -1845,58 +2187,71 @@ long Document::FindText(int minPos, int maxPos, const char *search,
 	} else {
 
 		const bool forward = minPos <= maxPos;
-		const int increment = forward ? 1 : -1;
+		const Sci::Position increment = forward ? 1 : -1;
 
 		// Range endpoints should not be inside DBCS characters, but just in case, move them.
-		const int startPos = MovePositionOutsideChar(minPos, increment, false);
-		const int endPos = MovePositionOutsideChar(maxPos, increment, false);
+		const Sci::Position startPos = MovePositionOutsideChar(minPos, increment, false);
+		const Sci::Position endPos = MovePositionOutsideChar(maxPos, increment, false);
 
 		// Compute actual search ranges needed
-		const int lengthFind = *length;
+		const Sci::Position lengthFind = *length;
 
 		//Platform::DebugPrintf("Find %d %d %s %d\n", startPos, endPos, ft->lpstrText, lengthFind);
-		const int limitPos = Platform::Maximum(startPos, endPos);
-		int pos = startPos;
+		const Sci::Position limitPos = Platform::Maximum(startPos, endPos);
+		Sci::Position pos = startPos;
 		if (!forward) {
 			// Back all of a character
 			pos = NextPosition(pos, increment);
 		}
 		if (caseSensitive) {
-			const int endSearch = (startPos <= endPos) ? endPos - lengthFind + 1 : endPos;
-			const char charStartSearch =  search[0];
-			while (forward ? (pos < endSearch) : (pos >= endSearch)) {
-				if (CharAt(pos) == charStartSearch) {
-					bool found = (pos + lengthFind) <= limitPos;
-					for (int indexSearch = 1; (indexSearch < lengthFind) && found; indexSearch++) {
-						found = CharAt(pos + indexSearch) == search[indexSearch];
-					}
-					if (found && MatchesWordOptions(word, wordStart, pos, lengthFind)) {
-						return pos;
-					}
-				}
-				if (!NextCharacter(pos, increment))
-					break;
-			}
+			if (forward)
+				return FindBytes(startPos, endPos - lengthFind, forward, search, lengthFind, 0, word, wordStart,
+					0, parallel);
+			else
+				return FindBytes(endPos, std::min(pos, limitPos - lengthFind), forward,
+					search, lengthFind, 0, word, wordStart, 0, parallel);
 		} else if (SC_CP_UTF8 == dbcsCodePage) {
 			const size_t maxFoldingExpansion = 4;
 			std::vector<char> searchThing(lengthFind * UTF8MaxBytes * maxFoldingExpansion + 1);
-			const int lenSearch = static_cast<int>(
+			const Sci::Position lenSearch = static_cast<Sci::Position>(
 				pcf->Fold(&searchThing[0], searchThing.size(), search, lengthFind));
 			char bytes[UTF8MaxBytes + 1];
 			char folded[UTF8MaxBytes * maxFoldingExpansion + 1];
+			// ASCII is folded with the case folder's table so only other characters call Fold
+			const char *mapping = pcf->ByteMapping();
+			const GapText text = cb.TextAroundGap();
 			while (forward ? (pos < endPos) : (pos >= endPos)) {
-				int widthFirstCharacter = 0;
-				int posIndexDocument = pos;
-				int indexSearch = 0;
+				if (mapping && (lenSearch > 0)) {
+					// Pass over ASCII characters that can not start a match
+					if (forward) {
+						for (; pos < endPos; pos++) {
+							const unsigned char ch = static_cast<unsigned char>(text.CharAt(pos));
+							if (!UTF8IsAscii(ch) || (mapping[ch] == searchThing[0]))
+								break;
+						}
+						if (pos >= endPos)
+							break;
+					} else {
+						for (; pos > endPos; pos--) {
+							const unsigned char ch = static_cast<unsigned char>(text.CharAt(pos));
+							if (!UTF8IsAscii(ch) || (mapping[ch] == searchThing[0]) ||
+								UTF8IsTrailByte(static_cast<unsigned char>(text.CharAt(pos - 1))))
+								break;
+						}
+					}
+				}
+				Sci::Position widthFirstCharacter = 0;
+				Sci::Position posIndexDocument = pos;
+				Sci::Position indexSearch = 0;
 				bool characterMatches = true;
 				for (;;) {
-					const unsigned char leadByte = static_cast<unsigned char>(cb.CharAt(posIndexDocument));
+					const unsigned char leadByte = static_cast<unsigned char>(text.CharAt(posIndexDocument));
 					bytes[0] = leadByte;
 					int widthChar = 1;
 					if (!UTF8IsAscii(leadByte)) {
 						const int widthCharBytes = UTF8BytesOfLead[leadByte];
 						for (int b=1; b<widthCharBytes; b++) {
-							bytes[b] = cb.CharAt(posIndexDocument+b);
+							bytes[b] = text.CharAt(posIndexDocument+b);
 						}
 						widthChar = UTF8Classify(reinterpret_cast<const unsigned char *>(bytes), widthCharBytes) & UTF8MaskWidth;
 					}
@@ -1904,6 +2259,16 @@ long Document::FindText(int minPos, int maxPos, const char *search,
 						widthFirstCharacter = widthChar;
 					if ((posIndexDocument + widthChar) > limitPos)
 						break;
+					if (mapping && UTF8IsAscii(leadByte)) {
+						characterMatches = mapping[leadByte] == searchThing[indexSearch];
+						if (!characterMatches)
+							break;
+						posIndexDocument++;
+						indexSearch++;
+						if (indexSearch >= lenSearch)
+							break;
+						continue;
+					}
 					const int lenFlat = static_cast<int>(pcf->Fold(folded, sizeof(folded), bytes, widthChar));
 					folded[lenFlat] = 0;
 					// Does folded match the buffer
@@ -1915,7 +2280,7 @@ long Document::FindText(int minPos, int maxPos, const char *search,
 					if (indexSearch >= lenSearch)
 						break;
 				}
-				if (characterMatches && (indexSearch == static_cast<int>(lenSearch))) {
+				if (characterMatches && (indexSearch == lenSearch)) {
 					if (MatchesWordOptions(word, wordStart, pos, posIndexDocument - pos)) {
 						*length = posIndexDocument - pos;
 						return pos;
@@ -1932,11 +2297,11 @@ long Document::FindText(int minPos, int maxPos, const char *search,
 			const size_t maxBytesCharacter = 2;
 			const size_t maxFoldingExpansion = 4;
 			std::vector<char> searchThing(lengthFind * maxBytesCharacter * maxFoldingExpansion + 1);
-			const int lenSearch = static_cast<int>(
+			const Sci::Position lenSearch = static_cast<Sci::Position>(
 				pcf->Fold(&searchThing[0], searchThing.size(), search, lengthFind));
 			while (forward ? (pos < endPos) : (pos >= endPos)) {
-				int indexDocument = 0;
-				int indexSearch = 0;
+				Sci::Position indexDocument = 0;
+				Sci::Position indexSearch = 0;
 				bool characterMatches = true;
 				while (characterMatches &&
 					((pos + indexDocument) < limitPos) &&
@@ -1956,7 +2321,7 @@ long Document::FindText(int minPos, int maxPos, const char *search,
 					indexDocument += widthChar;
 					indexSearch += lenFlat;
 				}
-				if (characterMatches && (indexSearch == static_cast<int>(lenSearch))) {
+				if (characterMatches && (indexSearch == lenSearch)) {
 					if (MatchesWordOptions(word, wordStart, pos, indexDocument)) {
 						*length = indexDocument;
 						return pos;
@@ -1966,12 +2331,21 @@ long Document::FindText(int minPos, int maxPos, const char *search,
 					break;
 			}
 		} else {
-			const int endSearch = (startPos <= endPos) ? endPos - lengthFind + 1 : endPos;
+			const Sci::Position endSearch = (startPos <= endPos) ? endPos - lengthFind + 1 : endPos;
 			std::vector<char> searchThing(lengthFind + 1);
 			pcf->Fold(&searchThing[0], searchThing.size(), search, lengthFind);
+			const char *mapping = pcf->ByteMapping();
+			if (mapping) {
+				if (forward)
+					return FindBytes(startPos, endPos - lengthFind, forward, &searchThing[0], lengthFind,
+						mapping, word, wordStart, 0, parallel);
+				else
+					return FindBytes(endPos, std::min(pos, limitPos - lengthFind), forward, &searchThing[0], lengthFind,
+						mapping, word, wordStart, 0, parallel);
+			}
 			while (forward ? (pos < endSearch) : (pos >= endSearch)) {
 				bool found = (pos + lengthFind) <= limitPos;
-				for (int indexSearch = 0; (indexSearch < lengthFind) && found; indexSearch++) {
+				for (Sci::Position indexSearch = 0; (indexSearch < lengthFind) && found; indexSearch++) {
 					char ch = CharAt(pos + indexSearch);
 					char folded[2];
 					pcf->Fold(folded, sizeof(folded), &ch, 1);
@@ -1989,14 +2363,69 @@ long Document::FindText(int minPos, int maxPos, const char *search,
 	return -1;
 }
 
-const char *Document::SubstituteByPosition(const char *text, int *length) {
+/**
+ * Find every match in the range between minPos and maxPos and append them to found in order.
+ * Each search continues from the end of the previous match so matches do not overlap.
+ * Case sensitive and single byte case insensitive searches are made in one pass over the text
+ * instead of setting up a new search for each match.
+ * @return The number of matches found.
+ */
+Sci::Position Document::FindAll(Sci::Position minPos, Sci::Position maxPos, const char *search, int flags,
+	Sci::Position length, std::vector<Range> &found) {
+	if (length <= 0)
+		return 0;
+	const size_t foundBefore = found.size();
+	const Sci::Position startPos = MovePositionOutsideChar(std::min(minPos, maxPos), 1, false);
+	const Sci::Position endPos = MovePositionOutsideChar(std::max(minPos, maxPos), 1, false);
+	const bool word = (flags & SCFIND_WHOLEWORD) != 0;
+	const bool wordStart = (flags & SCFIND_WORDSTART) != 0;
+	const bool parallel = (flags & SCFIND_PARALLEL) != 0;
+	if (!(flags & SCFIND_REGEXP)) {
+		if (flags & SCFIND_MATCHCASE) {
+			FindBytes(startPos, endPos - length, true, search, length, 0, word, wordStart, &found, parallel);
+			return found.size() - foundBefore;
+		}
+		const char *mapping = pcf->ByteMapping();
+		if (!dbcsCodePage && mapping) {
+			std::vector<char> searchThing(length + 1);
+			pcf->Fold(&searchThing[0], searchThing.size(), search, length);
+			FindBytes(startPos, endPos - length, true, &searchThing[0], length, mapping, word, wordStart,
+				&found, parallel);
+			return found.size() - foundBefore;
+		}
+	}
+	// Starting threads for each match would cost more than it saves
+	const int flagsEach = flags & ~SCFIND_PARALLEL;
+	Sci::Position pos = startPos;
+	while (pos <= endPos) {
+		Sci::Position lengthFound = length;
+		const Sci::Position posFound = FindText(pos, endPos, search, flagsEach, &lengthFound);
+		if (posFound < 0)
+			break;
+		found.push_back(Range(posFound, posFound + lengthFound));
+		pos = posFound + lengthFound;
+		if (lengthFound == 0) {
+			// Empty match so continue after the next character
+			if (pos >= endPos)
+				break;
+			pos = NextPosition(pos, 1);
+		}
+	}
+	return found.size() - foundBefore;
+}
+
+const char *Document::SubstituteByPosition(const char *text, Sci::Position *length) {
 	if (regex)
 		return regex->SubstituteByPosition(this, text, length);
 	else
 		return 0;
 }
 
-int Document::LinesTotal() const {
+int Document::RegexCacheCount(bool hits) const {
+	return regex ? regex->CacheCount(hits) : 0;
+}
+
+Sci::Line Document::LinesTotal() const {
 	return cb.Lines();
 }
 
@@ -2021,7 +2450,7 @@ bool SCI_METHOD Document::SetStyleFor(Sci_Position length, char style) {
 		return false;
 	} else {
 		enteredStyling++;
-		int prevEndStyled = endStyled;
+		Sci::Position prevEndStyled = endStyled;
 		if (cb.SetStyleFor(endStyled, length, style)) {
 			DocModification mh(SC_MOD_CHANGESTYLE | SC_PERFORMED_USER,
 			                   prevEndStyled, length);
@@ -2039,9 +2468,9 @@ bool SCI_METHOD Document::SetStyles(Sci_Position length, const char *styles) {
 	} else {
 		enteredStyling++;
 		bool didChange = false;
-		int startMod = 0;
-		int endMod = 0;
-		for (int iPos = 0; iPos < length; iPos++, endStyled++) {
+		Sci::Position startMod = 0;
+		Sci::Position endMod = 0;
+		for (Sci::Position iPos = 0; iPos < length; iPos++, endStyled++) {
 			PLATFORM_ASSERT(endStyled < Length());
 			if (cb.SetStyleAt(endStyled, styles[iPos])) {
 				if (!didChange) {
@@ -2061,12 +2490,11 @@ bool SCI_METHOD Document::SetStyles(Sci_Position length, const char *styles) {
 	}
 }
 
-void Document::EnsureStyledTo(int pos) {
+void Document::EnsureStyledTo(Sci::Position pos) {
 	if ((enteredStyling == 0) && (pos > GetEndStyled())) {
-		IncrementStyleClock();
 		if (pli && !pli->UseContainerLexing()) {
-			int lineEndStyled = LineFromPosition(GetEndStyled());
-			int endStyledTo = LineStart(lineEndStyled);
+			Sci::Line lineEndStyled = LineFromPosition(GetEndStyled());
+			Sci::Position endStyledTo = LineStart(lineEndStyled);
 			pli->Colourise(endStyledTo, pos);
 		} else {
 			// Ask the watchers to style, and stop as soon as one responds.
@@ -2078,7 +2506,7 @@ void Document::EnsureStyledTo(int pos) {
 	}
 }
 
-void Document::StyleToAdjustingLineDuration(int pos) {
+void Document::StyleToAdjustingLineDuration(Sci::Position pos) {
 	// Place bounds on the duration used to avoid glitches spiking it
 	// and so causing slow styling or non-responsive scrolling
 	const double minDurationOneLine = 0.000001;
@@ -2134,43 +2562,43 @@ void SCI_METHOD Document::ChangeLexerState(Sci_Position start, Sci_Position end)
 	NotifyModified(mh);
 }
 
-StyledText Document::MarginStyledText(int line) const {
+StyledText Document::MarginStyledText(Sci::Line line) const {
 	LineAnnotation *pla = static_cast<LineAnnotation *>(perLineData[ldMargin]);
 	return StyledText(pla->Length(line), pla->Text(line),
 		pla->MultipleStyles(line), pla->Style(line), pla->Styles(line));
 }
 
-void Document::MarginSetText(int line, const char *text) {
+void Document::MarginSetText(Sci::Line line, const char *text) {
 	static_cast<LineAnnotation *>(perLineData[ldMargin])->SetText(line, text);
 	DocModification mh(SC_MOD_CHANGEMARGIN, LineStart(line), 0, 0, 0, line);
 	NotifyModified(mh);
 }
 
-void Document::MarginSetStyle(int line, int style) {
+void Document::MarginSetStyle(Sci::Line line, int style) {
 	static_cast<LineAnnotation *>(perLineData[ldMargin])->SetStyle(line, style);
 	NotifyModified(DocModification(SC_MOD_CHANGEMARGIN, LineStart(line), 0, 0, 0, line));
 }
 
-void Document::MarginSetStyles(int line, const unsigned char *styles) {
+void Document::MarginSetStyles(Sci::Line line, const unsigned char *styles) {
 	static_cast<LineAnnotation *>(perLineData[ldMargin])->SetStyles(line, styles);
 	NotifyModified(DocModification(SC_MOD_CHANGEMARGIN, LineStart(line), 0, 0, 0, line));
 }
 
 void Document::MarginClearAll() {
-	int maxEditorLine = LinesTotal();
-	for (int l=0; l<maxEditorLine; l++)
+	Sci::Line maxEditorLine = LinesTotal();
+	for (Sci::Line l=0; l<maxEditorLine; l++)
 		MarginSetText(l, 0);
 	// Free remaining data
 	static_cast<LineAnnotation *>(perLineData[ldMargin])->ClearAll();
 }
 
-StyledText Document::AnnotationStyledText(int line) const {
+StyledText Document::AnnotationStyledText(Sci::Line line) const {
 	LineAnnotation *pla = static_cast<LineAnnotation *>(perLineData[ldAnnotation]);
 	return StyledText(pla->Length(line), pla->Text(line),
 		pla->MultipleStyles(line), pla->Style(line), pla->Styles(line));
 }
 
-void Document::AnnotationSetText(int line, const char *text) {
+void Document::AnnotationSetText(Sci::Line line, const char *text) {
 	if (line >= 0 && line < LinesTotal()) {
 		const int linesBefore = AnnotationLines(line);
 		static_cast<LineAnnotation *>(perLineData[ldAnnotation])->SetText(line, text);
@@ -2181,34 +2609,30 @@ void Document::AnnotationSetText(int line, const char *text) {
 	}
 }
 
-void Document::AnnotationSetStyle(int line, int style) {
+void Document::AnnotationSetStyle(Sci::Line line, int style) {
 	static_cast<LineAnnotation *>(perLineData[ldAnnotation])->SetStyle(line, style);
 	DocModification mh(SC_MOD_CHANGEANNOTATION, LineStart(line), 0, 0, 0, line);
 	NotifyModified(mh);
 }
 
-void Document::AnnotationSetStyles(int line, const unsigned char *styles) {
+void Document::AnnotationSetStyles(Sci::Line line, const unsigned char *styles) {
 	if (line >= 0 && line < LinesTotal()) {
 		static_cast<LineAnnotation *>(perLineData[ldAnnotation])->SetStyles(line, styles);
 	}
 }
 
-int Document::AnnotationLines(int line) const {
+int Document::AnnotationLines(Sci::Line line) const {
 	return static_cast<LineAnnotation *>(perLineData[ldAnnotation])->Lines(line);
 }
 
 void Document::AnnotationClearAll() {
-	int maxEditorLine = LinesTotal();
-	for (int l=0; l<maxEditorLine; l++)
+	Sci::Line maxEditorLine = LinesTotal();
+	for (Sci::Line l=0; l<maxEditorLine; l++)
 		AnnotationSetText(l, 0);
 	// Free remaining data
 	static_cast<LineAnnotation *>(perLineData[ldAnnotation])->ClearAll();
 }
 
-void Document::IncrementStyleClock() {
-	styleClock = (styleClock + 1) % 0x100000;
-}
-
 void SCI_METHOD Document::DecorationFillRange(Sci_Position position, int value, Sci_Position fillLength) {
 	if (decorations.FillRange(position, value, fillLength)) {
 		DocModification mh(SC_MOD_CHANGEINDICATOR | SC_PERFORMED_USER,
@@ -2217,6 +2641,23 @@ void SCI_METHOD Document::DecorationFillRange(Sci_Position position, int value,
 	}
 }
 
+// Fill each of a sorted set of ranges then notify once over the whole extent.
+void Document::DecorationFillRanges(const std::vector<Range> &ranges, int value) {
+	bool changed = false;
+	for (std::vector<Range>::const_iterator it = ranges.begin(); it != ranges.end(); ++it) {
+		Sci::Position position = it->start;
+		Sci::Position fillLength = it->end - it->start;
+		if (decorations.FillRange(position, value, fillLength))
+			changed = true;
+	}
+	if (changed) {
+		const Sci::Position position = ranges.front().start;
+		DocModification mh(SC_MOD_CHANGEINDICATOR | SC_PERFORMED_USER,
+							position, ranges.back().end - position);
+		NotifyModified(mh);
+	}
+}
+
 bool Document::AddWatcher(DocWatcher *watcher, void *userData) {
 	WatcherWithUserData wwud(watcher, userData);
 	std::vector<WatcherWithUserData>::iterator it =
@@ -2305,7 +2746,7 @@ bool Document::IsWordPartSeparator(unsigned int ch) const {
 	return (WordCharacterClass(ch) == CharClassify::ccWord) && IsASCIIPunctuationCharacter(ch);
 }
 
-int Document::WordPartLeft(int pos) const {
+Sci::Position Document::WordPartLeft(Sci::Position pos) const {
 	if (pos > 0) {
 		pos -= CharacterBefore(pos).widthBytes;
 		CharacterExtracted ceStart = CharacterAfter(pos);
@@ -2355,9 +2796,9 @@ int Document::WordPartLeft(int pos) const {
 	return pos;
 }
 
-int Document::WordPartRight(int pos) const {
+Sci::Position Document::WordPartRight(Sci::Position pos) const {
 	CharacterExtracted ceStart = CharacterAfter(pos);
-	const int length = Length();
+	const Sci::Position length = Length();
 	if (IsWordPartSeparator(ceStart.character)) {
 		while (pos < length && IsWordPartSeparator(CharacterAfter(pos).character))
 			pos += CharacterAfter(pos).widthBytes;
@@ -2399,7 +2840,7 @@ static bool IsLineEndChar(char c) {
 	return (c == '\n' || c == '\r');
 }
 
-int Document::ExtendStyleRange(int pos, int delta, bool singleLine) {
+Sci::Position Document::ExtendStyleRange(Sci::Position pos, int delta, bool singleLine) {
 	int sStart = cb.StyleAt(pos);
 	if (delta < 0) {
 		while (pos > 0 && (cb.StyleAt(pos) == sStart) && (!singleLine || !IsLineEndChar(cb.CharAt(pos))))
@@ -2436,7 +2877,7 @@ static char BraceOpposite(char ch) {
 }
 
 // TODO: should be able to extend styled region to find matching brace
-int Document::BraceMatch(int position, int /*maxReStyle*/) {
+Sci::Position Document::BraceMatch(Sci::Position position, int /*maxReStyle*/) {
 	char chBrace = CharAt(position);
 	char chSeek = BraceOpposite(chBrace);
 	if (chSeek == '\0')
@@ -2458,7 +2899,7 @@ int Document::BraceMatch(int position, int /*maxReStyle*/) {
 			if (depth == 0)
 				return position;
 		}
-		int positionBeforeMove = position;
+		Sci::Position positionBeforeMove = position;
 		position = NextPosition(position, direction);
 		if (position == positionBeforeMove)
 			break;
@@ -2469,22 +2910,88 @@ int Document::BraceMatch(int position, int /*maxReStyle*/) {
 /**
  * Implementation of RegexSearchBase for the default built-in regular expression engine
  */
+namespace {
+
+/**
+ * A compiled regular expression along with the options that affected its compilation.
+ * Only the form for the engine selected by SCFIND_CXX11REGEX or SCFIND_MULTILINE in flags is filled in.
+ */
+struct CompiledRegex {
+	std::string pattern;
+	int flags;
+	int codePage;
+	int charClassVersion;
+	std::string automaton;
+	MultilineRegex multiline;
+#ifndef NO_CXX11_REGEX
+	std::regex regexp;
+	std::wregex wregexp;
+#endif
+	CompiledRegex(const std::string &pattern_, int flags_, int codePage_, int charClassVersion_) :
+		pattern(pattern_), flags(flags_), codePage(codePage_), charClassVersion(charClassVersion_) {
+	}
+	bool Matches(const std::string &pattern_, int flags_, int codePage_, int charClassVersion_) const {
+		return (flags == flags_) && (codePage == codePage_) && (charClassVersion == charClassVersion_) &&
+			(pattern == pattern_);
+	}
+};
+
+/**
+ * Least recently used cache of compiled regular expressions so that repeated searches
+ * for the same pattern, as when finding next or replacing all, skip compilation.
+ */
+class RegexCache {
+	enum { maxEntries = 8 };
+	std::vector<CompiledRegex> entries;	// Most recently used first
+	int hits;
+	int misses;
+public:
+	RegexCache() : hits(0), misses(0) {
+	}
+	CompiledRegex *Find(const std::string &pattern, int flags, int codePage, int charClassVersion) {
+		for (size_t i = 0; i < entries.size(); i++) {
+			if (entries[i].Matches(pattern, flags, codePage, charClassVersion)) {
+				std::rotate(entries.begin(), entries.begin() + i, entries.begin() + i + 1);
+				hits++;
+				return &entries[0];
+			}
+		}
+		misses++;
+		return 0;
+	}
+	CompiledRegex &Add(const std::string &pattern, int flags, int codePage, int charClassVersion) {
+		if (entries.size() >= maxEntries)
+			entries.pop_back();
+		entries.insert(entries.begin(), CompiledRegex(pattern, flags, codePage, charClassVersion));
+		return entries[0];
+	}
+	int Count(bool hits_) const {
+		return hits_ ? hits : misses;
+	}
+};
+
+}
+
 class BuiltinRegex : public RegexSearchBase {
 public:
-	explicit BuiltinRegex(CharClassify *charClassTable) : search(charClassTable) {}
+	explicit BuiltinRegex(CharClassify *charClassTable) : charClass(charClassTable), search(charClassTable) {}
 
 	virtual ~BuiltinRegex() {
 	}
 
-	virtual long FindText(Document *doc, int minPos, int maxPos, const char *s,
+	virtual Sci::Position FindText(Document *doc, Sci::Position minPos, Sci::Position maxPos, const char *s,
                         bool caseSensitive, bool word, bool wordStart, int flags,
-                        int *length);
+                        Sci::Position *length);
+
+	virtual const char *SubstituteByPosition(Document *doc, const char *text, Sci::Position *length);
 
-	virtual const char *SubstituteByPosition(Document *doc, const char *text, int *length);
+	virtual int CacheCount(bool hits) const;
 
 private:
+	CharClassify *charClass;
 	RESearch search;
 	std::string substituted;
+	RegexCache cache;
 };
 
 namespace {
@@ -2495,13 +3002,13 @@ namespace {
 class RESearchRange {
 public:
 	const Document *doc;
-	int increment;
-	int startPos;
-	int endPos;
-	int lineRangeStart;
-	int lineRangeEnd;
-	int lineRangeBreak;
-	RESearchRange(const Document *doc_, int minPos, int maxPos) : doc(doc_) {
+	Sci::Position increment;
+	Sci::Position startPos;
+	Sci::Position endPos;
+	Sci::Line lineRangeStart;
+	Sci::Line lineRangeEnd;
+	Sci::Line lineRangeBreak;
+	RESearchRange(const Document *doc_, Sci::Position minPos, Sci::Position maxPos) : doc(doc_) {
 		increment = (minPos <= maxPos) ? 1 : -1;
 
 		// Range endpoints should not be inside DBCS characters, but just in case, move them.
@@ -2525,7 +3032,7 @@ public:
 		}
 		lineRangeBreak = lineRangeEnd + increment;
 	}
-	Range LineRange(int line) const {
+	Range LineRange(Sci::Line line) const {
 		Range range(doc->LineStart(line), doc->LineEnd(line));
 		if (increment == 1) {
 			if (line == lineRangeStart)
@@ -2545,16 +3052,16 @@ public:
 // Define a way for the Regular Expression code to access the document
 class DocumentIndexer : public CharacterIndexer {
 	Document *pdoc;
-	int end;
+	Sci::Position end;
 public:
-	DocumentIndexer(Document *pdoc_, int end_) :
+	DocumentIndexer(Document *pdoc_, Sci::Position end_) :
 		pdoc(pdoc_), end(end_) {
 	}
 
 	virtual ~DocumentIndexer() {
 	}
 
-	virtual char CharAt(int index) {
+	virtual char CharAt(Sci::Position index) {
 		if (index < 0 || index >= end)
 			return 0;
 		else
@@ -2567,8 +3074,8 @@ public:
 class ByteIterator : public std::iterator<std::bidirectional_iterator_tag, char> {
 public:
 	const Document *doc;
-	Position position;
-	ByteIterator(const Document *doc_ = 0, Position position_ = 0) : doc(doc_), position(position_) {
+	Sci::Position position;
+	ByteIterator(const Document *doc_ = 0, Sci::Position position_ = 0) : doc(doc_), position(position_) {
 	}
 	ByteIterator(const ByteIterator &other) {
 		doc = other.doc;
@@ -2603,10 +3110,10 @@ public:
 	bool operator!=(const ByteIterator &other) const {
 		return doc != other.doc || position != other.position;
 	}
-	int Pos() const {
+	Sci::Position Pos() const {
 		return position;
 	}
-	int PosRoundUp() const {
+	Sci::Position PosRoundUp() const {
 		return position;
 	}
 };
@@ -2630,14 +3137,14 @@ public:
 class UTF8Iterator : public std::iterator<std::bidirectional_iterator_tag, wchar_t> {
 	// These 3 fields determine the iterator position and are used for comparisons
 	const Document *doc;
-	Position position;
+	Sci::Position position;
 	size_t characterIndex;
 	// Remaining fields are derived from the determining fields so are excluded in comparisons
 	unsigned int lenBytes;
 	size_t lenCharacters;
 	wchar_t buffered[2];
 public:
-	UTF8Iterator(const Document *doc_ = 0, Position position_ = 0) :
+	UTF8Iterator(const Document *doc_ = 0, Sci::Position position_ = 0) :
 		doc(doc_), position(position_), characterIndex(0), lenBytes(0), lenCharacters(0) {
 		buffered[0] = 0;
 		buffered[1] = 0;
@@ -2713,10 +3220,10 @@ public:
 			position != other.position ||
 			characterIndex != other.characterIndex;
 	}
-	int Pos() const {
+	Sci::Position Pos() const {
 		return position;
 	}
-	int PosRoundUp() const {
+	Sci::Position PosRoundUp() const {
 		if (characterIndex)
 			return position + lenBytes;	// Force to end of character
 		else
@@ -2741,9 +3248,9 @@ private:
 
 class UTF8Iterator : public std::iterator<std::bidirectional_iterator_tag, wchar_t> {
 	const Document *doc;
-	Position position;
+	Sci::Position position;
 public:
-	UTF8Iterator(const Document *doc_=0, Position position_=0) : doc(doc_), position(position_) {
+	UTF8Iterator(const Document *doc_=0, Sci::Position position_=0) : doc(doc_), position(position_) {
 	}
 	UTF8Iterator(const UTF8Iterator &other) {
 		doc = other.doc;
@@ -2779,17 +3286,17 @@ public:
 	bool operator!=(const UTF8Iterator &other) const {
 		return doc != other.doc || position != other.position;
 	}
-	int Pos() const {
+	Sci::Position Pos() const {
 		return position;
 	}
-	int PosRoundUp() const {
+	Sci::Position PosRoundUp() const {
 		return position;
 	}
 };
 
 #endif
 
-std::regex_constants::match_flag_type MatchFlags(const Document *doc, int startPos, int endPos) {
+std::regex_constants::match_flag_type MatchFlags(const Document *doc, Sci::Position startPos, Sci::Position endPos) {
 	std::regex_constants::match_flag_type flagsMatch = std::regex_constants::match_default;
 	if (!doc->IsLineStartPosition(startPos))
 		flagsMatch |= std::regex_constants::match_not_bol;
@@ -2812,7 +3319,7 @@ bool MatchOnLines(const Document *doc, const Regex &regexp, const RESearchRange
 	//	matched = std::regex_search(uiStart, uiEnd, match, regexp, flagsMatch);
 
 	// Line by line.
-	for (int line = resr.lineRangeStart; line != resr.lineRangeBreak; line += resr.increment) {
+	for (Sci::Line line = resr.lineRangeStart; line != resr.lineRangeBreak; line += resr.increment) {
 		const Range lineRange = resr.LineRange(line);
 		Iterator itStart(doc, lineRange.start);
 		Iterator itEnd(doc, lineRange.end);
@@ -2853,48 +3360,67 @@ bool MatchOnLines(const Document *doc, const Regex &regexp, const RESearchRange
 	return matched;
 }
 
-long Cxx11RegexFindText(Document *doc, int minPos, int maxPos, const char *s,
-	bool caseSensitive, int *length, RESearch &search) {
+// Fill in compiled with the std::regex or, for UTF-8, std::wregex for s.
+// Throws std::regex_error for an invalid expression.
+void Cxx11RegexCompile(CompiledRegex &compiled, const Document *doc, const char *s, bool caseSensitive) {
+	std::regex::flag_type flagsRe = std::regex::ECMAScript;
+	// Flags that apper to have no effect:
+	// | std::regex::collate | std::regex::extended;
+	if (!caseSensitive)
+		flagsRe = flagsRe | std::regex::icase;
+
+	if (SC_CP_UTF8 == doc->dbcsCodePage) {
+		unsigned int lenS = static_cast<unsigned int>(strlen(s));
+		std::vector<wchar_t> ws(lenS + 1);
+#if WCHAR_T_IS_16
+		size_t outLen = UTF16FromUTF8(s, lenS, &ws[0], lenS);
+#else
+		size_t outLen = UTF32FromUTF8(s, lenS, reinterpret_cast<unsigned int *>(&ws[0]), lenS);
+#endif
+		ws[outLen] = 0;
+		std::wregex regexp;
+#if defined(__APPLE__)
+		// Using a UTF-8 locale doesn't change to Unicode over a byte buffer so '.'
+		// is one byte not one character.
+		// However, on OS X this makes wregex act as Unicode
+		std::locale localeU("en_US.UTF-8");
+		regexp.imbue(localeU);
+#endif
+		regexp.assign(&ws[0], flagsRe);
+		compiled.wregexp.swap(regexp);
+	} else {
+		std::regex regexp;
+		regexp.assign(s, flagsRe);
+		compiled.regexp.swap(regexp);
+	}
+}
+
+Sci::Position Cxx11RegexFindText(Document *doc, Sci::Position minPos, Sci::Position maxPos, const char *s,
+	bool caseSensitive, int flags, Sci::Position *length, RESearch &search, RegexCache &cache, int charClassVersion) {
 	const RESearchRange resr(doc, minPos, maxPos);
 	try {
 		//ElapsedTime et;
-		std::regex::flag_type flagsRe = std::regex::ECMAScript;
-		// Flags that apper to have no effect:
-		// | std::regex::collate | std::regex::extended;
-		if (!caseSensitive)
-			flagsRe = flagsRe | std::regex::icase;
+		const std::string pattern(s);
+		CompiledRegex *compiled = cache.Find(pattern, flags, doc->dbcsCodePage, charClassVersion);
+		if (!compiled) {
+			CompiledRegex compiledNew(pattern, flags, doc->dbcsCodePage, charClassVersion);
+			Cxx11RegexCompile(compiledNew, doc, s, caseSensitive);
+			compiled = &cache.Add(pattern, flags, doc->dbcsCodePage, charClassVersion);
+			compiled->regexp.swap(compiledNew.regexp);
+			compiled->wregexp.swap(compiledNew.wregexp);
+		}
 
 		// Clear the RESearch so can fill in matches
 		search.Clear();
 
 		bool matched = false;
 		if (SC_CP_UTF8 == doc->dbcsCodePage) {
-			unsigned int lenS = static_cast<unsigned int>(strlen(s));
-			std::vector<wchar_t> ws(lenS + 1);
-#if WCHAR_T_IS_16
-			size_t outLen = UTF16FromUTF8(s, lenS, &ws[0], lenS);
-#else
-			size_t outLen = UTF32FromUTF8(s, lenS, reinterpret_cast<unsigned int *>(&ws[0]), lenS);
-#endif
-			ws[outLen] = 0;
-			std::wregex regexp;
-#if defined(__APPLE__)
-			// Using a UTF-8 locale doesn't change to Unicode over a byte buffer so '.'
-			// is one byte not one character.
-			// However, on OS X this makes wregex act as Unicode
-			std::locale localeU("en_US.UTF-8");
-			regexp.imbue(localeU);
-#endif
-			regexp.assign(&ws[0], flagsRe);
-			matched = MatchOnLines<UTF8Iterator>(doc, regexp, resr, search);
-
+			matched = MatchOnLines<UTF8Iterator>(doc, compiled->wregexp, resr, search);
 		} else {
-			std::regex regexp;
-			regexp.assign(s, flagsRe);
-			matched = MatchOnLines<ByteIterator>(doc, regexp, resr, search);
+			matched = MatchOnLines<ByteIterator>(doc, compiled->regexp, resr, search);
 		}
 
-		int posMatch = -1;
+		Sci::Position posMatch = -1;
 		if (matched) {
 			posMatch = search.bopat[0];
 			*length = search.eopat[0] - search.bopat[0];
@@ -2916,38 +3442,59 @@ long Cxx11RegexFindText(Document *doc, int minPos, int maxPos, const char *s,
 
 #endif
 
-}
-
-long BuiltinRegex::FindText(Document *doc, int minPos, int maxPos, const char *s,
-                        bool caseSensitive, bool, bool, int flags,
-                        int *length) {
-
-#ifndef NO_CXX11_REGEX
-	if (flags & SCFIND_CXX11REGEX) {
-			return Cxx11RegexFindText(doc, minPos, maxPos, s,
-			caseSensitive, length, search);
+// Search the whole range at once so matches may include line ends.
+Sci::Position MultilineRegexFindText(Document *doc, Sci::Position minPos, Sci::Position maxPos, const char *s,
+	bool caseSensitive, int flags, Sci::Position *length, RESearch &search, RegexCache &cache, const CharClassify *charClass) {
+	const std::string pattern(s, *length);
+	CompiledRegex *compiled = cache.Find(pattern, flags, doc->dbcsCodePage, charClass->Version());
+	if (!compiled) {
+		MultilineRegex multiline;
+		const char *errmsg = multiline.Compile(s, *length, caseSensitive, (flags & SCFIND_POSIX) != 0, charClass);
+		if (errmsg) {
+			return -1;
+		}
+		compiled = &cache.Add(pattern, flags, doc->dbcsCodePage, charClass->Version());
+		compiled->multiline = multiline;
+	}
+	MultilineRegex &regex = compiled->multiline;
+
+	search.Clear();
+	const GapText text = doc->TextAroundGap();
+	const bool forward = minPos <= maxPos;
+	const Sci::Position startPos = forward ? minPos : maxPos;
+	const Sci::Position endPos = forward ? maxPos : minPos;
+	bool found = regex.Execute(text, startPos, endPos);
+	while (found) {
+		std::copy(regex.bopat, regex.bopat + MultilineRegex::MAXTAG, search.bopat);
+		std::copy(regex.eopat, regex.eopat + MultilineRegex::MAXTAG, search.eopat);
+		if (forward || (search.bopat[0] >= endPos))
+			break;
+		// Backwards finds the last match by searching again after each match
+		found = regex.Execute(text, doc->MovePositionOutsideChar(search.bopat[0] + 1, 1, false), endPos);
 	}
-#endif
-
-	const RESearchRange resr(doc, minPos, maxPos);
-
-	const bool posix = (flags & SCFIND_POSIX) != 0;
-
-	const char *errmsg = search.Compile(s, *length, caseSensitive, posix);
-	if (errmsg) {
+	if (search.bopat[0] == RESearch::NOTFOUND) {
+		*length = 0;
 		return -1;
 	}
-	// Find a variable in a property file: \$(\([A-Za-z0-9_.]+\))
-	// Replace first '.' with '-' in each property file variable reference:
-	//     Search: \$(\([A-Za-z0-9_-]+\)\.\([A-Za-z0-9_.]+\))
-	//     Replace: $(\1-\2)
-	int pos = -1;
-	int lenRet = 0;
-	const char searchEnd = s[*length - 1];
-	const char searchEndPrev = (*length > 1) ? s[*length - 2] : '\0';
-	for (int line = resr.lineRangeStart; line != resr.lineRangeBreak; line += resr.increment) {
-		int startOfLine = doc->LineStart(line);
-		int endOfLine = doc->LineEnd(line);
+	// Ensure only whole characters selected
+	search.eopat[0] = doc->MovePositionOutsideChar(search.eopat[0], 1, false);
+	*length = search.eopat[0] - search.bopat[0];
+	return search.bopat[0];
+}
+
+/**
+ * Search the lines from lineFirst up to lineBreak, in the direction of resr, with the expression
+ * compiled into search.
+ * @return The position of the first match in that direction, with its length in lenRet, or -1.
+ */
+Sci::Position SearchLines(Document *doc, const RESearchRange &resr, Sci::Line lineFirst, Sci::Line lineBreak,
+	RESearch &search, const char *s, Sci::Position lengthSearch, Sci::Position minPos, Sci::Position &lenRet) {
+	Sci::Position pos = -1;
+	const char searchEnd = s[lengthSearch - 1];
+	const char searchEndPrev = (lengthSearch > 1) ? s[lengthSearch - 2] : '\0';
+	for (Sci::Line line = lineFirst; line != lineBreak; line += resr.increment) {
+		Sci::Position startOfLine = doc->LineStart(line);
+		Sci::Position endOfLine = doc->LineEnd(line);
 		if (resr.increment == 1) {
 			if (line == resr.lineRangeStart) {
 				if ((resr.startPos != startOfLine) && (s[0] == '^'))
@@ -2998,19 +3545,101 @@ long BuiltinRegex::FindText(Document *doc, int minPos, int maxPos, const char *s
 			break;
 		}
 	}
+	return pos;
+}
+
+}
+
+Sci::Position BuiltinRegex::FindText(Document *doc, Sci::Position minPos, Sci::Position maxPos, const char *s,
+                        bool caseSensitive, bool, bool, int flags,
+                        Sci::Position *length) {
+
+	// Only these flags change how an expression is compiled
+	const int flagsCompile = flags & (SCFIND_MATCHCASE | SCFIND_POSIX | SCFIND_CXX11REGEX | SCFIND_MULTILINE);
+
+#ifndef NO_CXX11_REGEX
+	if (flags & SCFIND_CXX11REGEX) {
+			return Cxx11RegexFindText(doc, minPos, maxPos, s,
+			caseSensitive, flagsCompile, length, search, cache, charClass->Version());
+	}
+#endif
+
+	if (flags & SCFIND_MULTILINE) {
+		return MultilineRegexFindText(doc, minPos, maxPos, s,
+			caseSensitive, flagsCompile, length, search, cache, charClass);
+	}
+
+	const RESearchRange resr(doc, minPos, maxPos);
+
+	const bool posix = (flags & SCFIND_POSIX) != 0;
+
+	// An empty pattern reuses the previous expression so is neither looked up nor cached
+	const std::string pattern(s, *length);
+	const CompiledRegex *compiled = pattern.empty() ? 0 :
+		cache.Find(pattern, flagsCompile, doc->dbcsCodePage, charClass->Version());
+	if (compiled) {
+		search.SetAutomaton(compiled->automaton);
+	} else {
+		const char *errmsg = search.Compile(s, *length, caseSensitive, posix);
+		if (errmsg) {
+			return -1;
+		}
+		if (!pattern.empty())
+			cache.Add(pattern, flagsCompile, doc->dbcsCodePage, charClass->Version()).automaton = search.Automaton();
+	}
+	// Find a variable in a property file: \$(\([A-Za-z0-9_.]+\))
+	// Replace first '.' with '-' in each property file variable reference:
+	//     Search: \$(\([A-Za-z0-9_-]+\)\.\([A-Za-z0-9_.]+\))
+	//     Replace: $(\1-\2)
+	Sci::Position pos = -1;
+	Sci::Position lenRet = 0;
+#ifndef NO_CXX11_THREADS
+	const Sci::Line lines = (resr.lineRangeBreak - resr.lineRangeStart) * resr.increment;
+	const Sci::Position lengthRange = (resr.endPos - resr.startPos) * resr.increment;
+	const Sci::Line chunksWanted = (flags & SCFIND_PARALLEL) ? std::min<Sci::Line>(lines, SearchChunks(lengthRange)) : 1;
+	if (chunksWanted > 1) {
+		// Each chunk of lines is searched with its own copy of the compiled expression
+		const Sci::Line linesChunk = (lines + chunksWanted - 1) / chunksWanted;
+		const int chunks = static_cast<int>((lines + linesChunk - 1) / linesChunk);
+		std::vector<RESearch> searches(chunks, search);
+		std::vector<Sci::Position> positions(chunks, -1);
+		std::vector<Sci::Position> lengths(chunks, 0);
+		const Sci::Position lengthSearch = *length;
+		const int earliest = SearchInParallel(chunks, [&](int chunk) {
+			const Sci::Line lineFirst = resr.lineRangeStart + chunk * linesChunk * resr.increment;
+			const Sci::Line lineBreak = resr.lineRangeStart +
+				std::min(lines, (chunk + 1) * linesChunk) * resr.increment;
+			positions[chunk] = SearchLines(doc, resr, lineFirst, lineBreak, searches[chunk], s, lengthSearch,
+				minPos, lengths[chunk]);
+			return positions[chunk] >= 0;
+		});
+		if (earliest >= 0) {
+			search = searches[earliest];
+			pos = positions[earliest];
+			lenRet = lengths[earliest];
+		}
+	} else
+#endif
+	{
+		pos = SearchLines(doc, resr, resr.lineRangeStart, resr.lineRangeBreak, search, s, *length, minPos, lenRet);
+	}
 	*length = lenRet;
 	return pos;
 }
 
-const char *BuiltinRegex::SubstituteByPosition(Document *doc, const char *text, int *length) {
+int BuiltinRegex::CacheCount(bool hits) const {
+	return cache.Count(hits);
+}
+
+const char *BuiltinRegex::SubstituteByPosition(Document *doc, const char *text, Sci::Position *length) {
 	substituted.clear();
 	DocumentIndexer di(doc, doc->Length());
 	search.GrabMatches(di);
-	for (int j = 0; j < *length; j++) {
+	for (Sci::Position j = 0; j < *length; j++) {
 		if (text[j] == '\\') {
 			if (text[j + 1] >= '0' && text[j + 1] <= '9') {
 				unsigned int patNum = text[j + 1] - '0';
-				unsigned int len = search.eopat[patNum] - search.bopat[patNum];
+				const Sci::Position len = search.eopat[patNum] - search.bopat[patNum];
 				if (!search.pat[patNum].empty())	// Will be null if try for a match that did not occur
 					substituted.append(search.pat[patNum].c_str(), len);
 				j++;
@@ -3050,7 +3679,7 @@ const char *BuiltinRegex::SubstituteByPosition(Document *doc, const char *text,
 			substituted.push_back(text[j]);
 		}
 	}
-	*length = static_cast<int>(substituted.length());
+	*length = static_cast<Sci::Position>(substituted.length());
 	return substituted.c_str();
 }
 
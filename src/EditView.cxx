@@ -252,6 +252,7 @@ int EditView::GetNextTabstop(int line, int x) const {
 }
 
 void EditView::LinesAddedOrRemoved(int lineOfPos, int linesAdded) {
+	llc.LinesAddedOrRemoved(lineOfPos, linesAdded);
 	if (ldTabstops) {
 		if (linesAdded > 0) {
 			for (int line = lineOfPos; line < lineOfPos + linesAdded; line++) {
@@ -347,16 +348,21 @@ LineLayout *EditView::RetrieveLineLayout(int lineNumber, const EditModel &model)
 	PLATFORM_ASSERT(posLineEnd >= posLineStart);
 	int lineCaret = model.pdoc->LineFromPosition(model.sel.MainCaret());
 	return llc.Retrieve(lineNumber, lineCaret,
-		posLineEnd - posLineStart, model.pdoc->GetStyleClock(),
-		model.LinesOnScreen() + 1, model.pdoc->LinesTotal());
+		posLineEnd - posLineStart, model.LinesOnScreen() + 1);
+}
+
+void EditView::LayoutLine(const EditModel &model, int line, Surface *surface, const ViewStyle &vstyle, LineLayout *ll, int width) {
+	LayoutLine(model, line, surface, vstyle, ll, width, posCache);
 }
 
 /**
 * Fill in the LineLayout data for the given line.
 * Copy the given @a line and its styles from the document into local arrays.
 * Also determine the x position at which each character starts.
+* Measurements go through @a cache so that other threads can lay out lines with their own caches.
 */
-void EditView::LayoutLine(const EditModel &model, int line, Surface *surface, const ViewStyle &vstyle, LineLayout *ll, int width) {
+void EditView::LayoutLine(const EditModel &model, int line, Surface *surface, const ViewStyle &vstyle, LineLayout *ll, int width,
+	PositionCache &cache) {
 	if (!ll)
 		return;
 
@@ -480,7 +486,7 @@ void EditView::LayoutLine(const EditModel &model, int line, Surface *surface, co
 					} else {
 						if (representationWidth <= 0.0) {
 							XYPOSITION positionsRepr[256];	// Should expand when needed
-							posCache.MeasureWidths(surface, vstyle, STYLE_CONTROLCHAR, ts.representation->stringRep.c_str(),
+							cache.MeasureWidths(surface, vstyle, STYLE_CONTROLCHAR, ts.representation->stringRep.c_str(),
 								static_cast<unsigned int>(ts.representation->stringRep.length()), positionsRepr, model.pdoc);
 							representationWidth = positionsRepr[ts.representation->stringRep.length() - 1] + vstyle.ctrlCharPadding;
 						}
@@ -492,7 +498,7 @@ void EditView::LayoutLine(const EditModel &model, int line, Surface *surface, co
 						// Over half the segments are single characters and of these about half are space characters.
 						ll->positions[ts.start + 1] = vstyle.styles[ll->styles[ts.start]].spaceWidth;
 					} else {
-						posCache.MeasureWidths(surface, vstyle, ll->styles[ts.start], ll->chars + ts.start,
+						cache.MeasureWidths(surface, vstyle, ll->styles[ts.start], ll->chars + ts.start,
 							ts.length, ll->positions + ts.start + 1, model.pdoc);
 					}
 				}
@@ -988,7 +994,7 @@ static void DrawIndicators(Surface *surface, const EditModel &model, const ViewS
 			}
 			while ((startPos < posLineEnd) && (deco->rs.ValueAt(startPos))) {
 				const Range rangeRun(deco->rs.StartRun(startPos), deco->rs.EndRun(startPos));
-				const int endPos = std::min(rangeRun.end, posLineEnd);
+				const int endPos = static_cast<int>(std::min<Sci::Position>(rangeRun.end, posLineEnd));
 				const bool hover = vsDraw.indicators[deco->indicator].IsDynamic() &&
 					rangeRun.ContainsCharacter(hoverIndicatorPos);
 				const int value = deco->rs.ValueAt(startPos);
@@ -110,6 +110,8 @@ public:
 	LineLayout *RetrieveLineLayout(int lineNumber, const EditModel &model);
 	void LayoutLine(const EditModel &model, int line, Surface *surface, const ViewStyle &vstyle,
 		LineLayout *ll, int width = LineLayout::wrapWidthInfinite);
+	void LayoutLine(const EditModel &model, int line, Surface *surface, const ViewStyle &vstyle,
+		LineLayout *ll, int width, PositionCache &cache);
 
 	Point LocationFromPosition(Surface *surface, const EditModel &model, SelectionPosition pos, int topLine, const ViewStyle &vs);
 	SelectionPosition SPositionFromLocation(Surface *surface, const EditModel &model, Point pt, bool canReturnInvalid,
@@ -19,6 +19,14 @@
 #include <algorithm>
 #include <memory>
 
+#ifndef NO_CXX11_THREADS
+#include <functional>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#endif
+
 #include "Platform.h"
 
 #include "ILexer.h"
@@ -123,7 +131,7 @@ Editor::Editor() {
 	ptMouseLast.y = 0;
 	inDragDrop = ddNone;
 	dropWentOutside = false;
-	posDrop = SelectionPosition(invalidPosition);
+	posDrop = SelectionPosition(Sci::invalidPosition);
 	hotSpotClickPos = INVALID_POSITION;
 	selectionType = selChar;
 
@@ -184,6 +192,10 @@ Editor::Editor() {
 	recordingMacro = false;
 	foldAutomatic = 0;
 
+	wrapThreads = 1;
+	wrapWorkers = 0;
+	wrapEstimate = false;
+
 	convertPastes = true;
 
 	SetRepresentations();
@@ -243,6 +255,7 @@ void Editor::SetRepresentations() {
 }
 
 void Editor::DropGraphics(bool freeObjects) {
+	StopWrapWorkers();
 	marginView.DropGraphics(freeObjects);
 	view.DropGraphics(freeObjects);
 }
@@ -739,9 +752,9 @@ void Editor::MultipleSelectAdd(AddNumber addNumber) {
 			int searchStart = it->start;
 			const int searchEnd = it->end;
 			for (;;) {
-				int lengthFound = static_cast<int>(selectedText.length());
-				int pos = static_cast<int>(pdoc->FindText(searchStart, searchEnd,
-					selectedText.c_str(), searchFlags, &lengthFound));
+				Sci::Position lengthFound = selectedText.length();
+				const Sci::Position pos = pdoc->FindText(searchStart, searchEnd,
+					selectedText.c_str(), searchFlags, &lengthFound);
 				if (pos >= 0) {
 					sel.AddSelection(SelectionRange(pos + lengthFound, pos));
 					ScrollRange(sel.RangeMain());
@@ -815,8 +828,7 @@ void Editor::MovedCaret(SelectionPosition newPos, SelectionPosition previousPos,
 	const int currentLine = pdoc->LineFromPosition(newPos.Position());
 	if (ensureVisible) {
 		// In case in need of wrapping to ensure DisplayFromDoc works.
-		if (currentLine >= wrapPending.start)
-			WrapLines(wsAll);
+		WrapForLine(currentLine);
 		XYScrollPosition newXY = XYScrollToMakeVisible(
 			SelectionRange(posDrag.IsValid() ? posDrag : newPos), xysDefault);
 		if (previousPos.IsValid() && (newXY.xOffset == xOffset)) {
@@ -1452,7 +1464,10 @@ bool Editor::Wrapping() const {
 void Editor::NeedWrapping(int docLineStart, int docLineEnd) {
 //Platform::DebugPrintf("\nNeedWrapping: %0d..%0d\n", docLineStart, docLineEnd);
 	if (wrapPending.AddRange(docLineStart, docLineEnd)) {
-		view.llc.Invalidate(LineLayout::llPositions);
+		view.llc.InvalidateLines(docLineStart, docLineEnd, LineLayout::llPositions);
+	}
+	if (wrapEstimate) {
+		wrapEstimatePending.AddRange(docLineStart, docLineEnd);
 	}
 	// Wrap lines during idle.
 	if (Wrapping() && wrapPending.NeedsWrap()) {
@@ -1471,12 +1486,263 @@ bool Editor::WrapOneLine(Surface *surface, int lineToWrap) {
 		(vs.annotationVisible ? pdoc->AnnotationLines(lineToWrap) : 0));
 }
 
+int Editor::WrapThreads() const {
+#ifdef NO_CXX11_THREADS
+	return 1;
+#else
+	return (wrapThreads > 0) ? wrapThreads : std::max(1U, std::thread::hardware_concurrency());
+#endif
+}
+
+#ifndef NO_CXX11_THREADS
+
+#ifdef SCI_NAMESPACE
+namespace Scintilla {
+#endif
+
+/**
+ * Threads that lay out lines for WrapLinesOnThreads.
+ * Each thread has its own measuring surface, allocated on the main thread, along with a
+ * position cache and line layout. They live for a whole wrap pass, waiting between blocks.
+ */
+class WrapWorkers {
+public:
+	typedef std::function<void(Surface *surface, PositionCache &cache, LineLayout &ll)> Job;
+private:
+	std::vector<Surface *> surfaces;
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	std::condition_variable cvStart;
+	std::condition_variable cvFinish;
+	Job job;
+	unsigned int block;
+	size_t running;
+	bool stopping;
+	void Run(Surface *surface, size_t cacheSize);
+	// Private so WrapWorkers objects can not be copied
+	WrapWorkers(const WrapWorkers &);
+	WrapWorkers &operator=(const WrapWorkers &);
+public:
+	WrapWorkers(Surface *surface, int workers, size_t cacheSize);
+	~WrapWorkers();
+	int Count() const;
+	void Start(const Job &job_);
+	void Finish();
+};
+
+#ifdef SCI_NAMESPACE
+}
+#endif
+
+WrapWorkers::WrapWorkers(Surface *surface, int workers, size_t cacheSize) : block(0), running(0), stopping(false) {
+	for (int worker = 0; worker < workers; worker++) {
+		Surface *surfaceMeasure = surface->AllocateMeasuringSurface();
+		if (!surfaceMeasure)
+			break;
+		surfaces.push_back(surfaceMeasure);
+	}
+	for (std::vector<Surface *>::iterator it = surfaces.begin(); it != surfaces.end(); ++it)
+		threads.push_back(std::thread(&WrapWorkers::Run, this, *it, cacheSize));
+}
+
+WrapWorkers::~WrapWorkers() {
+	{
+		std::lock_guard<std::mutex> guard(mutex);
+		stopping = true;
+	}
+	cvStart.notify_all();
+	for (std::vector<std::thread>::iterator it = threads.begin(); it != threads.end(); ++it)
+		it->join();
+	for (std::vector<Surface *>::iterator it = surfaces.begin(); it != surfaces.end(); ++it)
+		delete *it;
+}
+
+void WrapWorkers::Run(Surface *surface, size_t cacheSize) {
+	PositionCache cache;
+	cache.SetSize(cacheSize);
+	LineLayout ll(0);
+	unsigned int blockDone = 0;
+	std::unique_lock<std::mutex> lock(mutex);
+	for (;;) {
+		cvStart.wait(lock, [&]() { return stopping || (block != blockDone); });
+		if (stopping)
+			break;
+		blockDone = block;
+		const Job jobBlock = job;
+		lock.unlock();
+		jobBlock(surface, cache, ll);
+		lock.lock();
+		if (--running == 0)
+			cvFinish.notify_one();
+	}
+}
+
+int WrapWorkers::Count() const {
+	return static_cast<int>(threads.size());
+}
+
+void WrapWorkers::Start(const Job &job_) {
+	{
+		std::lock_guard<std::mutex> guard(mutex);
+		job = job_;
+		running = threads.size();
+		block++;
+	}
+	cvStart.notify_all();
+}
+
+void WrapWorkers::Finish() {
+	std::unique_lock<std::mutex> lock(mutex);
+	cvFinish.wait(lock, [this]() { return running == 0; });
+}
+
+#endif
+
+/**
+ * Start the threads measuring lines for this wrap pass if they are not yet running.
+ * Return how many threads besides this one measure lines, 0 when the platform can not
+ * measure text on other threads.
+ */
+int Editor::StartWrapWorkers() {
+#ifndef NO_CXX11_THREADS
+	if (!wrapWorkers && (WrapThreads() > 1)) {
+		AutoSurface surface(this);
+		if (!surface)
+			return 0;
+		wrapWorkers = new WrapWorkers(surface, WrapThreads() - 1, view.posCache.GetSize());
+	}
+	return wrapWorkers ? wrapWorkers->Count() : 0;
+#else
+	return 0;
+#endif
+}
+
+void Editor::StopWrapWorkers() {
+#ifndef NO_CXX11_THREADS
+	delete wrapWorkers;
+	wrapWorkers = 0;
+#endif
+}
+
+/**
+ * Wrap a block of lines by laying them out on several threads.
+ * This thread wraps lines with WrapOneLine while each worker thread records heights
+ * that are set once all threads finish.
+ * Lines are taken in small groups so threads finishing early take more of the work.
+ * When there are no worker threads, this thread wraps every line.
+ * The document and view must not change until this returns.
+ * Return true if wrapping changed the height of any line.
+ */
+bool Editor::WrapLinesOnThreads(Surface *surface, int lineToWrap, int lineToWrapEnd) {
+	bool wrapOccurred = false;
+#ifndef NO_CXX11_THREADS
+	const int linesGroup = 32;
+	const int groups = (lineToWrapEnd - lineToWrap + linesGroup - 1) / linesGroup;
+	if ((groups > 1) && (StartWrapWorkers() > 0)) {
+		std::atomic<int> nextGroup(0);
+		// 0 for lines wrapped by this thread
+		std::vector<int> linesWrapped(lineToWrapEnd - lineToWrap, 0);
+		wrapWorkers->Start([&](Surface *surfaceMeasure, PositionCache &cache, LineLayout &ll) {
+			for (;;) {
+				const int lineGroup = lineToWrap + nextGroup++ * linesGroup;
+				if (lineGroup >= lineToWrapEnd)
+					break;
+				const int lineGroupEnd = std::min(lineGroup + linesGroup, lineToWrapEnd);
+				for (int line = lineGroup; line < lineGroupEnd; line++) {
+					ll.Resize(pdoc->LineStart(line + 1) - pdoc->LineStart(line));
+					ll.Invalidate(LineLayout::llInvalid);
+					view.LayoutLine(*this, line, surfaceMeasure, vs, &ll, wrapWidth, cache);
+					linesWrapped[line - lineToWrap] = ll.lines;
+				}
+			}
+		});
+		for (;;) {
+			const int lineGroup = lineToWrap + nextGroup++ * linesGroup;
+			if (lineGroup >= lineToWrapEnd)
+				break;
+			const int lineGroupEnd = std::min(lineGroup + linesGroup, lineToWrapEnd);
+			for (int line = lineGroup; line < lineGroupEnd; line++) {
+				if (WrapOneLine(surface, line)) {
+					wrapOccurred = true;
+				}
+			}
+		}
+		wrapWorkers->Finish();
+		for (int line = lineToWrap; line < lineToWrapEnd; line++) {
+			const int lines = linesWrapped[line - lineToWrap];
+			if (lines && cs.SetHeight(line, lines +
+				(vs.annotationVisible ? pdoc->AnnotationLines(line) : 0))) {
+				wrapOccurred = true;
+			}
+			wrapPending.Wrapped(line);
+		}
+		return wrapOccurred;
+	}
+#endif
+	for (int line = lineToWrap; line < lineToWrapEnd; line++) {
+		if (WrapOneLine(surface, line)) {
+			wrapOccurred = true;
+		}
+		wrapPending.Wrapped(line);
+	}
+	return wrapOccurred;
+}
+
+/**
+ * Set the height of each line from how many times its text would fill the wrap width
+ * at the average character width of the style at its start, allowing for the indent of
+ * continuation lines as LayoutLine does.
+ * This is much quicker than laying out lines so the document has close to its wrapped height
+ * and scrolls smoothly while lines are wrapped, replacing these estimates, in idle time.
+ * Return true if the height of any line changed.
+ */
+bool Editor::EstimateWrapHeights(int lineStart, int lineEnd) {
+	bool heightChanged = false;
+	if (wrapWidth <= 0)
+		return false;
+	int width = wrapWidth;
+	if (vs.wrapVisualFlags & SC_WRAPVISUALFLAG_END)
+		width -= static_cast<int>(vs.aveCharWidth);
+	XYPOSITION wrapAddIndent = 0;
+	if (vs.wrapIndentMode == SC_WRAPINDENT_INDENT) {
+		wrapAddIndent = pdoc->IndentSize() * vs.spaceWidth;
+	} else if (vs.wrapIndentMode == SC_WRAPINDENT_FIXED) {
+		wrapAddIndent = vs.wrapVisualStartIndent * vs.aveCharWidth;
+	}
+	for (int line = lineStart; line < lineEnd; line++) {
+		const int posLineStart = pdoc->LineStart(line);
+		const Style &style = vs.styles[pdoc->StyleIndexAt(posLineStart)];
+		const XYPOSITION widthCharacter = (style.monospaceASCIIWidth > 0) ?
+			style.monospaceASCIIWidth : style.aveCharWidth;
+		const XYPOSITION widthText = (pdoc->LineEnd(line) - posLineStart) * widthCharacter;
+		XYPOSITION wrapIndent = wrapAddIndent;
+		if (vs.wrapIndentMode != SC_WRAPINDENT_FIXED)
+			wrapIndent += pdoc->GetLineIndentation(line) * style.spaceWidth;
+		if (wrapIndent > width - static_cast<int>(vs.aveCharWidth) * 15)
+			wrapIndent = wrapAddIndent;
+		if ((vs.wrapVisualFlags & SC_WRAPVISUALFLAG_START) && (wrapIndent < vs.aveCharWidth))
+			wrapIndent = vs.aveCharWidth;
+		int linesWrapped = 1;
+		if (widthText >= width) {
+			// Continuation lines start after the wrap indent
+			const XYPOSITION widthContinuation = std::max(width - wrapIndent, widthCharacter);
+			linesWrapped += static_cast<int>(std::ceil((widthText - width) / widthContinuation));
+		}
+		if (cs.SetHeight(line, linesWrapped +
+			(vs.annotationVisible ? pdoc->AnnotationLines(line) : 0))) {
+			heightChanged = true;
+		}
+	}
+	return heightChanged;
+}
+
 // Perform  wrapping for a subset of the lines needing wrapping.
 // wsAll: wrap all lines which need wrapping in this single call
 // wsVisible: wrap currently visible lines
 // wsIdle: wrap one page + 100 lines
+// wsAround: wrap the lines that may be visible with lineAround
 // Return true if wrapping occurred.
-bool Editor::WrapLines(enum wrapScope ws) {
+bool Editor::WrapLines(enum wrapScope ws, int lineAround) {
 	int goodTopLine = topLine;
 	bool wrapOccurred = false;
 	if (!Wrapping()) {
@@ -1489,18 +1755,46 @@ bool Editor::WrapLines(enum wrapScope ws) {
 			wrapOccurred = true;
 		}
 		wrapPending.Reset();
+		wrapEstimatePending.Reset();
+		StopWrapWorkers();
 
 	} else if (wrapPending.NeedsWrap()) {
-		wrapPending.start = std::min(wrapPending.start, pdoc->LinesTotal());
+		wrapPending.start = std::min(wrapPending.start, static_cast<int>(pdoc->LinesTotal()));
 		if (!SetIdle(true)) {
 			// Idle processing not supported so full wrap required.
 			ws = wsAll;
 		}
-		// Decide where to start wrapping
-		int lineToWrap = wrapPending.start;
-		int lineToWrapEnd = std::min(wrapPending.end, pdoc->LinesTotal());
 		const int lineDocTop = cs.DocFromDisplay(topLine);
 		const int subLineTop = topLine - cs.DisplayFromDoc(lineDocTop);
+
+		PRectangle rcTextArea = GetClientRectangle();
+		rcTextArea.left = static_cast<XYPOSITION>(vs.textStart);
+		rcTextArea.right -= vs.rightMarginWidth;
+		wrapWidth = static_cast<int>(rcTextArea.Width());
+		RefreshStyleData();
+
+		if (wrapEstimatePending.NeedsWrap()) {
+			// Lines already wrapped since they needed estimates keep their heights.
+			// Estimates are made a block at a time, far more lines than are wrapped in
+			// each idle step, so estimating keeps ahead of wrapping.
+			const int linesEstimateBlock = 0x10000;
+			const int lineEstimate = std::max(wrapEstimatePending.start, wrapPending.start);
+			const int lineEstimateEnd = std::min(std::min(wrapEstimatePending.end, wrapPending.end),
+				static_cast<int>(pdoc->LinesTotal()));
+			const int lineEstimateBlockEnd = std::min(lineEstimateEnd, lineEstimate + linesEstimateBlock);
+			if (lineEstimateBlockEnd < lineEstimateEnd)
+				wrapEstimatePending.start = lineEstimateBlockEnd;
+			else
+				wrapEstimatePending.Reset();
+			if (EstimateWrapHeights(lineEstimate, lineEstimateBlockEnd)) {
+				wrapOccurred = true;
+				goodTopLine = cs.DisplayFromDoc(lineDocTop) + std::min(subLineTop, cs.GetHeight(lineDocTop)-1);
+			}
+		}
+
+		// Decide where to start wrapping
+		int lineToWrap = wrapPending.start;
+		int lineToWrapEnd = std::min(wrapPending.end, static_cast<int>(pdoc->LinesTotal()));
 		if (ws == wsVisible) {
 			lineToWrap = Platform::Clamp(lineDocTop-5, wrapPending.start, pdoc->LinesTotal());
 			// Priority wrap to just after visible area.
@@ -1519,9 +1813,15 @@ bool Editor::WrapLines(enum wrapScope ws) {
 				return false;
 			}
 		} else if (ws == wsIdle) {
-			lineToWrapEnd = lineToWrap + LinesOnScreen() + 100;
-		}
-		const int lineEndNeedWrap = std::min(wrapPending.end, pdoc->LinesTotal());
+			// Each thread measuring lines takes a share so idle steps take about the same time
+			lineToWrapEnd = lineToWrap + (LinesOnScreen() + 100) * (1 + StartWrapWorkers());
+		} else if (ws == wsAround) {
+			// Each line takes at least one display line so a screen either side of lineAround
+			// covers any lines shown with it.
+			lineToWrap = Platform::Clamp(lineAround - LinesOnScreen(), wrapPending.start, pdoc->LinesTotal());
+			lineToWrapEnd = lineAround + LinesOnScreen() + 1;
+		}
+		const int lineEndNeedWrap = std::min(wrapPending.end, static_cast<int>(pdoc->LinesTotal()));
 		lineToWrapEnd = std::min(lineToWrapEnd, lineEndNeedWrap);
 
 		// Ensure all lines being wrapped are styled.
@@ -1529,21 +1829,21 @@ bool Editor::WrapLines(enum wrapScope ws) {
 
 		if (lineToWrap < lineToWrapEnd) {
 
-			PRectangle rcTextArea = GetClientRectangle();
-			rcTextArea.left = static_cast<XYPOSITION>(vs.textStart);
-			rcTextArea.right -= vs.rightMarginWidth;
-			wrapWidth = static_cast<int>(rcTextArea.Width());
-			RefreshStyleData();
 			AutoSurface surface(this);
 			if (surface) {
 //Platform::DebugPrintf("Wraplines: scope=%0d need=%0d..%0d perform=%0d..%0d\n", ws, wrapPending.start, wrapPending.end, lineToWrap, lineToWrapEnd);
 
-				while (lineToWrap < lineToWrapEnd) {
-					if (WrapOneLine(surface, lineToWrap)) {
-						wrapOccurred = true;
+				if ((ws == wsVisible) || (ws == wsAround)) {
+					// Few lines so wrap at once on this thread
+					while (lineToWrap < lineToWrapEnd) {
+						if (WrapOneLine(surface, lineToWrap)) {
+							wrapOccurred = true;
+						}
+						wrapPending.Wrapped(lineToWrap);
+						lineToWrap++;
 					}
-					wrapPending.Wrapped(lineToWrap);
-					lineToWrap++;
+				} else if (WrapLinesOnThreads(surface, lineToWrap, lineToWrapEnd)) {
+					wrapOccurred = true;
 				}
 
 				goodTopLine = cs.DisplayFromDoc(lineDocTop) + std::min(subLineTop, cs.GetHeight(lineDocTop)-1);
@@ -1553,6 +1853,7 @@ bool Editor::WrapLines(enum wrapScope ws) {
 		// If wrapping is done, bring it to resting position
 		if (wrapPending.start >= lineEndNeedWrap) {
 			wrapPending.Reset();
+			StopWrapWorkers();
 		}
 	}
 
@@ -1565,6 +1866,17 @@ bool Editor::WrapLines(enum wrapScope ws) {
 	return wrapOccurred;
 }
 
+// Ensure lineDoc and the lines that may be shown with it are wrapped so DisplayFromDoc works.
+// Lines further on only need wrapping now when their heights are not estimated.
+void Editor::WrapForLine(int lineDoc) {
+	if (lineDoc >= wrapPending.start) {
+		if (wrapEstimate)
+			WrapLines(wsAround, lineDoc);
+		else
+			WrapLines(wsAll);
+	}
+}
+
 void Editor::LinesJoin() {
 	if (!RangeContainsProtected(targetStart, targetEnd)) {
 		UndoGroup ug(pdoc);
@@ -2494,6 +2806,15 @@ void Editor::NotifyZoom() {
 	NotifyParent(scn);
 }
 
+void Editor::NotifySearchProgress() {
+	SCNotification scn = {};
+	scn.nmhdr.code = SCN_SEARCHPROGRESS;
+	scn.position = backgroundSearch.pos;
+	scn.length = foundRanges.size();
+	scn.updated = backgroundSearch.status;
+	NotifyParent(scn);
+}
+
 // Notifications from document
 void Editor::NotifyModifyAttempt(Document *, void *) {
 	//Platform::DebugPrintf("** Modify Attempt\n");
@@ -2507,9 +2828,10 @@ void Editor::NotifySavePoint(Document *, void *, bool atSavePoint) {
 
 void Editor::CheckModificationForWrap(DocModification mh) {
 	if (mh.modificationType & (SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT)) {
-		view.llc.Invalidate(LineLayout::llCheckTextAndStyle);
 		int lineDoc = pdoc->LineFromPosition(mh.position);
 		int lines = Platform::Maximum(0, mh.linesAdded);
+		// Layouts of other lines moved with their lines so are still valid
+		view.llc.InvalidateLines(lineDoc, lineDoc + lines + 1, LineLayout::llCheckTextAndStyle);
 		if (Wrapping()) {
 			NeedWrapping(lineDoc, lineDoc + lines + 1);
 		}
@@ -2568,9 +2890,6 @@ void Editor::NotifyModified(Document *, DocModification mh, void *) {
 		}
 	}
 	if (mh.modificationType & (SC_MOD_CHANGESTYLE | SC_MOD_CHANGEINDICATOR)) {
-		if (mh.modificationType & SC_MOD_CHANGESTYLE) {
-			pdoc->IncrementStyleClock();
-		}
 		if (paintState == notPainting) {
 			if (mh.position < pdoc->LineStart(topLine)) {
 				// Styling performed before this view
@@ -2580,7 +2899,8 @@ void Editor::NotifyModified(Document *, DocModification mh, void *) {
 			}
 		}
 		if (mh.modificationType & SC_MOD_CHANGESTYLE) {
-			view.llc.Invalidate(LineLayout::llCheckTextAndStyle);
+			view.llc.InvalidateLines(pdoc->LineFromPosition(mh.position),
+				pdoc->LineFromPosition(mh.position + mh.length) + 1, LineLayout::llCheckTextAndStyle);
 		}
 	} else {
 		// Move selection and brace highlights
@@ -2593,6 +2913,11 @@ void Editor::NotifyModified(Document *, DocModification mh, void *) {
 			braces[0] = MovePositionForDeletion(braces[0], mh.position, mh.length);
 			braces[1] = MovePositionForDeletion(braces[1], mh.position, mh.length);
 		}
+		if ((mh.modificationType & (SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT)) && backgroundSearch.Running()) {
+			// Matches found and the range still to search no longer correspond to the text
+			backgroundSearch.status = SC_SEARCHSTATUS_CANCELLED;
+			NotifySearchProgress();
+		}
 		if ((mh.modificationType & (SC_MOD_BEFOREINSERT | SC_MOD_BEFOREDELETE)) && cs.HiddenLines()) {
 			// Some lines are hidden so may need shown.
 			const int lineOfPos = pdoc->LineFromPosition(mh.position);
@@ -3935,19 +4260,19 @@ long Editor::FindText(
     sptr_t lParam) {	///< @c TextToFind structure: The text to search for in the given range.
 
 	Sci_TextToFind *ft = reinterpret_cast<Sci_TextToFind *>(lParam);
-	int lengthFound = istrlen(ft->lpstrText);
+	Sci::Position lengthFound = istrlen(ft->lpstrText);
 	if (!pdoc->HasCaseFolder())
 		pdoc->SetCaseFolder(CaseFolderForEncoding());
 	try {
-		long pos = pdoc->FindText(
-			static_cast<int>(ft->chrg.cpMin),
-			static_cast<int>(ft->chrg.cpMax),
+		const Sci::Position pos = pdoc->FindText(
+			static_cast<Sci::Position>(ft->chrg.cpMin),
+			static_cast<Sci::Position>(ft->chrg.cpMax),
 			ft->lpstrText,
 			static_cast<int>(wParam),
 			&lengthFound);
 		if (pos != -1) {
-			ft->chrgText.cpMin = pos;
-			ft->chrgText.cpMax = pos + lengthFound;
+			ft->chrgText.cpMin = static_cast<Sci_PositionCR>(pos);
+			ft->chrgText.cpMax = static_cast<Sci_PositionCR>(pos + lengthFound);
 		}
 		return static_cast<int>(pos);
 	} catch (RegexError &) {
@@ -3983,8 +4308,8 @@ long Editor::SearchText(
     sptr_t lParam) {			///< The text to search for.
 
 	const char *txt = reinterpret_cast<char *>(lParam);
-	long pos;
-	int lengthFound = istrlen(txt);
+	Sci::Position pos;
+	Sci::Position lengthFound = istrlen(txt);
 	if (!pdoc->HasCaseFolder())
 		pdoc->SetCaseFolder(CaseFolderForEncoding());
 	try {
@@ -4029,18 +4354,18 @@ std::string Editor::CaseMapString(const std::string &s, int caseMapping) {
  * Search for text in the target range of the document.
  * @return The position of the found text, -1 if not found.
  */
-long Editor::SearchInTarget(const char *text, int length) {
-	int lengthFound = length;
+Sci::Position Editor::SearchInTarget(const char *text, Sci::Position length) {
+	Sci::Position lengthFound = length;
 
 	if (!pdoc->HasCaseFolder())
 		pdoc->SetCaseFolder(CaseFolderForEncoding());
 	try {
-		long pos = pdoc->FindText(targetStart, targetEnd, text,
+		const Sci::Position pos = pdoc->FindText(targetStart, targetEnd, text,
 				searchFlags,
 				&lengthFound);
 		if (pos != -1) {
-			targetStart = static_cast<int>(pos);
-			targetEnd = static_cast<int>(pos + lengthFound);
+			targetStart = pos;
+			targetEnd = pos + lengthFound;
 		}
 		return pos;
 	} catch (RegexError &) {
@@ -4522,7 +4847,7 @@ void Editor::ButtonDownWithModifiers(Point pt, unsigned int curTime, int modifie
 				LineSelection(newPos.Position(), lineAnchorPos, selectionType == selWholeLine);
 			}
 
-			SetDragPosition(SelectionPosition(invalidPosition));
+			SetDragPosition(SelectionPosition(Sci::invalidPosition));
 			SetMouseCapture(true);
 			if (FineTickerAvailable()) {
 				FineTickerStart(tickScroll, 100, 10);
@@ -4543,7 +4868,7 @@ void Editor::ButtonDownWithModifiers(Point pt, unsigned int curTime, int modifie
 				FineTickerStart(tickScroll, 100, 10);
 			}
 			if (inDragDrop != ddInitial) {
-				SetDragPosition(SelectionPosition(invalidPosition));
+				SetDragPosition(SelectionPosition(Sci::invalidPosition));
 				if (!shift) {
 					if (ctrl && multipleSelection) {
 						SelectionRange range(newPos);
@@ -4642,7 +4967,7 @@ void Editor::SetHotSpotRange(Point *pt) {
 		if (hotspot.Valid()) {
 			InvalidateRange(hotspot.start, hotspot.end);
 		}
-		hotspot = Range(invalidPosition);
+		hotspot = Range(Sci::invalidPosition);
 	}
 }
 
@@ -4767,7 +5092,7 @@ void Editor::ButtonMoveWithModifiers(Point pt, int modifiers) {
 				DisplayCursor(Window::cursorHand);
 				SetHotSpotRange(&pt);
 			} else {
-				if (hoverIndicatorPos != invalidPosition)
+				if (hoverIndicatorPos != Sci::invalidPosition)
 					DisplayCursor(Window::cursorHand);
 				else
 					DisplayCursor(Window::cursorText);
@@ -4914,6 +5239,8 @@ bool Editor::Idle() {
 		needWrap = wrapPending.NeedsWrap();
 	} else if (needIdleStyling) {
 		IdleStyling();
+	} else if (backgroundSearch.Running()) {
+		IdleSearch();
 	}
 
 	// Add more idle things to do here, but make sure idleDone is
@@ -4921,7 +5248,7 @@ bool Editor::Idle() {
 	// false will stop calling this idle function until SetIdle() is
 	// called again.
 
-	const bool idleDone = !needWrap && !needIdleStyling; // && thatDone && theOtherThingDone...
+	const bool idleDone = !needWrap && !needIdleStyling && !backgroundSearch.Running(); // && thatDone && theOtherThingDone...
 
 	return !idleDone;
 }
@@ -5008,7 +5335,7 @@ int Editor::PositionAfterArea(PRectangle rcArea) const {
 
 // Style to a position within the view. If this causes a change at end of last line then
 // affects later lines so style all the viewed text.
-void Editor::StyleToPositionInView(Position pos) {
+void Editor::StyleToPositionInView(Sci::Position pos) {
 	int endWindow = PositionAfterArea(GetClientDrawingRectangle());
 	if (pos > endWindow)
 		pos = endWindow;
@@ -5036,8 +5363,8 @@ int Editor::PositionAfterMaxStyling(int posMax, bool scrolling) const {
 
 	const int linesToStyle = Platform::Clamp(static_cast<int>(secondsAllowed / pdoc->durationStyleOneLine),
 		10, 0x10000);
-	const int stylingMaxLine = std::min(
-		static_cast<int>(pdoc->LineFromPosition(pdoc->GetEndStyled()) + linesToStyle),
+	const Sci::Line stylingMaxLine = std::min(
+		pdoc->LineFromPosition(pdoc->GetEndStyled()) + linesToStyle,
 		pdoc->LinesTotal());
 	return std::min(static_cast<int>(pdoc->LineStart(stylingMaxLine)), posMax);
 }
@@ -5083,6 +5410,83 @@ void Editor::IdleStyling() {
 	}
 }
 
+// Search one slice of the target for a background search, sizing slices to take about as long as idle styling.
+// Slices are bounded in bytes so that a single huge line or a multiline expression does not block.
+void Editor::IdleSearch() {
+	BackgroundSearch &bs = backgroundSearch;
+	const bool lineExpression = (bs.flags & SCFIND_REGEXP) && !(bs.flags & SCFIND_MULTILINE);
+	Sci::Position sliceEnd = bs.endPos;
+	bool endsAtLineStart = false;
+	if (std::max(bs.lengthSlice, bs.overlap * 2) < bs.endPos - bs.pos) {
+		sliceEnd = pdoc->MovePositionOutsideChar(bs.pos + std::max(bs.lengthSlice, bs.overlap * 2), 1, false);
+		if (lineExpression) {
+			// Expressions that match within a line are divided exactly at a line start when the
+			// next slice, which starts at the end of the previous line, would advance
+			const Sci::Line lineSliceEnd = pdoc->LineFromPosition(sliceEnd);
+			if (pdoc->LineEnd(lineSliceEnd - 1) > bs.pos) {
+				sliceEnd = pdoc->LineStart(lineSliceEnd);
+				endsAtLineStart = true;
+			}
+		}
+	}
+	std::vector<Range> found;
+	ElapsedTime etSearch;
+	try {
+		pdoc->FindAll(bs.pos, sliceEnd, bs.text.c_str(), bs.flags, bs.text.length(), found);
+	} catch (RegexError &) {
+		errorStatus = SC_STATUS_WARN_REGEX;
+		bs.status = SC_SEARCHSTATUS_CANCELLED;
+		NotifySearchProgress();
+		return;
+	}
+	const double duration = etSearch.Duration();
+	// Matches that may continue past the end of the slice are found again by the next slice
+	Sci::Position posRetry = sliceEnd;
+	if (sliceEnd < bs.endPos) {
+		const Sci::Position posOverlap = endsAtLineStart ? sliceEnd : sliceEnd - bs.overlap;
+		posRetry = posOverlap;
+		while (!found.empty() && ((found.back().start >= posOverlap) ||
+			(!endsAtLineStart && (found.back().end >= sliceEnd)))) {
+			posRetry = std::min(posRetry, found.back().start);
+			found.pop_back();
+		}
+	}
+	foundRanges.insert(foundRanges.end(), found.begin(), found.end());
+	if (bs.fillIndicator && !found.empty()) {
+		const int indicatorCurrent = pdoc->decorations.GetCurrentIndicator();
+		pdoc->decorations.SetCurrentIndicator(bs.indicator);
+		pdoc->DecorationFillRanges(found, bs.value);
+		pdoc->decorations.SetCurrentIndicator(indicatorCurrent);
+	}
+	if (sliceEnd >= bs.endPos) {
+		bs.pos = bs.endPos;
+		bs.status = SC_SEARCHSTATUS_FINISHED;
+	} else {
+		const double secondsAllowed = 0.02;
+		const double lengthWanted = (duration > 0.0) ?
+			(sliceEnd - bs.pos) * secondsAllowed / duration : bs.lengthSlice * 2.0;
+		bs.lengthSlice = static_cast<Sci::Position>(Platform::Clamp(static_cast<int>(
+			std::min(lengthWanted, 1e9)), 0x1000, 0x4000000));
+		Sci::Position posNext = pdoc->MovePositionOutsideChar(posRetry, -1, false);
+		if (endsAtLineStart) {
+			// Start at the end of the previous line so an empty next line is searched.
+			posNext = pdoc->LineEnd(pdoc->LineFromPosition(sliceEnd) - 1);
+		}
+		if (!foundRanges.empty()) {
+			const Range &last = foundRanges.back();
+			// Step over an empty match as FindAll does
+			posNext = std::max(posNext, (last.start == last.end) ? pdoc->NextPosition(last.end, 1) : last.end);
+		}
+		if (posNext <= bs.pos) {
+			// A match may be longer than the slice so search further next time
+			posNext = bs.pos;
+			bs.lengthSlice = std::max(bs.lengthSlice, (sliceEnd - bs.pos) * 2);
+		}
+		bs.pos = posNext;
+	}
+	NotifySearchProgress();
+}
+
 void Editor::IdleWork() {
 	// Style the line after the modification as this allows modifications that change just the
 	// line of the modification to heal instead of propagating to the rest of the window.
@@ -5138,7 +5542,7 @@ void Editor::CheckForChangeOutsidePaint(Range r) {
 	}
 }
 
-void Editor::SetBraceHighlight(Position pos0, Position pos1, int matchStyle) {
+void Editor::SetBraceHighlight(Sci::Position pos0, Sci::Position pos1, int matchStyle) {
 	if ((pos0 != braces[0]) || (pos1 != braces[1]) || (matchStyle != bracesMatchStyle)) {
 		if ((braces[0] != pos0) || (matchStyle != bracesMatchStyle)) {
 			CheckForChangeOutsidePaint(Range(braces[0]));
@@ -5195,9 +5599,11 @@ void Editor::SetDocPointer(Document *document) {
 	sel.Clear();
 	targetStart = 0;
 	targetEnd = 0;
+	foundRanges.clear();
+	backgroundSearch.status = SC_SEARCHSTATUS_NONE;
 
-	braces[0] = invalidPosition;
-	braces[1] = invalidPosition;
+	braces[0] = Sci::invalidPosition;
+	braces[1] = Sci::invalidPosition;
 
 	vs.ReleaseAllExtendedStyles();
 
@@ -5210,8 +5616,8 @@ void Editor::SetDocPointer(Document *document) {
 	view.llc.Deallocate();
 	NeedWrapping();
 
-	hotspot = Range(invalidPosition);
-	hoverIndicatorPos = invalidPosition;
+	hotspot = Range(Sci::invalidPosition);
+	hoverIndicatorPos = Sci::invalidPosition;
 
 	view.ClearAllTabstops();
 
@@ -5347,8 +5753,7 @@ int Editor::ContractedFoldNext(int lineStart) const {
 void Editor::EnsureLineVisible(int lineDoc, bool enforcePolicy) {
 
 	// In case in need of wrapping to ensure DisplayFromDoc works.
-	if (lineDoc >= wrapPending.start)
-		WrapLines(wsAll);
+	WrapForLine(lineDoc);
 
 	if (!cs.GetVisible(lineDoc)) {
 		// Back up to find a non-blank line
@@ -5498,7 +5903,7 @@ void Editor::NeedShown(int pos, int len) {
 
 int Editor::GetTag(char *tagValue, int tagNumber) {
 	const char *text = 0;
-	int length = 0;
+	Sci::Position length = 0;
 	if ((tagNumber >= 1) && (tagNumber <= 9)) {
 		char name[3] = "\\?";
 		name[1] = static_cast<char>(tagNumber + '0');
@@ -5514,7 +5919,7 @@ int Editor::GetTag(char *tagValue, int tagNumber) {
 	return length;
 }
 
-int Editor::ReplaceTarget(bool replacePatterns, const char *text, int length) {
+Sci::Position Editor::ReplaceTarget(bool replacePatterns, const char *text, Sci::Position length) {
 	UndoGroup ug(pdoc);
 	if (length == -1)
 		length = istrlen(text);
@@ -5527,11 +5932,157 @@ int Editor::ReplaceTarget(bool replacePatterns, const char *text, int length) {
 	if (targetStart != targetEnd)
 		pdoc->DeleteChars(targetStart, targetEnd - targetStart);
 	targetEnd = targetStart;
-	const int lengthInserted = pdoc->InsertString(targetStart, text, length);
+	const Sci::Position lengthInserted = pdoc->InsertString(targetStart, text, length);
 	targetEnd = targetStart + lengthInserted;
 	return length;
 }
 
+/**
+ * Replace every match of search in the target with replacement.
+ * All the matches are found in the unchanged document and the text from the first match to the
+ * end of the last match is built up then replaced in one deletion and one insertion.
+ * With regular expressions, the replacement may refer to tagged expressions as with SCI_REPLACETARGETRE.
+ * @return The number of replacements made or -1 for an invalid regular expression.
+ */
+Sci::Position Editor::ReplaceAllInTarget(const char *search, const char *replacement) {
+	const Sci::Position lengthSearch = istrlen(search);
+	const Sci::Position lengthReplacement = istrlen(replacement);
+	if (lengthSearch == 0)
+		return 0;
+	const bool replacePatterns = (searchFlags & SCFIND_REGEXP) != 0;
+	if (!pdoc->HasCaseFolder())
+		pdoc->SetCaseFolder(CaseFolderForEncoding());
+	// Always replace forwards
+	const Sci::Position rangeStart = Platform::Minimum(targetStart, targetEnd);
+	const Sci::Position rangeEnd = Platform::Maximum(targetStart, targetEnd);
+	std::string replaced;
+	Sci::Position replacements = 0;
+	Sci::Position startReplaced = -1;
+	Sci::Position pos = rangeStart;
+	try {
+		while (pos <= rangeEnd) {
+			Sci::Position lengthFound = lengthSearch;
+			const Sci::Position posFound = pdoc->FindText(pos, rangeEnd, search, searchFlags, &lengthFound);
+			if (posFound < 0)
+				break;
+			Sci::Position lengthSubstituted = lengthReplacement;
+			const char *substituted = replacement;
+			if (replacePatterns) {
+				substituted = pdoc->SubstituteByPosition(replacement, &lengthSubstituted);
+				if (!substituted)
+					break;
+			}
+			// Text between matches is only kept once the match is replaced so that,
+			// when stopping, replaced ends at pos.
+			if (startReplaced < 0)
+				startReplaced = posFound;
+			else
+				replaced.append(RangeText(pos, posFound));
+			replaced.append(substituted, lengthSubstituted);
+			replacements++;
+			pos = posFound + lengthFound;
+			if (lengthFound == 0) {
+				// Empty match so keep the next character and continue after it
+				if (pos >= rangeEnd)
+					break;
+				const Sci::Position posNext = pdoc->NextPosition(pos, 1);
+				replaced.append(RangeText(pos, posNext));
+				pos = posNext;
+			}
+		}
+	} catch (RegexError &) {
+		errorStatus = SC_STATUS_WARN_REGEX;
+		return -1;
+	}
+	if (replacements > 0) {
+		UndoGroup ug(pdoc);
+		const Sci::Position lengthRemoved = pos - startReplaced;
+		// Nothing is replaced when the document is read-only
+		if ((lengthRemoved > 0) && !pdoc->DeleteChars(startReplaced, lengthRemoved))
+			return 0;
+		const Sci::Position lengthInserted = pdoc->InsertString(startReplaced, replaced.c_str(), replaced.length());
+		if ((lengthRemoved == 0) && (lengthInserted == 0) && !replaced.empty())
+			return 0;
+		targetStart = rangeStart;
+		targetEnd = rangeEnd + lengthInserted - lengthRemoved;
+	}
+	return replacements;
+}
+
+/**
+ * Find every match of search in the target, remembering them for SCI_GETFOUNDSTART and SCI_GETFOUNDEND.
+ * When fillIndicator is true, the current indicator is set over the matches with one notification.
+ * @return The number of matches or -1 for an invalid regular expression.
+ */
+Sci::Position Editor::FindAllInTarget(const char *search, bool fillIndicator) {
+	CancelSearch();
+	foundRanges.clear();
+	const Sci::Position lengthSearch = istrlen(search);
+	if (lengthSearch == 0)
+		return 0;
+	if (!pdoc->HasCaseFolder())
+		pdoc->SetCaseFolder(CaseFolderForEncoding());
+	try {
+		pdoc->FindAll(targetStart, targetEnd, search, searchFlags, lengthSearch, foundRanges);
+	} catch (RegexError &) {
+		errorStatus = SC_STATUS_WARN_REGEX;
+		foundRanges.clear();
+		return -1;
+	}
+	if (fillIndicator && !foundRanges.empty())
+		pdoc->DecorationFillRanges(foundRanges, pdoc->decorations.GetCurrentValue());
+	return foundRanges.size();
+}
+
+/**
+ * Start finding every match of search in the target with the matches found a slice at a time in
+ * idle time so that the application remains responsive while huge documents are searched.
+ * Progress is reported with SCN_SEARCHPROGRESS and the matches found so far are available
+ * through SCI_GETFOUNDSTART and SCI_GETFOUNDEND.
+ */
+void Editor::StartSearchInTarget(const char *search, bool fillIndicator) {
+	CancelSearch();
+	foundRanges.clear();
+	backgroundSearch.status = SC_SEARCHSTATUS_NONE;
+	backgroundSearch.text = search;
+	if (backgroundSearch.text.empty())
+		return;
+	if (!pdoc->HasCaseFolder())
+		pdoc->SetCaseFolder(CaseFolderForEncoding());
+	backgroundSearch.flags = searchFlags;
+	backgroundSearch.fillIndicator = fillIndicator;
+	backgroundSearch.indicator = pdoc->decorations.GetCurrentIndicator();
+	backgroundSearch.value = pdoc->decorations.GetCurrentValue();
+	backgroundSearch.pos = pdoc->MovePositionOutsideChar(std::min(targetStart, targetEnd), 1, false);
+	backgroundSearch.endPos = pdoc->MovePositionOutsideChar(std::max(targetStart, targetEnd), 1, false);
+	backgroundSearch.lengthSlice = 0x40000;
+	// Plain text matches are no longer than the text unless case folding multibyte text where the
+	// folded text may be UTF8MaxBytes times longer and each folded byte may match a whole character.
+	// Regular expression matches are found exactly when shorter than the overlap.
+	const Sci::Position lengthText = backgroundSearch.text.length();
+	const Sci::Position regexOverlap = 0x10000;
+	if (searchFlags & SCFIND_REGEXP)
+		backgroundSearch.overlap = regexOverlap;
+	else if ((searchFlags & SCFIND_MATCHCASE) || !pdoc->dbcsCodePage)
+		backgroundSearch.overlap = lengthText;
+	else
+		backgroundSearch.overlap = lengthText * UTF8MaxBytes * UTF8MaxBytes;
+	backgroundSearch.status = SC_SEARCHSTATUS_RUNNING;
+	if (!SetIdle(true)) {
+		// Idle processing not supported so search the whole target now.
+		while (backgroundSearch.Running()) {
+			IdleSearch();
+		}
+	}
+}
+
+// Stop a background search, keeping the matches already found.
+void Editor::CancelSearch() {
+	if (backgroundSearch.Running()) {
+		backgroundSearch.status = SC_SEARCHSTATUS_CANCELLED;
+	}
+}
+
 bool Editor::IsUnicodeMode() const {
 	return pdoc && (SC_CP_UTF8 == pdoc->dbcsCodePage);
 }
@@ -5791,6 +6342,20 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 		pdoc->DeleteUndoHistory();
 		return 0;
 
+	case SCI_SETUNDOLIMITBYTES:
+		pdoc->SetUndoLimitBytes(static_cast<int>(wParam));
+		return 0;
+
+	case SCI_GETUNDOLIMITBYTES:
+		return pdoc->GetUndoLimitBytes();
+
+	case SCI_SETUNDOCOMPRESSIONTHRESHOLD:
+		pdoc->SetUndoCompressionThreshold(static_cast<int>(wParam));
+		return 0;
+
+	case SCI_GETUNDOCOMPRESSIONTHRESHOLD:
+		return pdoc->GetUndoCompressionThreshold();
+
 	case SCI_GETFIRSTVISIBLELINE:
 		return topLine;
 
@@ -5941,6 +6506,10 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 		PLATFORM_ASSERT(lParam);
 		return SearchInTarget(CharPtrFromSPtr(lParam), static_cast<int>(wParam));
 
+	case SCI_REPLACEALLINTARGET:
+		PLATFORM_ASSERT(wParam && lParam);
+		return ReplaceAllInTarget(reinterpret_cast<const char *>(wParam), CharPtrFromSPtr(lParam));
+
 	case SCI_SETSEARCHFLAGS:
 		searchFlags = static_cast<int>(wParam);
 		break;
@@ -5948,6 +6517,40 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 	case SCI_GETSEARCHFLAGS:
 		return searchFlags;
 
+	case SCI_GETREGEXCACHEHITS:
+		return pdoc->RegexCacheCount(true);
+
+	case SCI_GETREGEXCACHEMISSES:
+		return pdoc->RegexCacheCount(false);
+
+	case SCI_FINDALLINTARGET:
+		PLATFORM_ASSERT(lParam);
+		return FindAllInTarget(CharPtrFromSPtr(lParam), wParam != 0);
+
+	case SCI_GETFOUNDSTART:
+		if (static_cast<size_t>(wParam) < foundRanges.size())
+			return foundRanges[wParam].start;
+		return -1;
+
+	case SCI_GETFOUNDEND:
+		if (static_cast<size_t>(wParam) < foundRanges.size())
+			return foundRanges[wParam].end;
+		return -1;
+
+	case SCI_GETFOUNDCOUNT:
+		return foundRanges.size();
+
+	case SCI_STARTSEARCHINTARGET:
+		StartSearchInTarget(CharPtrFromSPtr(lParam), wParam != 0);
+		return 0;
+
+	case SCI_CANCELSEARCH:
+		CancelSearch();
+		return 0;
+
+	case SCI_GETSEARCHSTATUS:
+		return backgroundSearch.status;
+
 	case SCI_GETTAG:
 		return GetTag(CharPtrFromSPtr(lParam), static_cast<int>(wParam));
 
@@ -6559,6 +7162,27 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 	case SCI_GETWRAPINDENTMODE:
 		return vs.wrapIndentMode;
 
+	case SCI_SETWRAPTHREADS:
+		StopWrapWorkers();
+		wrapThreads = static_cast<int>(wParam);
+		break;
+
+	case SCI_GETWRAPTHREADS:
+		return wrapThreads;
+
+	case SCI_SETWRAPESTIMATE:
+		wrapEstimate = wParam != 0;
+		if (!wrapEstimate) {
+			wrapEstimatePending.Reset();
+		} else if (wrapPending.NeedsWrap()) {
+			wrapEstimatePending.AddRange(wrapPending.start, wrapPending.end);
+			SetIdle(true);
+		}
+		break;
+
+	case SCI_GETWRAPESTIMATE:
+		return wrapEstimate;
+
 	case SCI_SETLAYOUTCACHE:
 		view.llc.SetLevel(static_cast<int>(wParam));
 		break;
@@ -6566,7 +7190,18 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 	case SCI_GETLAYOUTCACHE:
 		return view.llc.GetLevel();
 
+	case SCI_SETLAYOUTCACHEBUDGET:
+		view.llc.SetMemoryBudget(wParam);
+		break;
+
+	case SCI_GETLAYOUTCACHEBUDGET:
+		return view.llc.GetMemoryBudget();
+
+	case SCI_GETLAYOUTCACHEMEMORY:
+		return view.llc.MemoryUsed();
+
 	case SCI_SETPOSITIONCACHE:
+		StopWrapWorkers();
 		view.posCache.SetSize(wParam);
 		break;
 
@@ -7500,8 +8135,9 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 		return 0;
 
 	case SCI_CREATEDOCUMENT: {
-			Document *doc = new Document();
+			Document *doc = new Document(static_cast<int>(lParam));
 			doc->AddRef();
+			doc->Allocate(static_cast<int>(wParam));
 			return reinterpret_cast<sptr_t>(doc);
 		}
 
@@ -7514,13 +8150,16 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 		break;
 
 	case SCI_CREATELOADER: {
-			Document *doc = new Document();
+			Document *doc = new Document(static_cast<int>(lParam));
 			doc->AddRef();
 			doc->Allocate(static_cast<int>(wParam));
 			doc->SetUndoCollection(false);
 			return reinterpret_cast<sptr_t>(static_cast<ILoader *>(doc));
 		}
 
+	case SCI_GETDOCUMENTOPTIONS:
+		return pdoc->Options();
+
 	case SCI_SETMODEVENTMASK:
 		modEventMask = static_cast<int>(wParam);
 		return 0;
@@ -12,6 +12,8 @@
 namespace Scintilla {
 #endif
 
+class WrapWorkers;
+
 /**
  */
 class Timer {
@@ -47,20 +49,43 @@ public:
 		workUpdateUI=2
 	};
 	enum workItems items;
-	Position upTo;
+	Sci::Position upTo;
 
 	WorkNeeded() : items(workNone), upTo(0) {}
 	void Reset() {
 		items = workNone;
 		upTo = 0;
 	}
-	void Need(workItems items_, Position pos) {
+	void Need(workItems items_, Sci::Position pos) {
 		if ((items_ & workStyle) && (upTo < pos))
 			upTo = pos;
 		items = static_cast<workItems>(items | items_);
 	}
 };
 
+/**
+ * A search of the target for every match which is performed a slice at a time in idle time.
+ */
+class BackgroundSearch {
+public:
+	int status;
+	std::string text;
+	int flags;
+	bool fillIndicator;
+	int indicator;
+	int value;
+	Sci::Position pos;	///< Start of the next slice
+	Sci::Position endPos;
+	Sci::Position lengthSlice;	///< Adjusted so each slice takes about the same time
+	Sci::Position overlap;	///< Bytes searched again so matches crossing the end of a slice are found
+
+	BackgroundSearch() : status(SC_SEARCHSTATUS_NONE), flags(0), fillIndicator(false), indicator(0), value(0),
+		pos(0), endPos(0), lengthSlice(0), overlap(0) {}
+	bool Running() const {
+		return status == SC_SEARCHSTATUS_RUNNING;
+	}
+};
+
 /**
  * Hold a piece of text selected for copying or dragging, along with encoding and selection format information.
  */
@@ -218,9 +243,11 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	int wordSelectAnchorStartPos;
 	int wordSelectAnchorEndPos;
 	int wordSelectInitialCaretPos;
-	int targetStart;
-	int targetEnd;
+	Sci::Position targetStart;
+	Sci::Position targetEnd;
 	int searchFlags;
+	std::vector<Range> foundRanges;
+	BackgroundSearch backgroundSearch;
 	int topLine;
 	int posTopLine;
 	int lengthForEncode;
@@ -257,6 +284,10 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 
 	// Wrapping support
 	WrapPending wrapPending;
+	int wrapThreads;	///< Threads measuring lines to wrap in idle time, 0 for one per processor
+	WrapWorkers *wrapWorkers;	///< Threads measuring lines for the current wrap pass
+	bool wrapEstimate;	///< Estimate heights of lines waiting to be wrapped from their lengths
+	WrapPending wrapEstimatePending;	///< Lines that need their heights estimated
 
 	bool convertPastes;
 
@@ -372,8 +403,14 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	bool Wrapping() const;
 	void NeedWrapping(int docLineStart=0, int docLineEnd=WrapPending::lineLarge);
 	bool WrapOneLine(Surface *surface, int lineToWrap);
-	enum wrapScope {wsAll, wsVisible, wsIdle};
-	bool WrapLines(enum wrapScope ws);
+	int WrapThreads() const;
+	int StartWrapWorkers();
+	void StopWrapWorkers();
+	bool WrapLinesOnThreads(Surface *surface, int lineToWrap, int lineToWrapEnd);
+	bool EstimateWrapHeights(int lineStart, int lineEnd);
+	enum wrapScope {wsAll, wsVisible, wsIdle, wsAround};
+	bool WrapLines(enum wrapScope ws, int lineAround=0);
+	void WrapForLine(int lineDoc);
 	void LinesJoin();
 	void LinesSplit(int pixelWidth);
 
@@ -442,6 +479,7 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	void NotifyNeedShown(int pos, int len);
 	void NotifyDwelling(Point pt, bool state);
 	void NotifyZoom();
+	void NotifySearchProgress();
 
 	void NotifyModifyAttempt(Document *document, void *userData);
 	void NotifySavePoint(Document *document, void *userData, bool atSavePoint);
@@ -482,7 +520,7 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	long FindText(uptr_t wParam, sptr_t lParam);
 	void SearchAnchor();
 	long SearchText(unsigned int iMessage, uptr_t wParam, sptr_t lParam);
-	long SearchInTarget(const char *text, int length);
+	Sci::Position SearchInTarget(const char *text, Sci::Position length);
 	void GoToLine(int lineNo);
 
 	virtual void CopyToClipboard(const SelectionText &selectedText) = 0;
@@ -527,18 +565,19 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	void SetFocusState(bool focusState);
 
 	int PositionAfterArea(PRectangle rcArea) const;
-	void StyleToPositionInView(Position pos);
+	void StyleToPositionInView(Sci::Position pos);
 	int PositionAfterMaxStyling(int posMax, bool scrolling) const;
 	void StartIdleStyling(bool truncatedLastStyling);
 	void StyleAreaBounded(PRectangle rcArea, bool scrolling);
 	void IdleStyling();
+	void IdleSearch();
 	virtual void IdleWork();
 	virtual void QueueIdleWork(WorkNeeded::workItems items, int upTo=0);
 
 	virtual bool PaintContains(PRectangle rc);
 	bool PaintContainsMargin();
 	void CheckForChangeOutsidePaint(Range r);
-	void SetBraceHighlight(Position pos0, Position pos1, int matchStyle);
+	void SetBraceHighlight(Sci::Position pos0, Sci::Position pos1, int matchStyle);
 
 	void SetAnnotationHeights(int start, int end);
 	virtual void SetDocPointer(Document *document);
@@ -556,7 +595,11 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	void FoldAll(int action);
 
 	int GetTag(char *tagValue, int tagNumber);
-	int ReplaceTarget(bool replacePatterns, const char *text, int length=-1);
+	Sci::Position ReplaceTarget(bool replacePatterns, const char *text, Sci::Position length=-1);
+	Sci::Position ReplaceAllInTarget(const char *search, const char *replacement);
+	Sci::Position FindAllInTarget(const char *search, bool fillIndicator);
+	void StartSearchInTarget(const char *search, bool fillIndicator);
+	void CancelSearch();
 
 	bool PositionIsHotspot(int position) const;
 	bool PointIsHotspot(Point pt);
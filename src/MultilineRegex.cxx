@@ -0,0 +1,741 @@
+// Scintilla source code edit control
+/** @file MultilineRegex.cxx
+ ** Regular expression search where matches may span lines.
+ **/
+// Copyright 2017 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+/*
+ * The syntax is that of RESearch: . [] [^] * + ? *? +? ^ $ \< \> \( \) and the escapes
+ * \a \b \f \n \r \t \v \xHH \d \D \s \S \w \W, with ( ) instead of \( \) in POSIX mode.
+ * \| (| in POSIX mode) separates alternatives. Back references \1 to \9 can not be
+ * matched by an automaton so are reported as errors.
+ * As the text is not split into lines, . matches any byte except \r and \n while
+ * negated sets like [^a] and \s also match line ends. ^ and $ match at the start and end of
+ * each line.
+ */
+
+#include <stdlib.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "Platform.h"
+
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "CellBuffer.h"
+#include "CharClassify.h"
+#include "MultilineRegex.h"
+
+#ifdef SCI_NAMESPACE
+using namespace Scintilla;
+#endif
+
+namespace {
+
+// Classes of the byte before a position, as needed for ^, $, \<, and \>
+enum { classStart, classCR, classLF, classWord, classOther };
+
+// Limit on the number of instructions so closure recursion is bounded
+const size_t maxProgram = 10000;
+
+// Limit on DFA states, about 1K each, before they are discarded and rebuilt as needed
+const size_t maxStates = 2000;
+
+/**
+ * Parses a pattern into a tree then emits the program for it.
+ */
+class Compiler {
+	enum NodeType { nodeEmpty, nodeSet, nodeAssert, nodeGroup, nodeConcat, nodeAlternate,
+		nodeStar, nodePlus, nodeQuestion };
+	struct Node {
+		NodeType type;
+		int value;	// Set, assertion, or tag
+		int left;
+		int right;
+		bool greedy;
+	};
+	const char *pattern;
+	Sci::Position length;
+	Sci::Position current;
+	bool caseSensitive;
+	bool posix;
+	const CharClassify *charClass;
+	std::vector<Node> nodes;
+
+	char Peek(Sci::Position offset = 0) const {
+		return (current + offset < length) ? pattern[current + offset] : '\0';
+	}
+	bool AtEnd() const {
+		return current >= length;
+	}
+	bool IsGroupStart() const {
+		return posix ? (Peek() == '(') : ((Peek() == '\\') && (Peek(1) == '('));
+	}
+	bool IsGroupEnd() const {
+		return posix ? (Peek() == ')') : ((Peek() == '\\') && (Peek(1) == ')'));
+	}
+	bool IsAlternation() const {
+		return posix ? (Peek() == '|') : ((Peek() == '\\') && (Peek(1) == '|'));
+	}
+	void SkipOperator() {
+		current += posix ? 1 : 2;
+	}
+	int Add(NodeType type, int value, int left = -1, int right = -1, bool greedy = true) {
+		const Node node = { type, value, left, right, greedy };
+		nodes.push_back(node);
+		return static_cast<int>(nodes.size() - 1);
+	}
+	int AddSet(MultilineRegex::ByteSet set) {
+		if (!caseSensitive) {
+			for (int ch = 'A'; ch <= 'Z'; ch++) {
+				const unsigned char chLower = static_cast<unsigned char>(ch - 'A' + 'a');
+				if (set.Contains(static_cast<unsigned char>(ch)) || set.Contains(chLower)) {
+					set.Add(static_cast<unsigned char>(ch));
+					set.Add(chLower);
+				}
+			}
+		}
+		sets.push_back(set);
+		return Add(nodeSet, static_cast<int>(sets.size() - 1));
+	}
+	int AddCharacter(unsigned char ch) {
+		MultilineRegex::ByteSet set;
+		set.Add(ch);
+		return AddSet(set);
+	}
+	int Escape(MultilineRegex::ByteSet &set);
+	int ParseSet();
+	int ParseAtom(bool sequenceStart);
+	int ParseRepeat(bool sequenceStart);
+	int ParseSequence();
+	int ParseAlternation();
+	void Emit(int node);
+	int Emit(MultilineRegex::Operation op, int x = 0, int y = 0) {
+		program.push_back(MultilineRegex::Instruction(op, x, y));
+		return static_cast<int>(program.size() - 1);
+	}
+public:
+	std::vector<MultilineRegex::Instruction> program;
+	std::vector<MultilineRegex::ByteSet> sets;
+	int tags;
+	const char *error;
+
+	Compiler(const char *pattern_, Sci::Position length_, bool caseSensitive_, bool posix_,
+		const CharClassify *charClass_) :
+		pattern(pattern_), length(length_), current(0), caseSensitive(caseSensitive_), posix(posix_),
+		charClass(charClass_), tags(1), error(0) {
+	}
+	void Compile();
+};
+
+int HexDigit(char ch) {
+	if (ch >= '0' && ch <= '9')
+		return ch - '0';
+	if (ch >= 'A' && ch <= 'F')
+		return ch - 'A' + 10;
+	if (ch >= 'a' && ch <= 'f')
+		return ch - 'a' + 10;
+	return -1;
+}
+
+// Interpret the escape after a backslash at current, returning the character or -1 after
+// adding a class of characters to set.
+int Compiler::Escape(MultilineRegex::ByteSet &set) {
+	const char ch = Peek();
+	current++;
+	switch (ch) {
+	case 'a':
+		return '\a';
+	case 'b':
+		return '\b';
+	case 'f':
+		return '\f';
+	case 'n':
+		return '\n';
+	case 'r':
+		return '\r';
+	case 't':
+		return '\t';
+	case 'v':
+		return '\v';
+	case 'x': {
+			const int high = HexDigit(Peek());
+			const int low = HexDigit(Peek(1));
+			if ((high >= 0) && (low >= 0)) {
+				current += 2;
+				return high * 16 + low;
+			}
+			return 'x';	// \x without 2 digits is 'x'
+		}
+	case 'd':
+	case 'D':
+	case 's':
+	case 'S':
+	case 'w':
+	case 'W':
+		for (int c = 0; c < 256; c++) {
+			bool member = false;
+			if ((ch == 'd') || (ch == 'D'))
+				member = (c >= '0') && (c <= '9');
+			else if ((ch == 's') || (ch == 'S'))
+				member = (c == ' ') || ((c >= 0x09) && (c <= 0x0D));
+			else
+				member = charClass->IsWord(static_cast<unsigned char>(c));
+			if ((ch >= 'A') && (ch <= 'Z'))
+				member = !member;
+			if (member)
+				set.Add(static_cast<unsigned char>(c));
+		}
+		return -1;
+	case '\0':
+		return '\\';	// \ at end of pattern is taken literally
+	default:
+		return static_cast<unsigned char>(ch);
+	}
+}
+
+int Compiler::ParseSet() {
+	current++;	// [
+	bool negate = false;
+	if (Peek() == '^') {
+		negate = true;
+		current++;
+	}
+	MultilineRegex::ByteSet set;
+	int previous = -1;
+	// A leading - or ] is literal
+	if ((Peek() == '-') || (Peek() == ']')) {
+		previous = static_cast<unsigned char>(Peek());
+		set.Add(static_cast<unsigned char>(previous));
+		current++;
+	}
+	while (!AtEnd() && (Peek() != ']')) {
+		const char ch = Peek();
+		if ((ch == '-') && (previous >= 0) && (current + 1 < length) && (Peek(1) != ']')) {
+			current++;
+			int last = static_cast<unsigned char>(Peek());
+			current++;
+			if (last == '\\') {
+				MultilineRegex::ByteSet ignored;
+				last = Escape(ignored);
+			}
+			for (int c = previous + 1; c <= last; c++)
+				set.Add(static_cast<unsigned char>(c));
+			previous = -1;
+		} else if ((ch == '\\') && (current + 1 < length)) {
+			current++;
+			previous = Escape(set);
+			if (previous >= 0)
+				set.Add(static_cast<unsigned char>(previous));
+		} else {
+			previous = static_cast<unsigned char>(ch);
+			set.Add(static_cast<unsigned char>(ch));
+			current++;
+		}
+	}
+	if (AtEnd()) {
+		error = "Missing ]";
+		return Add(nodeEmpty, 0);
+	}
+	current++;	// ]
+	if (!negate)
+		return AddSet(set);
+	// Fold case before inverting so [^a] excludes both a and A
+	const int node = AddSet(set);
+	MultilineRegex::ByteSet &added = sets[nodes[node].value];
+	for (int i = 0; i < 8; i++)
+		added.bits[i] = ~added.bits[i];
+	return node;
+}
+
+int Compiler::ParseAtom(bool sequenceStart) {
+	if (IsGroupStart()) {
+		SkipOperator();
+		if (tags >= MultilineRegex::MAXTAG) {
+			error = posix ? "Too many () pairs" : "Too many \\(\\) pairs";
+			return Add(nodeEmpty, 0);
+		}
+		const int tag = tags++;
+		const int inside = ParseAlternation();
+		if (error)
+			return inside;
+		if (!IsGroupEnd()) {
+			error = posix ? "Unmatched (" : "Unmatched \\(";
+			return inside;
+		}
+		SkipOperator();
+		return Add(nodeGroup, tag, inside);
+	}
+	const char ch = Peek();
+	switch (ch) {
+	case '*':
+	case '+':
+	case '?':
+		error = "Empty closure";
+		return Add(nodeEmpty, 0);
+	case '.': {
+			current++;
+			MultilineRegex::ByteSet set;
+			for (int c = 0; c < 256; c++) {
+				if ((c != '\r') && (c != '\n'))
+					set.Add(static_cast<unsigned char>(c));
+			}
+			return AddSet(set);
+		}
+	case '^':
+		current++;
+		if (sequenceStart)
+			return Add(nodeAssert, MultilineRegex::assertLineStart);
+		return AddCharacter('^');
+	case '$':
+		current++;
+		if (AtEnd() || IsGroupEnd() || IsAlternation())
+			return Add(nodeAssert, MultilineRegex::assertLineEnd);
+		return AddCharacter('$');
+	case '[':
+		return ParseSet();
+	case '\\': {
+			current++;
+			const char chEscaped = Peek();
+			if (chEscaped == '<') {
+				current++;
+				return Add(nodeAssert, MultilineRegex::assertWordStart);
+			} else if (chEscaped == '>') {
+				current++;
+				return Add(nodeAssert, MultilineRegex::assertWordEnd);
+			} else if ((chEscaped >= '1') && (chEscaped <= '9')) {
+				error = "Back references are not supported in multiline mode";
+				return Add(nodeEmpty, 0);
+			}
+			MultilineRegex::ByteSet set;
+			const int c = Escape(set);
+			if (c >= 0)
+				return AddCharacter(static_cast<unsigned char>(c));
+			return AddSet(set);
+		}
+	default:
+		current++;
+		return AddCharacter(static_cast<unsigned char>(ch));
+	}
+}
+
+int Compiler::ParseRepeat(bool sequenceStart) {
+	int atom = ParseAtom(sequenceStart);
+	while (!error && ((Peek() == '*') || (Peek() == '+') || (Peek() == '?'))) {
+		const char op = Peek();
+		current++;
+		bool greedy = true;
+		if ((op != '?') && (Peek() == '?')) {
+			greedy = false;
+			current++;
+		}
+		if (nodes[atom].type == nodeAssert) {
+			error = "Illegal closure";
+			break;
+		}
+		const NodeType type = (op == '*') ? nodeStar : ((op == '+') ? nodePlus : nodeQuestion);
+		atom = Add(type, 0, atom, -1, greedy);
+	}
+	return atom;
+}
+
+int Compiler::ParseSequence() {
+	int sequence = Add(nodeEmpty, 0);
+	bool sequenceStart = true;
+	while (!error && !AtEnd() && !IsGroupEnd() && !IsAlternation()) {
+		const int atom = ParseRepeat(sequenceStart);
+		sequence = Add(nodeConcat, 0, sequence, atom);
+		sequenceStart = false;
+	}
+	return sequence;
+}
+
+int Compiler::ParseAlternation() {
+	int alternatives = ParseSequence();
+	while (!error && IsAlternation()) {
+		SkipOperator();
+		const int right = ParseSequence();
+		alternatives = Add(nodeAlternate, 0, alternatives, right);
+	}
+	return alternatives;
+}
+
+void Compiler::Emit(int node) {
+	if (program.size() > maxProgram) {
+		error = "Pattern too long";
+		return;
+	}
+	const Node n = nodes[node];
+	switch (n.type) {
+	case nodeEmpty:
+		break;
+	case nodeSet:
+		Emit(MultilineRegex::opByte, n.value);
+		break;
+	case nodeAssert:
+		Emit(MultilineRegex::opAssert, n.value);
+		break;
+	case nodeGroup:
+		Emit(MultilineRegex::opSave, n.value * 2);
+		Emit(n.left);
+		Emit(MultilineRegex::opSave, n.value * 2 + 1);
+		break;
+	case nodeConcat:
+		Emit(n.left);
+		Emit(n.right);
+		break;
+	case nodeAlternate: {
+			const int split = Emit(MultilineRegex::opSplit);
+			program[split].x = static_cast<int>(program.size());
+			Emit(n.left);
+			const int jump = Emit(MultilineRegex::opJump);
+			program[split].y = static_cast<int>(program.size());
+			Emit(n.right);
+			program[jump].x = static_cast<int>(program.size());
+		}
+		break;
+	case nodeStar: {
+			const int split = Emit(MultilineRegex::opSplit);
+			Emit(n.left);
+			Emit(MultilineRegex::opJump, split);
+			const int body = split + 1;
+			const int after = static_cast<int>(program.size());
+			program[split].x = n.greedy ? body : after;
+			program[split].y = n.greedy ? after : body;
+		}
+		break;
+	case nodePlus: {
+			const int body = static_cast<int>(program.size());
+			Emit(n.left);
+			const int split = Emit(MultilineRegex::opSplit);
+			const int after = split + 1;
+			program[split].x = n.greedy ? body : after;
+			program[split].y = n.greedy ? after : body;
+		}
+		break;
+	case nodeQuestion: {
+			const int split = Emit(MultilineRegex::opSplit);
+			Emit(n.left);
+			const int body = split + 1;
+			const int after = static_cast<int>(program.size());
+			program[split].x = n.greedy ? body : after;
+			program[split].y = n.greedy ? after : body;
+		}
+		break;
+	}
+}
+
+void Compiler::Compile() {
+	if (!length) {
+		error = "No previous regular expression";
+		return;
+	} else if (length > static_cast<Sci::Position>(maxProgram)) {
+		// Emitting recurses through the pattern so limit its length
+		error = "Pattern too long";
+		return;
+	}
+	const int root = ParseAlternation();
+	if (!error && !AtEnd())
+		error = posix ? "Unmatched )" : "Unmatched \\)";
+	if (error)
+		return;
+	Emit(MultilineRegex::opSave, 0);
+	Emit(root);
+	Emit(MultilineRegex::opSave, 1);
+	Emit(MultilineRegex::opMatch);
+}
+
+}
+
+MultilineRegex::MultilineRegex() : charClass(0), tags(0), generation(0) {
+	for (int i = 0; i < MAXTAG; i++) {
+		bopat[i] = -1;
+		eopat[i] = -1;
+	}
+}
+
+const char *MultilineRegex::Compile(const char *pattern, Sci::Position length, bool caseSensitive, bool posix,
+	const CharClassify *charClassTable) {
+	program.clear();
+	sets.clear();
+	states.clear();
+	stateIndex.clear();
+	charClass = charClassTable;
+	Compiler compiler(pattern, length, caseSensitive, posix, charClassTable);
+	compiler.Compile();
+	if (compiler.error)
+		return compiler.error;
+	program = compiler.program;
+	sets = compiler.sets;
+	tags = compiler.tags;
+	marks.assign(program.size(), 0);
+	generation = 0;
+	return 0;
+}
+
+// Marks from earlier generations are stale. When the counter wraps, clear the marks so
+// that none appear current.
+void MultilineRegex::NextGeneration() {
+	generation++;
+	if (generation == 0) {
+		std::fill(marks.begin(), marks.end(), 0);
+		generation = 1;
+	}
+}
+
+size_t MultilineRegex::StatesBuilt() const {
+	return states.size();
+}
+
+int MultilineRegex::ClassOf(unsigned char ch) const {
+	if (ch == '\r')
+		return classCR;
+	else if (ch == '\n')
+		return classLF;
+	else if (charClass->IsWord(ch))
+		return classWord;
+	return classOther;
+}
+
+// next is the byte after the position or -1 at the end of the text.
+bool MultilineRegex::Asserts(int assertion, int previous, int next) const {
+	switch (assertion) {
+	case assertLineStart:
+		return (previous == classStart) || (previous == classLF) || ((previous == classCR) && (next != '\n'));
+	case assertLineEnd:
+		return (next < 0) || (next == '\r') || ((next == '\n') && (previous != classCR));
+	case assertWordStart:
+		return (previous != classWord) && (next >= 0) && charClass->IsWord(static_cast<unsigned char>(next));
+	case assertWordEnd:
+		return (previous == classWord) && !((next >= 0) && charClass->IsWord(static_cast<unsigned char>(next)));
+	}
+	return false;
+}
+
+// Follow the instructions that do not consume a byte from each pending position, collecting
+// the byte consuming instructions reached. Returns true if a match is reached.
+bool MultilineRegex::Closure(const std::vector<int> &pending, int previous, int next, std::vector<int> &consumers) {
+	NextGeneration();
+	consumers.clear();
+	bool matched = false;
+	std::vector<int> stack(pending.rbegin(), pending.rend());
+	while (!stack.empty()) {
+		const int pc = stack.back();
+		stack.pop_back();
+		if (marks[pc] == generation)
+			continue;
+		marks[pc] = generation;
+		const Instruction &instruction = program[pc];
+		switch (instruction.op) {
+		case opByte:
+			consumers.push_back(pc);
+			break;
+		case opSplit:
+			stack.push_back(instruction.y);
+			stack.push_back(instruction.x);
+			break;
+		case opJump:
+			stack.push_back(instruction.x);
+			break;
+		case opSave:
+			stack.push_back(pc + 1);
+			break;
+		case opAssert:
+			if (Asserts(instruction.x, previous, next))
+				stack.push_back(pc + 1);
+			break;
+		case opMatch:
+			matched = true;
+			break;
+		}
+	}
+	return matched;
+}
+
+int MultilineRegex::StateFor(const std::vector<int> &pending, int previous) {
+	std::string key(1, static_cast<char>(previous));
+	key.append(reinterpret_cast<const char *>(&pending[0]), pending.size() * sizeof(pending[0]));
+	std::map<std::string, int>::const_iterator it = stateIndex.find(key);
+	if (it != stateIndex.end())
+		return it->second;
+	State state;
+	state.pending = pending;
+	state.previous = previous;
+	std::fill(state.next, state.next + 256, -1);
+	states.push_back(state);
+	const int index = static_cast<int>(states.size() - 1);
+	stateIndex[key] = index;
+	return index;
+}
+
+// Build the transition from state on ch. When there are too many states they are all
+// discarded so state may change.
+int MultilineRegex::Transition(int &state, unsigned char ch) {
+	if (states.size() >= maxStates) {
+		const std::vector<int> pending = states[state].pending;
+		const int previous = states[state].previous;
+		states.clear();
+		stateIndex.clear();
+		state = StateFor(pending, previous);
+	}
+	std::vector<int> consumers;
+	int transition = 1;
+	if (!Closure(states[state].pending, states[state].previous, ch, consumers)) {
+		// The start of the program is always pending as any position may start a match
+		std::vector<int> pending(1, 0);
+		for (std::vector<int>::const_iterator it = consumers.begin(); it != consumers.end(); ++it) {
+			if (sets[program[*it].x].Contains(ch))
+				pending.push_back(*it + 1);
+		}
+		std::sort(pending.begin(), pending.end());
+		pending.erase(std::unique(pending.begin(), pending.end()), pending.end());
+		transition = StateFor(pending, ClassOf(ch)) << 1;
+	}
+	states[state].next[ch] = transition;
+	return transition;
+}
+
+/**
+ * Find the leftmost match starting in [startPos, endPos] and ending before endPos.
+ * The DFA finds the earliest position where any match ends and the last position before
+ * that where no partial match was in progress. The leftmost match must start between those
+ * so only that range is simulated to find the match and its tagged sections.
+ */
+bool MultilineRegex::Execute(const GapText &text, Sci::Position startPos, Sci::Position endPos) {
+	for (int i = 0; i < MAXTAG; i++) {
+		bopat[i] = -1;
+		eopat[i] = -1;
+	}
+	if (program.empty() || (startPos > endPos))
+		return false;
+	const std::vector<int> startPending(1, 0);
+	int state = StateFor(startPending,
+		(startPos > 0) ? ClassOf(static_cast<unsigned char>(text.CharAt(startPos - 1))) : classStart);
+	Sci::Position startPossible = startPos;
+	Sci::Position pos = startPos;
+	bool found = false;
+	// Each side of the gap is scanned as contiguous memory
+	for (int segment = 0; (segment < 2) && !found; segment++) {
+		const unsigned char *bytes = reinterpret_cast<const unsigned char *>(segment ? text.After() : text.Before());
+		const Sci::Position offset = segment ? text.Gap() : 0;
+		const Sci::Position segmentEnd = segment ? endPos : std::min(endPos, text.Gap());
+		for (; pos < segmentEnd; pos++) {
+			if (states[state].pending.size() == 1)
+				startPossible = pos;
+			const unsigned char ch = bytes[pos - offset];
+			int transition = states[state].next[ch];
+			if (transition < 0)
+				transition = Transition(state, ch);
+			if (transition & 1) {
+				found = true;
+				break;
+			}
+			state = transition >> 1;
+		}
+	}
+	if (!found) {
+		// At endPos the assertions depend on the following text
+		if (states[state].pending.size() == 1)
+			startPossible = endPos;
+		std::vector<int> consumers;
+		const int next = (endPos < text.Length()) ? static_cast<unsigned char>(text.CharAt(endPos)) : -1;
+		found = Closure(states[state].pending, states[state].previous, next, consumers);
+	}
+	return found && Simulate(text, startPossible, endPos);
+}
+
+void MultilineRegex::AddThread(std::vector<int> &pcs, std::vector<Sci::Position> &caps, int pc,
+	std::vector<Sci::Position> &capsThread, Sci::Position pos, int previous, int next) {
+	if (marks[pc] == generation)
+		return;
+	marks[pc] = generation;
+	const Instruction &instruction = program[pc];
+	switch (instruction.op) {
+	case opSplit:
+		AddThread(pcs, caps, instruction.x, capsThread, pos, previous, next);
+		AddThread(pcs, caps, instruction.y, capsThread, pos, previous, next);
+		break;
+	case opJump:
+		AddThread(pcs, caps, instruction.x, capsThread, pos, previous, next);
+		break;
+	case opSave: {
+			const Sci::Position saved = capsThread[instruction.x];
+			capsThread[instruction.x] = pos;
+			AddThread(pcs, caps, pc + 1, capsThread, pos, previous, next);
+			capsThread[instruction.x] = saved;
+		}
+		break;
+	case opAssert:
+		if (Asserts(instruction.x, previous, next))
+			AddThread(pcs, caps, pc + 1, capsThread, pos, previous, next);
+		break;
+	case opByte:
+	case opMatch:
+		pcs.push_back(pc);
+		std::copy(capsThread.begin(), capsThread.end(), caps.begin() + pc * capsThread.size());
+		break;
+	}
+}
+
+// Run the program as an NFA, in priority order, to find the leftmost match starting at or after startPos.
+bool MultilineRegex::Simulate(const GapText &text, Sci::Position startPos, Sci::Position endPos) {
+	const size_t slots = tags * 2;
+	std::vector<int> &current = threadsCurrent;
+	std::vector<int> &following = threadsFollowing;
+	current.clear();
+	following.clear();
+	capsCurrent.assign(program.size() * slots, -1);
+	capsFollowing.assign(program.size() * slots, -1);
+	capsThread.assign(slots, -1);
+	capsMatch.clear();
+	int previous = (startPos > 0) ? ClassOf(static_cast<unsigned char>(text.CharAt(startPos - 1))) : classStart;
+	Sci::Position pos = startPos;
+	int next = (pos < text.Length()) ? static_cast<unsigned char>(text.CharAt(pos)) : -1;
+	NextGeneration();
+	for (;;) {
+		if (capsMatch.empty()) {
+			// Lowest priority thread starting here
+			std::fill(capsThread.begin(), capsThread.end(), -1);
+			AddThread(current, capsCurrent, 0, capsThread, pos, previous, next);
+		}
+		if (current.empty())
+			break;
+		const int nextFollowing = (pos + 1 < text.Length()) ? static_cast<unsigned char>(text.CharAt(pos + 1)) : -1;
+		NextGeneration();
+		for (std::vector<int>::const_iterator it = current.begin(); it != current.end(); ++it) {
+			const int pc = *it;
+			if (program[pc].op == opMatch) {
+				capsMatch.assign(capsCurrent.begin() + pc * slots, capsCurrent.begin() + (pc + 1) * slots);
+				// Lower priority threads can not affect the result
+				break;
+			}
+			if ((pos < endPos) && sets[program[pc].x].Contains(static_cast<unsigned char>(next))) {
+				std::copy(capsCurrent.begin() + pc * slots, capsCurrent.begin() + (pc + 1) * slots, capsThread.begin());
+				AddThread(following, capsFollowing, pc + 1, capsThread, pos + 1, ClassOf(static_cast<unsigned char>(next)),
+					nextFollowing);
+			}
+		}
+		if (pos >= endPos)
+			break;
+		current.swap(following);
+		capsCurrent.swap(capsFollowing);
+		following.clear();
+		previous = ClassOf(static_cast<unsigned char>(next));
+		pos++;
+		next = nextFollowing;
+	}
+	if (capsMatch.empty())
+		return false;
+	for (int i = 0; i < tags; i++) {
+		bopat[i] = capsMatch[i * 2];
+		eopat[i] = capsMatch[i * 2 + 1];
+	}
+	return true;
+}
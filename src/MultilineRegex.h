@@ -0,0 +1,97 @@
+// Scintilla source code edit control
+/** @file MultilineRegex.h
+ ** Regular expression search where matches may span lines.
+ **/
+// Copyright 2017 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef MULTILINEREGEX_H
+#define MULTILINEREGEX_H
+
+#ifdef SCI_NAMESPACE
+namespace Scintilla {
+#endif
+
+/**
+ * Regular expression engine that reads the text directly from either side of the gap and
+ * treats it as one sequence of bytes so line ends can be matched with \n, \r, or classes.
+ * The pattern is compiled to a program which is first run as a lazily built DFA to find where
+ * the earliest match ends. Then it is simulated as an NFA over the short range where that
+ * match may start to find the leftmost match and its tagged sections.
+ */
+class MultilineRegex {
+public:
+	enum { MAXTAG=10 };
+
+	enum Operation { opByte, opSplit, opJump, opSave, opAssert, opMatch };
+	enum Assertion { assertLineStart, assertLineEnd, assertWordStart, assertWordEnd };
+	struct Instruction {
+		Operation op;
+		int x;	// Byte set for opByte, preferred target for opSplit, target for opJump, slot for opSave, assertion
+		int y;	// Other target for opSplit
+		Instruction(Operation op_, int x_, int y_) : op(op_), x(x_), y(y_) {
+		}
+	};
+	struct ByteSet {
+		unsigned int bits[8];
+		ByteSet() {
+			for (int i = 0; i < 8; i++)
+				bits[i] = 0;
+		}
+		void Add(unsigned char ch) {
+			bits[ch >> 5] |= 1U << (ch & 31);
+		}
+		bool Contains(unsigned char ch) const {
+			return (bits[ch >> 5] & (1U << (ch & 31))) != 0;
+		}
+	};
+
+	MultilineRegex();
+	const char *Compile(const char *pattern, Sci::Position length, bool caseSensitive, bool posix,
+		const CharClassify *charClassTable);
+	bool Execute(const GapText &text, Sci::Position startPos, Sci::Position endPos);
+	size_t StatesBuilt() const;
+
+	Sci::Position bopat[MAXTAG];
+	Sci::Position eopat[MAXTAG];
+
+private:
+	// Lazily built DFA state for a set of program positions waiting for the next byte.
+	struct State {
+		std::vector<int> pending;
+		int previous;
+		int next[256];	// -1 when not built, else (state << 1) | 1 when a match ends before the byte
+	};
+
+	const CharClassify *charClass;
+	std::vector<Instruction> program;
+	std::vector<ByteSet> sets;
+	int tags;
+	std::vector<State> states;
+	std::map<std::string, int> stateIndex;
+	std::vector<unsigned int> marks;
+	unsigned int generation;
+	// Thread lists and captures used by Simulate, kept to avoid allocating for each search
+	std::vector<int> threadsCurrent;
+	std::vector<int> threadsFollowing;
+	std::vector<Sci::Position> capsCurrent;
+	std::vector<Sci::Position> capsFollowing;
+	std::vector<Sci::Position> capsThread;
+	std::vector<Sci::Position> capsMatch;
+
+	void NextGeneration();
+	int ClassOf(unsigned char ch) const;
+	bool Asserts(int assertion, int previous, int next) const;
+	bool Closure(const std::vector<int> &pending, int previous, int next, std::vector<int> &consumers);
+	int StateFor(const std::vector<int> &pending, int previous);
+	int Transition(int &state, unsigned char ch);
+	bool Simulate(const GapText &text, Sci::Position startPos, Sci::Position endPos);
+	void AddThread(std::vector<int> &pcs, std::vector<Sci::Position> &caps, int pc,
+		std::vector<Sci::Position> &capsThread, Sci::Position pos, int previous, int next);
+};
+
+#ifdef SCI_NAMESPACE
+}
+#endif
+
+#endif
@@ -8,38 +8,67 @@
 #ifndef PARTITIONING_H
 #define PARTITIONING_H
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define PARTITIONING_SSE2
+#endif
+
 #ifdef SCI_NAMESPACE
 namespace Scintilla {
 #endif
 
+/// Add delta to each element of a contiguous array.
+template <typename T>
+inline void AddToArray(T *values, ptrdiff_t length, T delta) {
+	for (ptrdiff_t i = 0; i < length; i++) {
+		values[i] += delta;
+	}
+}
+
+/// Line start positions are most often int so add 8 at a time, as two 4 element vectors, when SSE2 is available.
+/// Release builds are optimized for size which stops compilers vectorizing the loop above.
+inline void AddToArray(int *values, ptrdiff_t length, int delta) {
+	ptrdiff_t i = 0;
+#ifdef PARTITIONING_SSE2
+	const __m128i deltas = _mm_set1_epi32(delta);
+	for (; i + 8 <= length; i += 8) {
+		__m128i *p = reinterpret_cast<__m128i *>(values + i);
+		const __m128i a = _mm_add_epi32(_mm_loadu_si128(p), deltas);
+		const __m128i b = _mm_add_epi32(_mm_loadu_si128(p + 1), deltas);
+		_mm_storeu_si128(p, a);
+		_mm_storeu_si128(p + 1, b);
+	}
+#endif
+	for (; i < length; i++) {
+		values[i] += delta;
+	}
+}
+
 /// A split vector of integers with a method for adding a value to all elements
 /// in a range.
 /// Used by the Partitioning class.
 
-class SplitVectorWithRangeAdd : public SplitVector<int> {
+template <typename T>
+class SplitVectorWithRangeAdd : public SplitVector<T> {
 public:
-	explicit SplitVectorWithRangeAdd(int growSize_) {
-		SetGrowSize(growSize_);
-		ReAllocate(growSize_);
+	explicit SplitVectorWithRangeAdd(ptrdiff_t growSize_) {
+		this->SetGrowSize(growSize_);
+		this->ReAllocate(growSize_);
 	}
 	~SplitVectorWithRangeAdd() {
 	}
-	void RangeAddDelta(int start, int end, int delta) {
+	void RangeAddDelta(ptrdiff_t start, ptrdiff_t end, T delta) {
 		// end is 1 past end, so end-start is number of elements to change
-		int i = 0;
-		int rangeLength = end - start;
-		int range1Length = rangeLength;
-		int part1Left = part1Length - start;
-		if (range1Length > part1Left)
-			range1Length = part1Left;
-		while (i < range1Length) {
-			body[start++] += delta;
-			i++;
+		if (start >= end)
+			return;
+		// Each side of the gap is contiguous so add to each as an array
+		const ptrdiff_t end1 = (end < this->part1Length) ? end : this->part1Length;
+		if (start < end1) {
+			AddToArray(this->body + start, end1 - start, delta);
 		}
-		start += gapLength;
-		while (i < rangeLength) {
-			body[start++] += delta;
-			i++;
+		const ptrdiff_t start2 = (start > this->part1Length) ? start : this->part1Length;
+		if (start2 < end) {
+			AddToArray(this->body + start2 + this->gapLength, end - start2, delta);
 		}
 	}
 };
@@ -50,37 +79,40 @@ public:
 /// If interval not 0 length then each partition non-zero length
 /// When needed, positions after the interval are considered part of the last partition
 /// but the end of the last partition can be found with PositionFromPartition(last+1).
+/// T is the type of both the positions stored and the partition indices, so a
+/// Partitioning<int> is half the size of a Partitioning<ptrdiff_t>.
 
+template <typename T>
 class Partitioning {
 private:
 	// To avoid calculating all the partition positions whenever any text is inserted
 	// there may be a step somewhere in the list.
-	int stepPartition;
-	int stepLength;
-	SplitVectorWithRangeAdd *body;
+	T stepPartition;
+	T stepLength;
+	SplitVectorWithRangeAdd<T> *body;
 
 	// Move step forward
-	void ApplyStep(int partitionUpTo) {
+	void ApplyStep(T partitionUpTo) {
 		if (stepLength != 0) {
 			body->RangeAddDelta(stepPartition+1, partitionUpTo + 1, stepLength);
 		}
 		stepPartition = partitionUpTo;
 		if (stepPartition >= body->Length()-1) {
-			stepPartition = body->Length()-1;
+			stepPartition = static_cast<T>(body->Length())-1;
 			stepLength = 0;
 		}
 	}
 
 	// Move step backward
-	void BackStep(int partitionDownTo) {
+	void BackStep(T partitionDownTo) {
 		if (stepLength != 0) {
 			body->RangeAddDelta(partitionDownTo+1, stepPartition+1, -stepLength);
 		}
 		stepPartition = partitionDownTo;
 	}
 
-	void Allocate(int growSize) {
-		body = new SplitVectorWithRangeAdd(growSize);
+	void Allocate(ptrdiff_t growSize) {
+		body = new SplitVectorWithRangeAdd<T>(growSize);
 		stepPartition = 0;
 		stepLength = 0;
 		body->Insert(0, 0);	// This value stays 0 for ever
@@ -88,7 +120,7 @@ private:
 	}
 
 public:
-	explicit Partitioning(int growSize) {
+	explicit Partitioning(ptrdiff_t growSize) {
 		Allocate(growSize);
 	}
 
@@ -97,11 +129,11 @@ public:
 		body = 0;
 	}
 
-	int Partitions() const {
-		return body->Length()-1;
+	T Partitions() const {
+		return static_cast<T>(body->Length())-1;
 	}
 
-	void InsertPartition(int partition, int pos) {
+	void InsertPartition(T partition, T pos) {
 		if (stepPartition < partition) {
 			ApplyStep(partition);
 		}
@@ -109,27 +141,39 @@ public:
 		stepPartition++;
 	}
 
-	void SetPartitionStartPosition(int partition, int pos) {
-		ApplyStep(partition+1);
+	/// Insert a sequence of partitions starting at partition with one array copy.
+	void InsertPartitions(T partition, const T *positions, size_t length) {
+		if (stepPartition < partition) {
+			ApplyStep(partition);
+		}
+		body->InsertFromArray(partition, positions, 0, length);
+		stepPartition += static_cast<T>(length);
+	}
+
+	void SetPartitionStartPosition(T partition, T pos) {
+		// Values up to the step do not include stepLength so only apply when step is before
+		if (stepPartition < partition+1) {
+			ApplyStep(partition+1);
+		}
 		if ((partition < 0) || (partition > body->Length())) {
 			return;
 		}
 		body->SetValueAt(partition, pos);
 	}
 
-	void InsertText(int partitionInsert, int delta) {
+	void InsertText(T partitionInsert, T delta) {
 		// Point all the partitions after the insertion point further along in the buffer
 		if (stepLength != 0) {
 			if (partitionInsert >= stepPartition) {
 				// Fill in up to the new insertion point
 				ApplyStep(partitionInsert);
 				stepLength += delta;
-			} else if (partitionInsert >= (stepPartition - body->Length() / 10)) {
+			} else if (partitionInsert >= (stepPartition - static_cast<T>(body->Length()) / 10)) {
 				// Close to step but before so move step back
 				BackStep(partitionInsert);
 				stepLength += delta;
 			} else {
-				ApplyStep(body->Length()-1);
+				ApplyStep(static_cast<T>(body->Length())-1);
 				stepPartition = partitionInsert;
 				stepLength = delta;
 			}
@@ -139,7 +183,7 @@ public:
 		}
 	}
 
-	void RemovePartition(int partition) {
+	void RemovePartition(T partition) {
 		if (partition > stepPartition) {
 			ApplyStep(partition);
 			stepPartition--;
@@ -149,29 +193,42 @@ public:
 		body->Delete(partition);
 	}
 
-	int PositionFromPartition(int partition) const {
+	/// Remove lengthRemove partitions starting at partition with one array move.
+	void RemovePartitions(T partition, T lengthRemove) {
+		if (lengthRemove <= 0)
+			return;
+		if (stepPartition >= partition + lengthRemove) {
+			stepPartition -= lengthRemove;
+		} else if (stepPartition >= partition) {
+			// Partitions following the removed range were all after the step
+			stepPartition = partition - 1;
+		}
+		body->DeleteRange(partition, lengthRemove);
+	}
+
+	T PositionFromPartition(T partition) const {
 		PLATFORM_ASSERT(partition >= 0);
 		PLATFORM_ASSERT(partition < body->Length());
 		if ((partition < 0) || (partition >= body->Length())) {
 			return 0;
 		}
-		int pos = body->ValueAt(partition);
+		T pos = body->ValueAt(partition);
 		if (partition > stepPartition)
 			pos += stepLength;
 		return pos;
 	}
 
 	/// Return value in range [0 .. Partitions() - 1] even for arguments outside interval
-	int PartitionFromPosition(int pos) const {
+	T PartitionFromPosition(T pos) const {
 		if (body->Length() <= 1)
 			return 0;
 		if (pos >= (PositionFromPartition(body->Length()-1)))
-			return body->Length() - 1 - 1;
-		int lower = 0;
-		int upper = body->Length()-1;
+			return static_cast<T>(body->Length() - 1 - 1);
+		T lower = 0;
+		T upper = static_cast<T>(body->Length()-1);
 		do {
-			int middle = (upper + lower + 1) / 2; 	// Round high
-			int posMiddle = body->ValueAt(middle);
+			T middle = (upper + lower + 1) / 2; 	// Round high
+			T posMiddle = body->ValueAt(middle);
 			if (middle > stepPartition)
 				posMiddle += stepLength;
 			if (pos < posMiddle) {
@@ -184,7 +241,7 @@ public:
 	}
 
 	void DeleteAll() {
-		int growSize = body->GetGrowSize();
+		const ptrdiff_t growSize = body->GetGrowSize();
 		delete body;
 		Allocate(growSize);
 	}
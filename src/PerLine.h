@@ -49,16 +49,18 @@ public:
 	}
 	virtual ~LineMarkers();
 	virtual void Init();
-	virtual void InsertLine(int line);
-	virtual void RemoveLine(int line);
-
-	int MarkValue(int line);
-	int MarkerNext(int lineStart, int mask) const;
-	int AddMark(int line, int marker, int lines);
-	void MergeMarkers(int pos);
-	bool DeleteMark(int line, int markerNum, bool all);
+	virtual void InsertLine(Sci::Line line);
+	virtual void InsertLines(Sci::Line line, Sci::Line lines);
+	virtual void RemoveLine(Sci::Line line);
+	virtual void RemoveLines(Sci::Line line, Sci::Line lines);
+
+	int MarkValue(Sci::Line line);
+	Sci::Line MarkerNext(Sci::Line lineStart, int mask) const;
+	int AddMark(Sci::Line line, int marker, Sci::Line lines);
+	void MergeMarkers(Sci::Line line);
+	bool DeleteMark(Sci::Line line, int markerNum, bool all);
 	void DeleteMarkFromHandle(int markerHandle);
-	int LineFromHandle(int markerHandle);
+	Sci::Line LineFromHandle(int markerHandle);
 };
 
 class LineLevels : public PerLine {
@@ -66,13 +68,15 @@ class LineLevels : public PerLine {
 public:
 	virtual ~LineLevels();
 	virtual void Init();
-	virtual void InsertLine(int line);
-	virtual void RemoveLine(int line);
+	virtual void InsertLine(Sci::Line line);
+	virtual void InsertLines(Sci::Line line, Sci::Line lines);
+	virtual void RemoveLine(Sci::Line line);
+	virtual void RemoveLines(Sci::Line line, Sci::Line lines);
 
-	void ExpandLevels(int sizeNew=-1);
+	void ExpandLevels(Sci::Line sizeNew=-1);
 	void ClearLevels();
-	int SetLevel(int line, int level, int lines);
-	int GetLevel(int line) const;
+	int SetLevel(Sci::Line line, int level, Sci::Line lines);
+	int GetLevel(Sci::Line line) const;
 };
 
 class LineState : public PerLine {
@@ -82,11 +86,13 @@ public:
 	}
 	virtual ~LineState();
 	virtual void Init();
-	virtual void InsertLine(int line);
-	virtual void RemoveLine(int line);
+	virtual void InsertLine(Sci::Line line);
+	virtual void InsertLines(Sci::Line line, Sci::Line lines);
+	virtual void RemoveLine(Sci::Line line);
+	virtual void RemoveLines(Sci::Line line, Sci::Line lines);
 
-	int SetLineState(int line, int state);
-	int GetLineState(int line);
+	int SetLineState(Sci::Line line, int state);
+	int GetLineState(Sci::Line line);
 	int GetMaxLineState() const;
 };
 
@@ -97,19 +103,21 @@ public:
 	}
 	virtual ~LineAnnotation();
 	virtual void Init();
-	virtual void InsertLine(int line);
-	virtual void RemoveLine(int line);
-
-	bool MultipleStyles(int line) const;
-	int Style(int line) const;
-	const char *Text(int line) const;
-	const unsigned char *Styles(int line) const;
-	void SetText(int line, const char *text);
+	virtual void InsertLine(Sci::Line line);
+	virtual void InsertLines(Sci::Line line, Sci::Line lines);
+	virtual void RemoveLine(Sci::Line line);
+	virtual void RemoveLines(Sci::Line line, Sci::Line lines);
+
+	bool MultipleStyles(Sci::Line line) const;
+	int Style(Sci::Line line) const;
+	const char *Text(Sci::Line line) const;
+	const unsigned char *Styles(Sci::Line line) const;
+	void SetText(Sci::Line line, const char *text);
 	void ClearAll();
-	void SetStyle(int line, int style);
-	void SetStyles(int line, const unsigned char *styles);
-	int Length(int line) const;
-	int Lines(int line) const;
+	void SetStyle(Sci::Line line, int style);
+	void SetStyles(Sci::Line line, const unsigned char *styles);
+	int Length(Sci::Line line) const;
+	int Lines(Sci::Line line) const;
 };
 
 typedef std::vector<int> TabstopList;
@@ -121,12 +129,14 @@ public:
 	}
 	virtual ~LineTabstops();
 	virtual void Init();
-	virtual void InsertLine(int line);
-	virtual void RemoveLine(int line);
-
-	bool ClearTabstops(int line);
-	bool AddTabstop(int line, int x);
-	int GetNextTabstop(int line, int x) const;
+	virtual void InsertLine(Sci::Line line);
+	virtual void InsertLines(Sci::Line line, Sci::Line lines);
+	virtual void RemoveLine(Sci::Line line);
+	virtual void RemoveLines(Sci::Line line, Sci::Line lines);
+
+	bool ClearTabstops(Sci::Line line);
+	bool AddTabstop(Sci::Line line, int x);
+	int GetNextTabstop(Sci::Line line, int x) const;
 };
 
 #ifdef SCI_NAMESPACE
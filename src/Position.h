@@ -8,6 +8,8 @@
 #ifndef POSITION_H
 #define POSITION_H
 
+#include <stddef.h>
+
 /**
  * A Position is a position within a document between two characters or at the beginning or end.
  * Sometimes used as a character index where it identifies the character after the position.
@@ -15,12 +17,10 @@
 
 namespace Sci {
 
-typedef int Position;
-
-// A later version (4.x) of this file may:
-//#if defined(SCI_LARGE_FILE_SUPPORT)
-//typedef std::ptrdiff_t Position;
-// or may allow runtime choice between different position sizes.
+// Positions and line numbers are pointer sized so documents larger than 2 GB can be held.
+// Storage that is usually small, such as the line start table, may still use int internally.
+typedef ptrdiff_t Position;
+typedef ptrdiff_t Line;
 
 const Position invalidPosition = -1;
 
@@ -9,12 +9,14 @@
 #include <string.h>
 #include <stdio.h>
 #include <ctype.h>
+#include <math.h>
 
 #include <stdexcept>
 #include <string>
 #include <vector>
 #include <map>
 #include <algorithm>
+#include <climits>
 
 #include "Platform.h"
 
@@ -40,16 +42,82 @@
 #include "UniConversion.h"
 #include "Selection.h"
 #include "PositionCache.h"
+#include "CompactPositions.h"
 
 #ifdef SCI_NAMESPACE
 using namespace Scintilla;
 #endif
 
-LineLayout::LineLayout(int maxLineLength_) :
+LayoutPool::LayoutPool() : slabUsed(0), bytesAllocated(0) {
+	for (int i = 0; i < sizeClasses; i++)
+		freeBlocks[i] = 0;
+}
+
+LayoutPool::~LayoutPool() {
+	Clear();
+}
+
+size_t LayoutPool::BlockSize(size_t bytes) {
+	return (bytes + granularity - 1) / granularity * granularity;
+}
+
+char *LayoutPool::Allocate(size_t bytes) {
+	const size_t size = BlockSize(bytes);
+	if (size > granularity * sizeClasses) {
+		bytesAllocated += size;
+		return new char[size];
+	}
+	char *&freeBlock = freeBlocks[size / granularity - 1];
+	if (freeBlock) {
+		// Free blocks hold a pointer to the next free block of their size
+		char *block = freeBlock;
+		memcpy(&freeBlock, block, sizeof(char *));
+		return block;
+	}
+	if (slabs.empty() || (slabUsed + size > slabSize)) {
+		slabs.push_back(new char[slabSize]);
+		bytesAllocated += slabSize;
+		slabUsed = 0;
+	}
+	char *block = slabs.back() + slabUsed;
+	slabUsed += size;
+	return block;
+}
+
+void LayoutPool::Free(char *block, size_t bytes) {
+	const size_t size = BlockSize(bytes);
+	if (size > granularity * sizeClasses) {
+		bytesAllocated -= size;
+		delete []block;
+	} else {
+		char *&freeBlock = freeBlocks[size / granularity - 1];
+		memcpy(block, &freeBlock, sizeof(char *));
+		freeBlock = block;
+	}
+}
+
+// Release all slabs. Every block must have been freed.
+void LayoutPool::Clear() {
+	for (size_t i = 0; i < slabs.size(); i++) {
+		delete []slabs[i];
+		bytesAllocated -= slabSize;
+	}
+	slabs.clear();
+	slabUsed = 0;
+	for (int j = 0; j < sizeClasses; j++)
+		freeBlocks[j] = 0;
+}
+
+LineLayout::LineLayout(int maxLineLength_, LayoutPool *pool_) :
 	lineStarts(0),
 	lenLineStarts(0),
 	lineNumber(-1),
 	inCache(false),
+	moreRecent(0),
+	lessRecent(0),
+	bytesCounted(0),
+	pool(pool_),
+	positionsCompact(0),
 	maxLineLength(-1),
 	numCharsInLine(0),
 	numCharsBeforeEOL(0),
@@ -74,27 +142,90 @@ LineLayout::~LineLayout() {
 	Free();
 }
 
+char *LineLayout::AllocateBlock(size_t bytes) {
+	return pool ? pool->Allocate(bytes) : new char[bytes];
+}
+
+void LineLayout::FreeBlock(char *block, size_t bytes) {
+	if (pool)
+		pool->Free(block, bytes);
+	else
+		delete []block;
+}
+
 void LineLayout::Resize(int maxLineLength_) {
 	if (maxLineLength_ > maxLineLength) {
 		Free();
-		chars = new char[maxLineLength_ + 1];
-		styles = new unsigned char[maxLineLength_ + 1];
+		// Characters and styles share one block
+		chars = AllocateBlock((maxLineLength_ + 1) * 2);
+		styles = reinterpret_cast<unsigned char *>(chars + maxLineLength_ + 1);
 		// Extra position allocated as sometimes the Windows
 		// GetTextExtentExPoint API writes an extra element.
-		positions = new XYPOSITION[maxLineLength_ + 1 + 1];
+		positions = reinterpret_cast<XYPOSITION *>(AllocateBlock((maxLineLength_ + 1 + 1) * sizeof(XYPOSITION)));
 		maxLineLength = maxLineLength_;
 	}
 }
 
 void LineLayout::Free() {
-	delete []chars;
+	if (chars)
+		FreeBlock(chars, (maxLineLength + 1) * 2);
 	chars = 0;
-	delete []styles;
 	styles = 0;
-	delete []positions;
+	if (positions)
+		FreeBlock(reinterpret_cast<char *>(positions), (maxLineLength + 1 + 1) * sizeof(XYPOSITION));
 	positions = 0;
+	if (positionsCompact)
+		FreeBlock(reinterpret_cast<char *>(positionsCompact), (maxLineLength + 1 + 1) * sizeof(unsigned short));
+	positionsCompact = 0;
 	delete []lineStarts;
 	lineStarts = 0;
+	lenLineStarts = 0;
+}
+
+size_t LineLayout::MemoryUsed() const {
+	size_t bytes = sizeof(LineLayout) + lenLineStarts * sizeof(int);
+	if (chars)
+		bytes += LayoutPool::BlockSize((maxLineLength + 1) * 2);
+	if (positions)
+		bytes += LayoutPool::BlockSize((maxLineLength + 1 + 1) * sizeof(XYPOSITION));
+	if (positionsCompact)
+		bytes += LayoutPool::BlockSize((maxLineLength + 1 + 1) * sizeof(unsigned short));
+	return bytes;
+}
+
+/**
+ * While a cached layout is not being used, store the width of each character in 16-bit fixed point
+ * which is half the size of XYPOSITION.
+ * When the text is not valid, positions are not needed so are freed.
+ * Positions stay as XYPOSITION when a character is 1024 or more pixels wide or the line is huge.
+ */
+void LineLayout::CompactPositions() {
+	if (!positions)
+		return;
+	const size_t lenPositions = maxLineLength + 1 + 1;
+	if (validity != llInvalid) {
+		unsigned short *compact = reinterpret_cast<unsigned short *>(AllocateBlock(lenPositions * sizeof(unsigned short)));
+		if (!CompactPositionsStore(positions, numCharsInLine, compact)) {
+			FreeBlock(reinterpret_cast<char *>(compact), lenPositions * sizeof(unsigned short));
+			return;
+		}
+		positionsCompact = compact;
+	}
+	FreeBlock(reinterpret_cast<char *>(positions), lenPositions * sizeof(XYPOSITION));
+	positions = 0;
+}
+
+void LineLayout::ExpandPositions() {
+	if (positions)
+		return;
+	const size_t lenPositions = maxLineLength + 1 + 1;
+	positions = reinterpret_cast<XYPOSITION *>(AllocateBlock(lenPositions * sizeof(XYPOSITION)));
+	positions[0] = 0;
+	if (positionsCompact) {
+		CompactPositionsLoad(positionsCompact, numCharsInLine, positions);
+		FreeBlock(reinterpret_cast<char *>(positionsCompact), lenPositions * sizeof(unsigned short));
+		positionsCompact = 0;
+	}
 }
 
 void LineLayout::Invalidate(validLevel validity_) {
@@ -148,7 +279,7 @@ void LineLayout::SetLineStart(int line, int start) {
 	lineStarts[line] = start;
 }
 
-void LineLayout::SetBracesHighlight(Range rangeLine, const Position braces[],
+void LineLayout::SetBracesHighlight(Range rangeLine, const Sci::Position braces[],
                                     char bracesMatchStyle, int xHighlight, bool ignoreStyle) {
 	if (!ignoreStyle && rangeLine.ContainsCharacter(braces[0])) {
 		int braceOffset = braces[0] - rangeLine.start;
@@ -170,7 +301,7 @@ void LineLayout::SetBracesHighlight(Range rangeLine, const Position braces[],
 	}
 }
 
-void LineLayout::RestoreBracesHighlight(Range rangeLine, const Position braces[], bool ignoreStyle) {
+void LineLayout::RestoreBracesHighlight(Range rangeLine, const Sci::Position braces[], bool ignoreStyle) {
 	if (!ignoreStyle && rangeLine.ContainsCharacter(braces[0])) {
 		int braceOffset = braces[0] - rangeLine.start;
 		if (braceOffset < numCharsInLine) {
@@ -245,44 +376,98 @@ int LineLayout::EndLineStyle() const {
 }
 
 LineLayoutCache::LineLayoutCache() :
-	level(0),
-	allInvalidated(false), styleClock(-1), useCount(0) {
-	Allocate(0);
+	level(0), mostRecent(0), leastRecent(0), layouts(0), layoutsAllowed(0),
+	bytesUsed(0), bytesBudget(0), lineCaret(-1),
+	allInvalidated(false), useCount(0) {
 }
 
 LineLayoutCache::~LineLayoutCache() {
 	Deallocate();
 }
 
-void LineLayoutCache::Allocate(size_t length_) {
-	PLATFORM_ASSERT(cache.empty());
-	allInvalidated = false;
-	cache.resize(length_);
+// Index in cache of the first layout of a line at or after lineNumber.
+size_t LineLayoutCache::IndexOfLine(int lineNumber) const {
+	size_t lower = 0;
+	size_t upper = cache.size();
+	while (lower < upper) {
+		const size_t middle = (lower + upper) / 2;
+		if (cache[middle]->lineNumber < lineNumber)
+			lower = middle + 1;
+		else
+			upper = middle;
+	}
+	return lower;
+}
+
+// Make ll the most recently used layout.
+void LineLayoutCache::Link(LineLayout *ll) {
+	ll->moreRecent = 0;
+	ll->lessRecent = mostRecent;
+	if (mostRecent)
+		mostRecent->moreRecent = ll;
+	mostRecent = ll;
+	if (!leastRecent)
+		leastRecent = ll;
+}
+
+void LineLayoutCache::Unlink(LineLayout *ll) {
+	if (ll->moreRecent)
+		ll->moreRecent->lessRecent = ll->lessRecent;
+	else
+		mostRecent = ll->lessRecent;
+	if (ll->lessRecent)
+		ll->lessRecent->moreRecent = ll->moreRecent;
+	else
+		leastRecent = ll->moreRecent;
+	ll->moreRecent = 0;
+	ll->lessRecent = 0;
+}
+
+void LineLayoutCache::Recount(LineLayout *ll) {
+	bytesUsed -= ll->bytesCounted;
+	ll->bytesCounted = ll->MemoryUsed();
+	bytesUsed += ll->bytesCounted;
+}
+
+void LineLayoutCache::Remove(LineLayout *ll) {
+	Unlink(ll);
+	const size_t index = IndexOfLine(ll->lineNumber);
+	if ((index < cache.size()) && (cache[index] == ll))
+		cache.erase(cache.begin() + index);
+	layouts--;
+	bytesUsed -= ll->bytesCounted;
+	delete ll;
+}
+
+// Delete a layout marked as discarded so it can be removed from the index.
+bool LineLayoutCache::DeleteIfDiscarded(LineLayout *ll) {
+	if (ll->inCache)
+		return false;
+	delete ll;
+	return true;
 }
 
-void LineLayoutCache::AllocateForLevel(int linesOnScreen, int linesInDoc) {
+// Discard layouts, starting with the least recently used, until within the limits.
+// The most recently used layout and the caret line's layout are kept.
+void LineLayoutCache::DiscardLeastRecent() {
 	PLATFORM_ASSERT(useCount == 0);
-	size_t lengthForLevel = 0;
-	if (level == llcCaret) {
-		lengthForLevel = 1;
-	} else if (level == llcPage) {
-		lengthForLevel = linesOnScreen + 1;
-	} else if (level == llcDocument) {
-		lengthForLevel = linesInDoc;
-	}
-	if (lengthForLevel > cache.size()) {
-		Deallocate();
-		Allocate(lengthForLevel);
-	} else {
-		if (lengthForLevel < cache.size()) {
-			for (size_t i = lengthForLevel; i < cache.size(); i++) {
-				delete cache[i];
-				cache[i] = 0;
-			}
+	bool discarded = false;
+	LineLayout *ll = leastRecent;
+	while (ll && (ll != mostRecent) &&
+		((layouts > layoutsAllowed) || (bytesBudget && (bytesUsed > bytesBudget)))) {
+		LineLayout *llMoreRecent = ll->moreRecent;
+		if (ll->lineNumber != lineCaret) {
+			// Marked as out of the cache and deleted as the index is compacted
+			Unlink(ll);
+			layouts--;
+			bytesUsed -= ll->bytesCounted;
+			ll->inCache = false;
+			discarded = true;
 		}
-		cache.resize(lengthForLevel);
+		ll = llMoreRecent;
 	}
-	PLATFORM_ASSERT(cache.size() == lengthForLevel);
+	if (discarded)
+		cache.erase(std::remove_if(cache.begin(), cache.end(), DeleteIfDiscarded), cache.end());
 }
 
 void LineLayoutCache::Deallocate() {
@@ -290,14 +475,17 @@ void LineLayoutCache::Deallocate() {
 	for (size_t i = 0; i < cache.size(); i++)
 		delete cache[i];
 	cache.clear();
+	mostRecent = 0;
+	leastRecent = 0;
+	layouts = 0;
+	bytesUsed = 0;
+	pool.Clear();
 }
 
 void LineLayoutCache::Invalidate(LineLayout::validLevel validity_) {
-	if (!cache.empty() && !allInvalidated) {
-		for (size_t i = 0; i < cache.size(); i++) {
-			if (cache[i]) {
-				cache[i]->Invalidate(validity_);
-			}
+	if (!allInvalidated) {
+		for (LineLayout *ll = mostRecent; ll; ll = ll->lessRecent) {
+			ll->Invalidate(validity_);
 		}
 		if (validity_ == LineLayout::llInvalid) {
 			allInvalidated = true;
@@ -305,6 +493,32 @@ void LineLayoutCache::Invalidate(LineLayout::validLevel validity_) {
 	}
 }
 
+void LineLayoutCache::InvalidateLines(int lineStart, int lineEnd, LineLayout::validLevel validity_) {
+	for (size_t index = IndexOfLine(lineStart); (index < cache.size()) && (cache[index]->lineNumber < lineEnd); index++) {
+		cache[index]->Invalidate(validity_);
+	}
+}
+
+// Move layouts with their lines so that lines after a change need not be measured again.
+void LineLayoutCache::LinesAddedOrRemoved(int lineOfPos, int linesAdded) {
+	PLATFORM_ASSERT(useCount == 0);
+	if (linesAdded < 0) {
+		const size_t first = IndexOfLine(lineOfPos);
+		const size_t last = IndexOfLine(lineOfPos - linesAdded);
+		for (size_t index = first; index < last; index++) {
+			LineLayout *ll = cache[index];
+			Unlink(ll);
+			layouts--;
+			bytesUsed -= ll->bytesCounted;
+			delete ll;
+		}
+		cache.erase(cache.begin() + first, cache.begin() + last);
+	}
+	for (size_t index = IndexOfLine(lineOfPos); index < cache.size(); index++) {
+		cache[index]->lineNumber += linesAdded;
+	}
+}
+
 void LineLayoutCache::SetLevel(int level_) {
 	allInvalidated = false;
 	if ((level_ != -1) && (level != level_)) {
@@ -313,44 +527,66 @@ void LineLayoutCache::SetLevel(int level_) {
 	}
 }
 
-LineLayout *LineLayoutCache::Retrieve(int lineNumber, int lineCaret, int maxChars, int styleClock_,
-                                      int linesOnScreen, int linesInDoc) {
-	AllocateForLevel(linesOnScreen, linesInDoc);
-	if (styleClock != styleClock_) {
-		Invalidate(LineLayout::llCheckTextAndStyle);
-		styleClock = styleClock_;
+// Memory allocated for the arrays of the layouts and for the index from lines to layouts.
+size_t LineLayoutCache::MemoryUsed() const {
+	return pool.MemoryAllocated() + cache.capacity() * sizeof(LineLayout *);
+}
+
+void LineLayoutCache::SetMemoryBudget(size_t bytesBudget_) {
+	bytesBudget = bytesBudget_;
+	if (useCount == 0) {
+		// Discarded layouts leave their blocks in the pool so, when it holds more than
+		// the budget, discard every layout to free the pool.
+		if (bytesBudget && (pool.MemoryAllocated() > bytesBudget))
+			Deallocate();
+		else
+			DiscardLeastRecent();
 	}
+}
+
+LineLayout *LineLayoutCache::Retrieve(int lineNumber, int lineCaret_, int maxChars, int linesOnScreen) {
 	allInvalidated = false;
-	int pos = -1;
-	LineLayout *ret = 0;
+	lineCaret = lineCaret_;
 	if (level == llcCaret) {
-		pos = 0;
+		layoutsAllowed = 1;
 	} else if (level == llcPage) {
-		if (lineNumber == lineCaret) {
-			pos = 0;
-		} else if (cache.size() > 1) {
-			pos = 1 + (lineNumber % (cache.size() - 1));
-		}
-	} else if (level == llcDocument) {
-		pos = lineNumber;
+		layoutsAllowed = linesOnScreen + 1;
+	} else {
+		layoutsAllowed = INT_MAX;
 	}
-	if (pos >= 0) {
+	LineLayout *ret = 0;
+	if (level != llcNone) {
 		PLATFORM_ASSERT(useCount == 0);
-		if (!cache.empty() && (pos < static_cast<int>(cache.size()))) {
-			if (cache[pos]) {
-				if ((cache[pos]->lineNumber != lineNumber) ||
-				        (cache[pos]->maxLineLength < maxChars)) {
-					delete cache[pos];
-					cache[pos] = 0;
-				}
-			}
-			if (!cache[pos]) {
-				cache[pos] = new LineLayout(maxChars);
+		const size_t index = IndexOfLine(lineNumber);
+		if ((index < cache.size()) && (cache[index]->lineNumber == lineNumber))
+			ret = cache[index];
+		if (ret && (ret->maxLineLength < maxChars)) {
+			Remove(ret);
+			ret = 0;
+		}
+		if (ret) {
+			Unlink(ret);
+			ret->ExpandPositions();
+		} else {
+			ret = new LineLayout(maxChars, &pool);
+			ret->lineNumber = lineNumber;
+			ret->inCache = true;
+			cache.insert(cache.begin() + index, ret);
+			layouts++;
+		}
+		Link(ret);
+		useCount++;
+		// Recently used layouts, like those of the lines on screen, keep full positions as they
+		// are often used again. A layout leaving that set is compacted if the cache keeps it.
+		const int layoutsHot = linesOnScreen + 1;
+		if (layoutsAllowed > layoutsHot) {
+			LineLayout *llCold = ret;
+			for (int i = 0; (i < layoutsHot) && llCold; i++)
+				llCold = llCold->lessRecent;
+			if (llCold && llCold->positions) {
+				llCold->CompactPositions();
+				Recount(llCold);
 			}
-			cache[pos]->lineNumber = lineNumber;
-			cache[pos]->inCache = true;
-			ret = cache[pos];
-			useCount++;
 		}
 	}
 
@@ -369,6 +605,10 @@ void LineLayoutCache::Dispose(LineLayout *ll) {
 			delete ll;
 		} else {
 			useCount--;
+			// Layout may have grown while in use
+			Recount(ll);
+			if (useCount == 0)
+				DiscardLeastRecent();
 		}
 	}
 }
@@ -646,9 +886,28 @@ void PositionCache::SetSize(size_t size_) {
 	pces.resize(size_);
 }
 
+static bool AllGraphicASCII(const char *s, unsigned int len) {
+	for (unsigned int i = 0; i < len; i++) {
+		const unsigned char ch = static_cast<unsigned char>(s[i]);
+		if ((ch < ' ') || (ch > '~'))
+			return false;
+	}
+	return true;
+}
+
 void PositionCache::MeasureWidths(Surface *surface, const ViewStyle &vstyle, unsigned int styleNumber,
 	const char *s, unsigned int len, XYPOSITION *positions, Document *pdoc) {
 
+	const XYPOSITION monospaceASCIIWidth = vstyle.styles[styleNumber].monospaceASCIIWidth;
+	if ((monospaceASCIIWidth > 0) && AllGraphicASCII(s, len)) {
+		// Graphic ASCII characters can not combine so their positions follow from the font's
+		// width without asking the platform. Other characters may be wider or combine.
+		for (unsigned int i = 0; i < len; i++) {
+			positions[i] = monospaceASCIIWidth * (i + 1);
+		}
+		return;
+	}
+
 	allClear = false;
 	size_t probe = pces.size();	// Out of bounds
 	if ((!pces.empty()) && (len < 30)) {
@@ -16,6 +16,31 @@ static inline bool IsEOLChar(char ch) {
 	return (ch == '\r') || (ch == '\n');
 }
 
+/**
+ * Allocates the arrays of cached line layouts from larger slabs so that short lines do not each
+ * need several heap allocations. Blocks are rounded up to a multiple of granularity bytes and
+ * freed blocks are reused for other blocks of the same rounded size.
+ * Larger blocks are allocated individually.
+ */
+class LayoutPool {
+	enum { granularity = 32, sizeClasses = 32, slabSize = 0x10000 };
+	std::vector<char *> slabs;
+	size_t slabUsed;
+	char *freeBlocks[sizeClasses];
+	size_t bytesAllocated;
+	// Private so LayoutPool objects can not be copied
+	LayoutPool(const LayoutPool &);
+	LayoutPool &operator=(const LayoutPool &);
+public:
+	LayoutPool();
+	~LayoutPool();
+	static size_t BlockSize(size_t bytes);
+	char *Allocate(size_t bytes);
+	void Free(char *block, size_t bytes);
+	void Clear();
+	size_t MemoryAllocated() const { return bytesAllocated; }
+};
+
 /**
  */
 class LineLayout {
@@ -26,6 +51,16 @@ private:
 	/// Drawing is only performed for @a maxLineLength characters on each line.
 	int lineNumber;
 	bool inCache;
+	// Neighbours in the cache's list of layouts ordered by use
+	LineLayout *moreRecent;
+	LineLayout *lessRecent;
+	size_t bytesCounted;
+	LayoutPool *pool;
+	unsigned short *positionsCompact;
+	char *AllocateBlock(size_t bytes);
+	void FreeBlock(char *block, size_t bytes);
+	void CompactPositions();
+	void ExpandPositions();
 public:
 	enum { wrapWidthInfinite = 0x7ffffff };
 	int maxLineLength;
@@ -49,19 +84,20 @@ public:
 	int lines;
 	XYPOSITION wrapIndent; // In pixels
 
-	explicit LineLayout(int maxLineLength_);
+	explicit LineLayout(int maxLineLength_, LayoutPool *pool_=0);
 	virtual ~LineLayout();
 	void Resize(int maxLineLength_);
 	void Free();
+	size_t MemoryUsed() const;
 	void Invalidate(validLevel validity_);
 	int LineStart(int line) const;
 	int LineLastVisible(int line) const;
 	Range SubLineRange(int line) const;
 	bool InLine(int offset, int line) const;
 	void SetLineStart(int line, int start);
-	void SetBracesHighlight(Range rangeLine, const Position braces[],
+	void SetBracesHighlight(Range rangeLine, const Sci::Position braces[],
 		char bracesMatchStyle, int xHighlight, bool ignoreStyle);
-	void RestoreBracesHighlight(Range rangeLine, const Position braces[], bool ignoreStyle);
+	void RestoreBracesHighlight(Range rangeLine, const Sci::Position braces[], bool ignoreStyle);
 	int FindBefore(XYPOSITION x, int lower, int upper) const;
 	int FindPositionFromX(XYPOSITION x, Range range, bool charPosition) const;
 	Point PointFromPosition(int posInLine, int lineHeight) const;
@@ -69,15 +105,33 @@ public:
 };
 
 /**
+ * Keeps the layouts of recently used lines so they do not have to be measured again.
+ * Layouts are indexed by line and move with their lines when other lines are inserted or removed.
+ * When there are more layouts than the level allows or they use more memory than the budget,
+ * the least recently used layouts are discarded.
  */
 class LineLayoutCache {
 	int level;
-	std::vector<LineLayout *>cache;
+	// Cached layouts ordered by line number so memory grows with the layouts kept,
+	// not with the length of the document
+	std::vector<LineLayout *> cache;
+	LayoutPool pool;
+	LineLayout *mostRecent;
+	LineLayout *leastRecent;
+	int layouts;
+	int layoutsAllowed;
+	size_t bytesUsed;
+	size_t bytesBudget;
+	int lineCaret;
 	bool allInvalidated;
-	int styleClock;
 	int useCount;
-	void Allocate(size_t length_);
-	void AllocateForLevel(int linesOnScreen, int linesInDoc);
+	size_t IndexOfLine(int lineNumber) const;
+	void Link(LineLayout *ll);
+	void Unlink(LineLayout *ll);
+	void Remove(LineLayout *ll);
+	static bool DeleteIfDiscarded(LineLayout *ll);
+	void Recount(LineLayout *ll);
+	void DiscardLeastRecent();
 public:
 	LineLayoutCache();
 	virtual ~LineLayoutCache();
@@ -89,10 +143,14 @@ public:
 		llcDocument=SC_CACHE_DOCUMENT
 	};
 	void Invalidate(LineLayout::validLevel validity_);
+	void InvalidateLines(int lineStart, int lineEnd, LineLayout::validLevel validity_);
+	void LinesAddedOrRemoved(int lineOfPos, int linesAdded);
 	void SetLevel(int level_);
 	int GetLevel() const { return level; }
-	LineLayout *Retrieve(int lineNumber, int lineCaret, int maxChars, int styleClock_,
-		int linesOnScreen, int linesInDoc);
+	void SetMemoryBudget(size_t bytesBudget_);
+	size_t GetMemoryBudget() const { return bytesBudget; }
+	size_t MemoryUsed() const;
+	LineLayout *Retrieve(int lineNumber, int lineCaret_, int maxChars, int linesOnScreen);
 	void Dispose(LineLayout *ll);
 };
 
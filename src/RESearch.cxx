@@ -41,7 +41,7 @@
  *
  *  RESearch::Execute:      execute the NFA to match a pattern.
  *
- *          int RESearch::Execute(characterIndexer &ci, int lp, int endp)
+ *          int RESearch::Execute(characterIndexer &ci, Sci::Position lp, Sci::Position endp)
  *
  *  re_fail:                failure routine for RESearch::Execute. (no longer used)
  *
@@ -259,6 +259,7 @@ RESearch::RESearch(CharClassify *charClassTable) {
 	std::fill(bittab, bittab + BITBLK, 0);
 	std::fill(tagstk, tagstk + MAXTAG, 0);
 	std::fill(nfa, nfa + MAXNFA, 0);
+	lenNFA = 0;
 	Clear();
 }
 
@@ -277,9 +278,9 @@ void RESearch::Clear() {
 void RESearch::GrabMatches(CharacterIndexer &ci) {
 	for (unsigned int i = 0; i < MAXTAG; i++) {
 		if ((bopat[i] != NOTFOUND) && (eopat[i] != NOTFOUND)) {
-			unsigned int len = eopat[i] - bopat[i];
+			const Sci::Position len = eopat[i] - bopat[i];
 			pat[i].resize(len);
-			for (unsigned int j = 0; j < len; j++)
+			for (Sci::Position j = 0; j < len; j++)
 				pat[i][j] = ci.CharAt(bopat[i] + j);
 		}
 	}
@@ -730,10 +731,26 @@ const char *RESearch::Compile(const char *pattern, int length, bool caseSensitiv
 	if (tagi > 0)
 		return badpat((posix ? "Unmatched (" : "Unmatched \\("));
 	*mp = END;
+	lenNFA = static_cast<int>(mp - nfa) + 1;
 	sta = OKP;
 	return 0;
 }
 
+/*
+ * RESearch::Automaton, RESearch::SetAutomaton:
+ *   save the automaton from a successful Compile and restore it later
+ *   so the same pattern can be executed again without compiling it.
+ */
+std::string RESearch::Automaton() const {
+	return std::string(nfa, lenNFA);
+}
+
+void RESearch::SetAutomaton(const std::string &automaton) {
+	std::copy(automaton.begin(), automaton.end(), nfa);
+	lenNFA = static_cast<int>(automaton.length());
+	sta = OKP;
+}
+
 /*
  * RESearch::Execute:
  *   execute nfa to find a match.
@@ -755,9 +772,9 @@ const char *RESearch::Compile(const char *pattern, int length, bool caseSensitiv
  *  respectively.
  *
  */
-int RESearch::Execute(CharacterIndexer &ci, int lp, int endp) {
+int RESearch::Execute(CharacterIndexer &ci, Sci::Position lp, Sci::Position endp) {
 	unsigned char c;
-	int ep = NOTFOUND;
+	Sci::Position ep = NOTFOUND;
 	char *ap = nfa;
 
 	bol = lp;
@@ -844,13 +861,13 @@ extern void re_fail(char *,char);
 #define CHRSKIP 3	/* [CLO] CHR chr END      */
 #define CCLSKIP 34	/* [CLO] CCL 32 bytes END */
 
-int RESearch::PMatch(CharacterIndexer &ci, int lp, int endp, char *ap) {
+Sci::Position RESearch::PMatch(CharacterIndexer &ci, Sci::Position lp, Sci::Position endp, char *ap) {
 	int op, c, n;
-	int e;		/* extra pointer for CLO  */
-	int bp;		/* beginning of subpat... */
-	int ep;		/* ending of subpat...    */
-	int are;	/* to save the line ptr.  */
-	int llp;	/* lazy lp for LCLO       */
+	Sci::Position e;		/* extra pointer for CLO  */
+	Sci::Position bp;		/* beginning of subpat... */
+	Sci::Position ep;		/* ending of subpat...    */
+	Sci::Position are;	/* to save the line ptr.  */
+	Sci::Position llp;	/* lazy lp for LCLO       */
 
 	while ((op = *ap++) != END)
 		switch (op) {
@@ -940,7 +957,7 @@ int RESearch::PMatch(CharacterIndexer &ci, int lp, int endp, char *ap) {
 			llp = lp;
 			e = NOTFOUND;
 			while (llp >= are) {
-				int q;
+				Sci::Position q;
 				if ((q = PMatch(ci, llp, endp, ap)) != NOTFOUND) {
 					e = q;
 					lp = llp;
@@ -23,7 +23,7 @@ namespace Scintilla {
 
 class CharacterIndexer {
 public:
-	virtual char CharAt(int index)=0;
+	virtual char CharAt(Sci::Position index)=0;
 	virtual ~CharacterIndexer() {
 	}
 };
@@ -36,14 +36,16 @@ public:
 	void Clear();
 	void GrabMatches(CharacterIndexer &ci);
 	const char *Compile(const char *pattern, int length, bool caseSensitive, bool posix);
-	int Execute(CharacterIndexer &ci, int lp, int endp);
+	int Execute(CharacterIndexer &ci, Sci::Position lp, Sci::Position endp);
+	std::string Automaton() const;
+	void SetAutomaton(const std::string &automaton);
 
 	enum { MAXTAG=10 };
 	enum { MAXNFA=4096 };
 	enum { NOTFOUND=-1 };
 
-	int bopat[MAXTAG];
-	int eopat[MAXTAG];
+	Sci::Position bopat[MAXTAG];
+	Sci::Position eopat[MAXTAG];
 	std::string pat[MAXTAG];
 
 private:
@@ -51,11 +53,12 @@ private:
 	void ChSetWithCase(unsigned char c, bool caseSensitive);
 	int GetBackslashExpression(const char *pattern, int &incr);
 
-	int PMatch(CharacterIndexer &ci, int lp, int endp, char *ap);
+	Sci::Position PMatch(CharacterIndexer &ci, Sci::Position lp, Sci::Position endp, char *ap);
 
-	int bol;
+	Sci::Position bol;
 	int tagstk[MAXTAG];  /* subpat tag stack */
 	char nfa[MAXNFA];    /* automaton */
+	int lenNFA;          /* length of automaton including final END */
 	int sta;
 	unsigned char bittab[BITBLK]; /* bit table for CCL pre-set bits */
 	int failure;
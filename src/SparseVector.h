@@ -17,7 +17,7 @@ namespace Scintilla {
 template <typename T>
 class SparseVector {
 private:
-	Partitioning *starts;
+	Partitioning<int> *starts;
 	SplitVector<T> *values;
 	// Private so SparseVector objects can not be copied
 	SparseVector(const SparseVector &);
@@ -54,7 +54,7 @@ private:
 	}
 public:
 	SparseVector() {
-		starts = new Partitioning(8);
+		starts = new Partitioning<int>(8);
 		values = new SplitVector<T>();
 		values->InsertValue(0, 2, T());
 	}
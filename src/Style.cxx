@@ -72,6 +72,7 @@ void FontMeasurements::Clear() {
 	descent = 1;
 	aveCharWidth = 1;
 	spaceWidth = 1;
+	monospaceASCIIWidth = 0;
 	sizeZoomed = 2;
 }
 
@@ -48,6 +48,7 @@ struct FontMeasurements {
 	unsigned int descent;
 	XYPOSITION aveCharWidth;
 	XYPOSITION spaceWidth;
+	XYPOSITION monospaceASCIIWidth;	// Width of every graphic ASCII character or 0 when they differ
 	int sizeZoomed;
 	FontMeasurements();
 	void Clear();
@@ -6,8 +6,15 @@
 // The License.txt file describes the conditions under which this software may be distributed.
 
 #include <stdlib.h>
+#include <wchar.h>
 
 #include <stdexcept>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define UNICONVERSION_SSE2
+#endif
 
 #include "UniConversion.h"
 
@@ -15,6 +22,150 @@
 using namespace Scintilla;
 #endif
 
+namespace {
+
+#ifdef UNICONVERSION_SSE2
+
+#if defined(__GNUC__)
+inline int FirstBit(int mask) {
+	return __builtin_ctz(mask);
+}
+inline int LastBit(int mask) {
+	return 31 - __builtin_clz(mask);
+}
+inline int BitCount(int mask) {
+	return __builtin_popcount(mask);
+}
+#else
+inline int FirstBit(int mask) {
+	int bit = 0;
+	while (!(mask & (1 << bit)))
+		bit++;
+	return bit;
+}
+inline int LastBit(int mask) {
+	int bit = 31;
+	while (!(mask & (1 << bit)))
+		bit--;
+	return bit;
+}
+inline int BitCount(int mask) {
+	int count = 0;
+	for (; mask; mask &= mask - 1)
+		count++;
+	return count;
+}
+#endif
+
+const int chunkSize = 16;
+const int chunkAll = 0xFFFF;
+
+inline __m128i LoadChunk(const unsigned char *us) {
+	return _mm_loadu_si128(reinterpret_cast<const __m128i *>(us));
+}
+
+inline __m128i Bytes(unsigned char ch) {
+	return _mm_set1_epi8(static_cast<char>(ch));
+}
+
+// Each byte is set when the byte of chunk is ch.
+inline __m128i EqualTo(__m128i chunk, unsigned char ch) {
+	return _mm_cmpeq_epi8(chunk, Bytes(ch));
+}
+
+// Each byte is set when the byte of chunk has all the bits of bits set.
+inline __m128i HasBits(__m128i chunk, unsigned char bits) {
+	return _mm_cmpeq_epi8(_mm_and_si128(chunk, Bytes(bits)), Bytes(bits));
+}
+
+// Each byte is set when the byte of chunk is at least ch as unsigned.
+inline __m128i AtLeast(__m128i chunk, unsigned char ch) {
+	return _mm_cmpeq_epi8(_mm_max_epu8(chunk, Bytes(ch)), chunk);
+}
+
+// Examine 16 bytes starting on a character boundary and return the length of the complete
+// characters at their start in which each lead byte is followed by the number of trail bytes
+// it calls for, setting masks of their lead bytes and of their 4 byte lead bytes.
+// When validate is true, also stop before sequences that UTF8Classify may find invalid.
+// Return 0 when the first character has to be examined by itself.
+int ChunkCharacters(__m128i chunk, bool validate, int &leads, int &leads4) {
+	const int nonAscii = _mm_movemask_epi8(chunk);
+	if (!nonAscii) {
+		leads = chunkAll;
+		leads4 = 0;
+		return chunkSize;
+	}
+	const __m128i lead2 = HasBits(chunk, 0xC0);
+	const __m128i lead3 = HasBits(chunk, 0xE0);
+	const __m128i lead4 = HasBits(chunk, 0xF0);
+	const __m128i trail = _mm_andnot_si128(lead2, _mm_cmplt_epi8(chunk, _mm_setzero_si128()));
+	const __m128i expected = _mm_or_si128(_mm_slli_si128(lead2, 1),
+		_mm_or_si128(_mm_slli_si128(lead3, 2), _mm_slli_si128(lead4, 3)));
+	const int trails = _mm_movemask_epi8(trail);
+	const int mask4 = _mm_movemask_epi8(lead4);
+	// A character at the end may continue past the chunk so is left for the next chunk
+	const int overflow = (_mm_movemask_epi8(lead2) & 0x8000) |
+		(_mm_movemask_epi8(lead3) & 0xC000) | (mask4 & 0xE000);
+	int length = overflow ? FirstBit(overflow) : chunkSize;
+	const int misplaced = _mm_movemask_epi8(_mm_xor_si128(expected, trail));
+	if (misplaced) {
+		// Stop at an unexpected trail byte or at the lead byte missing a trail byte
+		const int first = FirstBit(misplaced);
+		const int leadsBefore = ~trails & ((1 << first) - 1);
+		const int lengthGood = (trails & (1 << first)) ? first : (leadsBefore ? LastBit(leadsBefore) : 0);
+		length = std::min(length, lengthGood);
+	}
+	if (validate && length) {
+		const __m128i next = _mm_srli_si128(chunk, 1);
+		const __m128i afterNext = _mm_srli_si128(chunk, 2);
+		// C0 and C1 are overlong and F5 .. FF are beyond Unicode
+		__m128i suspect = _mm_or_si128(EqualTo(_mm_and_si128(chunk, Bytes(0xFE)), 0xC0),
+			AtLeast(chunk, 0xF5));
+		// Overlong after E0 and F0, surrogates after ED, and beyond 10FFFF after F4
+		suspect = _mm_or_si128(suspect, _mm_andnot_si128(AtLeast(next, 0xA0), EqualTo(chunk, 0xE0)));
+		suspect = _mm_or_si128(suspect, _mm_and_si128(AtLeast(next, 0xA0), EqualTo(chunk, 0xED)));
+		suspect = _mm_or_si128(suspect, _mm_andnot_si128(AtLeast(next, 0x90), EqualTo(chunk, 0xF0)));
+		suspect = _mm_or_si128(suspect, _mm_and_si128(AtLeast(next, 0x90), EqualTo(chunk, 0xF4)));
+		// Possible non-characters U+FDD0 .. U+FDEF, U+FFFE, U+FFFF, and *FFFE, *FFFF
+		suspect = _mm_or_si128(suspect, _mm_and_si128(EqualTo(chunk, 0xEF),
+			_mm_or_si128(EqualTo(next, 0xB7), EqualTo(next, 0xBF))));
+		suspect = _mm_or_si128(suspect, _mm_and_si128(lead4,
+			_mm_and_si128(HasBits(next, 0x0F), EqualTo(afterNext, 0xBF))));
+		const int suspects = _mm_movemask_epi8(suspect) & ((1 << length) - 1);
+		if (suspects) {
+			length = FirstBit(suspects);
+		}
+	}
+	const int inside = (1 << length) - 1;
+	leads = ~trails & inside;
+	leads4 = mask4 & inside;
+	return length;
+}
+
+// Zero extend 16 bytes into 16 bit code units.
+inline void StoreWidened16(__m128i chunk, void *units) {
+	__m128i *out = static_cast<__m128i *>(units);
+	const __m128i zero = _mm_setzero_si128();
+	_mm_storeu_si128(out, _mm_unpacklo_epi8(chunk, zero));
+	_mm_storeu_si128(out + 1, _mm_unpackhi_epi8(chunk, zero));
+}
+
+// Zero extend 16 bytes into 32 bit code units.
+inline void StoreWidened32(__m128i chunk, void *units) {
+	__m128i *out = static_cast<__m128i *>(units);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i low = _mm_unpacklo_epi8(chunk, zero);
+	const __m128i high = _mm_unpackhi_epi8(chunk, zero);
+	_mm_storeu_si128(out, _mm_unpacklo_epi16(low, zero));
+	_mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+	_mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+	_mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+}
+
+#endif
+
+}
+
 #ifdef SCI_NAMESPACE
 namespace Scintilla {
 #endif
@@ -80,10 +231,24 @@ unsigned int UTF8CharLength(unsigned char ch) {
 	}
 }
 
+// Long runs of text are handled 16 bytes at a time when SSE2 is available.
 size_t UTF16Length(const char *s, size_t len) {
 	size_t ulen = 0;
 	size_t charLen;
 	for (size_t i = 0; i<len;) {
+#ifdef UNICONVERSION_SSE2
+		if (i + chunkSize <= len) {
+			int leads = 0;
+			int leads4 = 0;
+			const int lengthChunk = ChunkCharacters(
+				LoadChunk(reinterpret_cast<const unsigned char *>(s + i)), false, leads, leads4);
+			if (lengthChunk) {
+				ulen += BitCount(leads) + BitCount(leads4);
+				i += lengthChunk;
+				continue;
+			}
+		}
+#endif
 		unsigned char ch = static_cast<unsigned char>(s[i]);
 		if (ch < 0x80) {
 			charLen = 1;
@@ -106,6 +271,22 @@ size_t UTF16FromUTF8(const char *s, size_t len, wchar_t *tbuf, size_t tlen) {
 	const unsigned char *us = reinterpret_cast<const unsigned char *>(s);
 	size_t i = 0;
 	while ((i<len) && (ui<tlen)) {
+#ifdef UNICONVERSION_SSE2
+		if ((us[i] < 0x80) && (i + chunkSize <= len) && (ui + chunkSize <= tlen)) {
+			// Widen the whole chunk then keep as much as is ASCII
+			const __m128i chunk = LoadChunk(us + i);
+#if WCHAR_MAX <= 0xFFFF
+			StoreWidened16(chunk, tbuf + ui);
+#else
+			StoreWidened32(chunk, tbuf + ui);
+#endif
+			const int nonAscii = _mm_movemask_epi8(chunk);
+			const int lengthAscii = nonAscii ? FirstBit(nonAscii) : chunkSize;
+			i += lengthAscii;
+			ui += lengthAscii;
+			continue;
+		}
+#endif
 		unsigned char ch = us[i++];
 		if (ch < 0x80) {
 			tbuf[ui] = ch;
@@ -142,6 +323,17 @@ unsigned int UTF32FromUTF8(const char *s, unsigned int len, unsigned int *tbuf,
 	const unsigned char *us = reinterpret_cast<const unsigned char *>(s);
 	unsigned int i=0;
 	while ((i<len) && (ui<tlen)) {
+#ifdef UNICONVERSION_SSE2
+		if ((us[i] < 0x80) && (i + chunkSize <= len) && (ui + chunkSize <= tlen)) {
+			const __m128i chunk = LoadChunk(us + i);
+			StoreWidened32(chunk, tbuf + ui);
+			const int nonAscii = _mm_movemask_epi8(chunk);
+			const int lengthAscii = nonAscii ? FirstBit(nonAscii) : chunkSize;
+			i += lengthAscii;
+			ui += lengthAscii;
+			continue;
+		}
+#endif
 		unsigned char ch = us[i++];
 		unsigned int value = 0;
 		if (ch < 0x80) {
@@ -299,6 +491,45 @@ int UTF8Classify(const unsigned char *us, int len) {
 	}
 }
 
+size_t UTF8CountCharacters(const char *s, size_t lenCount, size_t lenAvailable, size_t &characters, size_t &utf16Length) {
+	const unsigned char *us = reinterpret_cast<const unsigned char *>(s);
+	size_t i = 0;
+	while (i < lenCount) {
+#ifdef UNICONVERSION_SSE2
+		if (i + chunkSize <= lenCount) {
+			int leads = 0;
+			int leads4 = 0;
+			const int lengthChunk = ChunkCharacters(LoadChunk(us + i), true, leads, leads4);
+			if (lengthChunk) {
+				const int charactersChunk = BitCount(leads);
+				characters += charactersChunk;
+				utf16Length += charactersChunk + BitCount(leads4);
+				i += lengthChunk;
+				continue;
+			}
+		}
+#endif
+		characters++;
+		utf16Length++;
+		if (UTF8IsAscii(us[i])) {
+			i++;
+		} else {
+			const int lenChar = static_cast<int>(std::min<size_t>(lenAvailable - i, UTF8MaxBytes));
+			const int utf8Status = UTF8Classify(us + i, lenChar);
+			if (utf8Status & UTF8MaskInvalid) {
+				// Each byte of an invalid sequence is treated as a character
+				i++;
+			} else {
+				const int widthChar = utf8Status & UTF8MaskWidth;
+				if (widthChar == UTF8MaxBytes)
+					utf16Length++;
+				i += widthChar;
+			}
+		}
+	}
+	return i;
+}
+
 int UTF8DrawBytes(const unsigned char *us, int len) {
 	int utf8StatusNext = UTF8Classify(us, len);
 	return (utf8StatusNext & UTF8MaskInvalid) ? 1 : (utf8StatusNext & UTF8MaskWidth);
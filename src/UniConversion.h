@@ -42,6 +42,11 @@ int UTF8Classify(const unsigned char *us, int len);
 // instead of setting the invalid flag
 int UTF8DrawBytes(const unsigned char *us, int len);
 
+// Count the characters that start before lenCount in the way Document::NextPosition moves, with
+// each byte of an invalid sequence being a character, and the UTF-16 code units they need.
+// Up to lenAvailable bytes are read. Returns the position after the last character counted.
+size_t UTF8CountCharacters(const char *s, size_t lenCount, size_t lenAvailable, size_t &characters, size_t &utf16Length);
+
 // Line separator is U+2028 \xe2\x80\xa8
 // Paragraph separator is U+2029 \xe2\x80\xa9
 const int UTF8SeparatorLength = 3;
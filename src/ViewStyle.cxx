@@ -7,6 +7,7 @@
 
 #include <string.h>
 #include <assert.h>
+#include <math.h>
 
 #include <stdexcept>
 #include <vector>
@@ -85,6 +86,25 @@ void FontRealised::Realise(Surface &surface, int zoomLevel, int technology, cons
 	descent = static_cast<unsigned int>(surface.Descent(font));
 	aveCharWidth = surface.AverageCharWidth(font);
 	spaceWidth = surface.WidthChar(font, ' ');
+
+	// Fonts with the same width for each character are common for source code.
+	// AverageCharWidth is not exact on all platforms and fonts may kern or have
+	// a few wider characters so only trust a measurement of every graphic ASCII character.
+	monospaceASCIIWidth = 0;
+	const int lenProbe = 0x7F - ' ';
+	char probe[lenProbe];
+	for (int i = 0; i < lenProbe; i++)
+		probe[i] = static_cast<char>(' ' + i);
+	// Extra position as some platforms write an extra element.
+	XYPOSITION positions[lenProbe + 1];
+	surface.MeasureWidths(font, probe, lenProbe, positions);
+	const XYPOSITION widthProbe = positions[lenProbe - 1] / lenProbe;
+	bool monospaced = widthProbe > 0;
+	for (int j = 0; j < lenProbe && monospaced; j++) {
+		monospaced = fabs(positions[j] - widthProbe * (j + 1)) < 0.01;
+	}
+	if (monospaced)
+		monospaceASCIIWidth = widthProbe;
 }
 
 ViewStyle::ViewStyle() {
@@ -38,6 +38,7 @@ msgs = {
 "WM_NCLBUTTONUP":162,
 "WM_NCMOUSEMOVE":160,
 "WM_NCPAINT":133,
+"WM_NOTIFY":78,
 "WM_PAINT":15,
 "WM_PARENTNOTIFY":528,
 "WM_SETCURSOR":32,
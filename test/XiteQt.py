@@ -39,8 +39,14 @@ class XiteWin():
 			int(self.face.features["GetDirectPointer"]["Value"]), 0,0))
 
 		self.ed = ScintillaCallable.ScintillaCallable(self.face, scifn, sciptr)
+		# (position, length, status) of each SCN_SEARCHPROGRESS notification
+		self.searchProgress = []
+		self.form.edit.searchProgress.connect(self.OnSearchProgress)
 		self.form.show()
 
+	def OnSearchProgress(self, position, length, status):
+		self.searchProgress.append((position, length, status))
+
 	def DoStuff(self):
 		print(self.test)
 		self.CmdTest()
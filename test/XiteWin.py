@@ -85,6 +85,32 @@ class OPENFILENAME(ctypes.Structure):
 		self.lpstrTitle = title
 		self.Flags = OFN_HIDEREADONLY
 
+class SCNotification(ctypes.Structure):
+	_fields_ = (("hwndFrom", HWND),
+		("idFrom", WPARAM),
+		("code", c_uint),
+		("position", ctypes.c_ssize_t),
+		("ch", c_int),
+		("modifiers", c_int),
+		("modificationType", c_int),
+		("text", c_char_p),
+		("length", ctypes.c_ssize_t),
+		("linesAdded", ctypes.c_ssize_t),
+		("message", c_int),
+		("wParam", WPARAM),
+		("lParam", LPARAM),
+		("line", ctypes.c_ssize_t),
+		("foldLevelNow", c_int),
+		("foldLevelPrev", c_int),
+		("margin", c_int),
+		("listType", c_int),
+		("x", c_int),
+		("y", c_int),
+		("token", c_int),
+		("annotationLinesAdded", ctypes.c_ssize_t),
+		("updated", c_int),
+		("listCompletionMethod", c_int))
+
 trace = False
 #~ trace = True
 
@@ -149,6 +175,8 @@ class XiteWin():
 		self.test = test
 
 		self.appName = "xite"
+		# (position, length, status) of each SCN_SEARCHPROGRESS notification
+		self.searchProgress = []
 
 		self.cmds = {}
 		self.windowName = "XiteWindow"
@@ -225,6 +253,9 @@ class XiteWin():
 			if cmdCode in self.cmds:
 				self.Command(self.cmds[cmdCode])
 			return 0
+		elif ms == "WM_NOTIFY":
+			self.OnNotify(l)
+			return 0
 		elif ms == "WM_ACTIVATE":
 			if w != WA_INACTIVE:
 				self.FocusOnEditor()
@@ -233,6 +264,11 @@ class XiteWin():
 			return user32.DefWindowProcW(h, m, w, l)
 		return 0
 
+	def OnNotify(self, l):
+		scn = ctypes.cast(l, ctypes.POINTER(SCNotification)).contents
+		if scn.code == int(self.face.features["SearchProgress"]["Value"], 0):
+			self.searchProgress.append((scn.position, scn.length, scn.updated))
+
 	def Command(self, name):
 		name = name.replace(" ", "")
 		method = "Cmd" + name
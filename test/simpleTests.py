@@ -577,6 +577,109 @@ class TestSimple(unittest.TestCase):
 		self.assertEquals(self.ed.TargetStart, 4)
 		self.assertEquals(self.ed.TargetEnd, 5)
 
+	def testReplaceAllInTarget(self):
+		self.ed.SetContents(b"a.b.c.d")
+		self.ed.TargetStart = 1
+		self.ed.TargetEnd = 6
+		self.assertEquals(self.ed.ReplaceAllInTarget(b".", b"::"), 3)
+		self.assertEquals(self.ed.Contents(), b"a::b::c::d")
+		self.assertEquals(self.ed.TargetStart, 1)
+		self.assertEquals(self.ed.TargetEnd, 9)
+		# One undo for all the replacements
+		self.ed.Undo()
+		self.assertEquals(self.ed.Contents(), b"a.b.c.d")
+		self.ed.SearchFlags = self.ed.SCFIND_REGEXP
+		self.ed.TargetWholeDocument()
+		self.assertEquals(self.ed.ReplaceAllInTarget(b"\\([a-z]\\)", b"<\\1>"), 4)
+		self.assertEquals(self.ed.Contents(), b"<a>.<b>.<c>.<d>")
+		self.assertEquals(self.ed.ReplaceAllInTarget(b"z", b"y"), 0)
+		self.assertEquals(self.ed.Contents(), b"<a>.<b>.<c>.<d>")
+		# Nothing is replaced in a read-only document
+		self.ed.ReadOnly = 1
+		self.ed.TargetWholeDocument()
+		self.assertEquals(self.ed.ReplaceAllInTarget(b"<", b"[["), 0)
+		self.assertEquals(self.ed.Contents(), b"<a>.<b>.<c>.<d>")
+		self.assertEquals(self.ed.TargetEnd, 15)
+		self.ed.ReadOnly = 0
+
+	def testFindAllInTarget(self):
+		self.ed.SetContents(b"a.b.c.d")
+		self.ed.TargetStart = 1
+		self.ed.TargetEnd = 6
+		self.ed.SearchFlags = 0
+		self.assertEquals(self.ed.FindAllInTarget(0, b"."), 3)
+		self.assertEquals(self.ed.GetFoundStart(0), 1)
+		self.assertEquals(self.ed.GetFoundEnd(0), 2)
+		self.assertEquals(self.ed.GetFoundStart(2), 5)
+		self.assertEquals(self.ed.GetFoundStart(3), -1)
+		# The target is not changed
+		self.assertEquals(self.ed.TargetStart, 1)
+		self.assertEquals(self.ed.TargetEnd, 6)
+		self.ed.TargetWholeDocument()
+		self.ed.SearchFlags = self.ed.SCFIND_REGEXP
+		self.ed.IndicatorCurrent = 3
+		self.assertEquals(self.ed.FindAllInTarget(1, b"[bc]"), 2)
+		self.assertEquals(self.ed.IndicatorValueAt(3, 1), 0)
+		self.assertEquals(self.ed.IndicatorValueAt(3, 2), 1)
+		self.assertEquals(self.ed.IndicatorValueAt(3, 3), 0)
+		self.assertEquals(self.ed.IndicatorValueAt(3, 4), 1)
+		self.assertEquals(self.ed.IndicatorEnd(3, 4), 5)
+		self.assertEquals(self.ed.FindAllInTarget(0, b"z"), 0)
+		self.assertEquals(self.ed.GetFoundStart(0), -1)
+		self.ed.IndicatorClearRange(0, self.ed.Length)
+
+	def testStartSearchInTarget(self):
+		self.ed.SetContents(b"a.b.c.d")
+		self.ed.TargetWholeDocument()
+		self.ed.SearchFlags = 0
+		self.ed.StartSearchInTarget(0, b"")
+		self.assertEquals(self.ed.SearchStatus, self.ed.SC_SEARCHSTATUS_NONE)
+		self.ed.StartSearchInTarget(0, b".")
+		if self.ed.SearchStatus == self.ed.SC_SEARCHSTATUS_RUNNING:
+			self.ed.CancelSearch()
+			self.assertEquals(self.ed.SearchStatus, self.ed.SC_SEARCHSTATUS_CANCELLED)
+		else:
+			# Without idle processing the search completes immediately
+			self.assertEquals(self.ed.SearchStatus, self.ed.SC_SEARCHSTATUS_FINISHED)
+			self.assertEquals(self.ed.FoundCount, 3)
+		self.ed.StartSearchInTarget(0, b".")
+		if self.ed.SearchStatus == self.ed.SC_SEARCHSTATUS_RUNNING:
+			# Modifying the text cancels the search
+			self.ed.InsertText(0, b"x")
+			self.assertEquals(self.ed.SearchStatus, self.ed.SC_SEARCHSTATUS_CANCELLED)
+		self.ed.TargetWholeDocument()
+		self.assertEquals(self.ed.FindAllInTarget(0, b"."), 3)
+		self.assertEquals(self.ed.FoundCount, 3)
+
+	def testStartSearchInTargetSlices(self):
+		# Lines longer than a slice are divided so the search proceeds over several idle steps
+		line = b"ab" * 300000
+		self.ed.SetContents(line + b"\n" + line)
+		matchesLine = len(line) // 2 - 1
+		for flags in [0, self.ed.SCFIND_REGEXP]:
+			self.ed.TargetWholeDocument()
+			self.ed.SearchFlags = flags
+			del self.xite.searchProgress[:]
+			self.ed.StartSearchInTarget(0, b"ba")
+			while self.ed.SearchStatus == self.ed.SC_SEARCHSTATUS_RUNNING:
+				self.xite.DoEvents()
+			self.assertEquals(self.ed.SearchStatus, self.ed.SC_SEARCHSTATUS_FINISHED)
+			self.assertEquals(self.ed.FoundCount, matchesLine * 2)
+			for match in range(matchesLine * 2):
+				lineStart = 0 if match < matchesLine else len(line) + 1
+				start = lineStart + 1 + (match % matchesLine) * 2
+				self.assertEquals(self.ed.GetFoundStart(match), start)
+				self.assertEquals(self.ed.GetFoundEnd(match), start + 2)
+			progress = self.xite.searchProgress
+			self.assertTrue(len(progress) > 1)
+			for (position, length, status) in progress[:-1]:
+				self.assertTrue(position < self.ed.Length)
+				self.assertEquals(status, self.ed.SC_SEARCHSTATUS_RUNNING)
+			self.assertEquals(progress[-1], (self.ed.Length, matchesLine * 2, self.ed.SC_SEARCHSTATUS_FINISHED))
+			positions = [position for (position, length, status) in progress]
+			self.assertEquals(positions, sorted(positions))
+		self.ed.SetContents(b"")
+
 	def testTargetWhole(self):
 		self.ed.SetContents(b"abcd")
 		self.ed.TargetStart = 1
@@ -1045,6 +1148,121 @@ class TestScrolling(unittest.TestCase):
 		self.ed.FirstVisibleLine = 7
 		self.assertEquals(self.ed.FirstVisibleLine, 7)
 
+class TestWrapping(unittest.TestCase):
+
+	def setUp(self):
+		self.xite = Xite.xiteFrame
+		self.ed = self.xite.ed
+		self.ed.ClearAll()
+		self.ed.EmptyUndoBuffer()
+		# Enough lines for several groups of lines to be measured on other threads
+		# with words of varying lengths so lines wrap at different points
+		text = b""
+		for line in range(150):
+			words = [b"w" * (1 + (line * word) % 13) for word in range(1 + line % 40)]
+			text += b" ".join(words) + b"\n"
+		self.ed.AddText(len(text), text)
+
+	def tearDown(self):
+		self.ed.WrapMode = self.ed.SC_WRAP_NONE
+		self.ed.WrapThreads = 1
+		self.ed.WrapEstimate = 0
+		self.ed.WrapIndentMode = self.ed.SC_WRAPINDENT_FIXED
+		self.ed.StyleResetDefault()
+		self.ed.StyleClearAll()
+
+	def WrapWithThreads(self, threads):
+		self.ed.WrapMode = self.ed.SC_WRAP_NONE
+		self.ed.WrapThreads = threads
+		self.ed.WrapMode = self.ed.SC_WRAP_WORD
+		# Ensuring the last line is visible wraps every line
+		self.ed.EnsureVisible(self.ed.LineCount - 1)
+		self.ed.FirstVisibleLine = 0
+		wrapCounts = [self.ed.WrapCount(line) for line in range(self.ed.LineCount)]
+		wrapPoints = [self.ed.PointYFromPosition(pos) for pos in range(self.ed.Length)]
+		return wrapCounts, wrapPoints
+
+	def testThreadsWrapAsOneThread(self):
+		wrapCounts, wrapPoints = self.WrapWithThreads(1)
+		# The text wraps
+		self.assertGreater(sum(wrapCounts), self.ed.LineCount)
+		for threads in [2, 4, 0]:
+			wrapCountsThreads, wrapPointsThreads = self.WrapWithThreads(threads)
+			self.assertEquals(wrapCountsThreads, wrapCounts)
+			self.assertEquals(wrapPointsThreads, wrapPoints)
+
+	def EstimateAndWrap(self, indentMode):
+		self.ed.WrapMode = self.ed.SC_WRAP_NONE
+		self.ed.WrapIndentMode = indentMode
+		self.ed.WrapEstimate = 1
+		self.ed.WrapMode = self.ed.SC_WRAP_CHAR
+		# Ensuring the first line is visible estimates heights then wraps only the first lines
+		self.ed.EnsureVisible(0)
+		estimates = [self.ed.WrapCount(line) for line in range(self.ed.LineCount)]
+		# Without estimates, ensuring the last line is visible wraps every line
+		self.ed.WrapEstimate = 0
+		self.ed.EnsureVisible(self.ed.LineCount - 1)
+		wrapCounts = [self.ed.WrapCount(line) for line in range(self.ed.LineCount)]
+		return estimates, wrapCounts
+
+	def testEstimateHeights(self):
+		self.ed.StyleSetFont(self.ed.STYLE_DEFAULT, b"Courier New")
+		self.ed.StyleClearAll()
+		self.ed.ClearAll()
+		text = b""
+		for line in range(150):
+			text += b" " * (4 * (line % 4)) + b"x" * (20 + (line * 37) % 400) + b"\n"
+		self.ed.AddText(len(text), text)
+		sums = []
+		for indentMode in [self.ed.SC_WRAPINDENT_FIXED, self.ed.SC_WRAPINDENT_SAME, self.ed.SC_WRAPINDENT_INDENT]:
+			estimates, wrapCounts = self.EstimateAndWrap(indentMode)
+			self.assertGreater(sum(estimates), self.ed.LineCount)
+			for line in range(self.ed.LineCount):
+				self.assertLessEqual(abs(estimates[line] - wrapCounts[line]), 1)
+			sums.append(sum(estimates))
+		# Indented continuation lines are narrower so text takes more lines
+		self.assertLess(sums[0], sums[1])
+		self.assertLess(sums[1], sums[2])
+
+class TestLayoutCache(unittest.TestCase):
+
+	def setUp(self):
+		self.xite = Xite.xiteFrame
+		self.ed = self.xite.ed
+		self.ed.ClearAll()
+		self.ed.EmptyUndoBuffer()
+
+	def tearDown(self):
+		self.ed.WrapMode = self.ed.SC_WRAP_NONE
+		self.ed.LayoutCacheBudget = 0
+		self.ed.LayoutCache = self.ed.SC_CACHE_CARET
+
+	def testBudget(self):
+		self.assertEquals(self.ed.LayoutCacheBudget, 0)
+		self.ed.LayoutCacheBudget = 100000
+		self.assertEquals(self.ed.LayoutCacheBudget, 100000)
+		self.ed.LayoutCacheBudget = 0
+		self.assertEquals(self.ed.LayoutCacheBudget, 0)
+
+	def MemoryAfterWrapping(self):
+		self.ed.WrapMode = self.ed.SC_WRAP_NONE
+		self.ed.WrapMode = self.ed.SC_WRAP_WORD
+		# Ensuring the last line is visible lays out every line
+		self.ed.EnsureVisible(self.ed.LineCount - 1)
+		return self.ed.LayoutCacheMemory
+
+	def testMemoryWithinBudget(self):
+		text = b"abc def ghi jkl mno pqr stu vwx\n" * 10000
+		self.ed.AddText(len(text), text)
+		self.ed.LayoutCache = self.ed.SC_CACHE_DOCUMENT
+		memoryUnlimited = self.MemoryAfterWrapping()
+		budget = 200000
+		self.ed.LayoutCacheBudget = budget
+		self.assertEquals(self.ed.LayoutCacheBudget, budget)
+		memoryBudget = self.MemoryAfterWrapping()
+		self.assertLess(memoryBudget, memoryUnlimited)
+		self.assertLess(memoryBudget, budget * 2)
+
 class TestSearch(unittest.TestCase):
 
 	def setUp(self):
@@ -1070,6 +1288,32 @@ class TestSearch(unittest.TestCase):
 		self.assertEquals(self.ed.FindBytes(0, self.ed.Length, b"bIg",
 			self.ed.SCFIND_MATCHCASE), -1)
 
+	def testCaseFindBackward(self):
+		self.ed.InsertText(0, b"big ")
+		self.assertEquals(self.ed.FindBytes(self.ed.Length, 0, b"big",
+			self.ed.SCFIND_MATCHCASE), 6)
+		self.assertEquals(self.ed.FindBytes(6, 0, b"big",
+			self.ed.SCFIND_MATCHCASE), 0)
+		self.assertEquals(self.ed.FindBytes(self.ed.Length, 0, b"boat\t",
+			self.ed.SCFIND_MATCHCASE), 10)
+		self.assertEquals(self.ed.FindBytes(self.ed.Length, 0, b"boats",
+			self.ed.SCFIND_MATCHCASE), -1)
+
+	def testCaseFindAcrossGap(self):
+		# Inserting in the middle leaves the gap inside the second "boat" so matches straddle it
+		self.ed.InsertText(8, b"at boa")
+		self.assertEquals(self.ed.Contents(), b"a\tbig boat boat\t")
+		for flags in [self.ed.SCFIND_MATCHCASE, self.ed.SCFIND_MATCHCASE | self.ed.SCFIND_WHOLEWORD]:
+			self.assertEquals(self.ed.FindBytes(0, self.ed.Length, b"boat", flags), 6)
+			self.assertEquals(self.ed.FindBytes(7, self.ed.Length, b"boat", flags), 11)
+			self.assertEquals(self.ed.FindBytes(self.ed.Length, 0, b"boat", flags), 11)
+			self.assertEquals(self.ed.FindBytes(14, 0, b"boat", flags), 6)
+			self.assertEquals(self.ed.FindBytes(0, self.ed.Length, b"boat boat", flags), 6)
+		self.assertEquals(self.ed.FindBytes(0, self.ed.Length, b"t b",
+			self.ed.SCFIND_MATCHCASE), 9)
+		self.assertEquals(self.ed.FindBytes(0, self.ed.Length, b"t b",
+			self.ed.SCFIND_MATCHCASE | self.ed.SCFIND_WHOLEWORD), -1)
+
 	def testWordFind(self):
 		self.assertEquals(self.ed.FindBytes(0, self.ed.Length, b"bi", 0), 2)
 		self.assertEquals(self.ed.FindBytes(0, self.ed.Length, b"bi",
@@ -1096,6 +1340,23 @@ class TestSearch(unittest.TestCase):
 		self.assertEquals(10, self.ed.FindBytes(0, self.ed.Length, b"\t$", flags))
 		self.assertEquals(0, self.ed.FindBytes(0, self.ed.Length, b"\([a]\).*\0", flags))
 
+	def testRECache(self):
+		flags = self.ed.SCFIND_REGEXP
+		hits = self.ed.GetRegexCacheHits()
+		misses = self.ed.GetRegexCacheMisses()
+		self.assertEquals(2, self.ed.FindBytes(0, self.ed.Length, b"b.g", flags))
+		self.assertEquals(misses + 1, self.ed.GetRegexCacheMisses())
+		self.assertEquals(6, self.ed.FindBytes(3, self.ed.Length, b"b.", flags))
+		self.assertEquals(2, self.ed.FindBytes(0, self.ed.Length, b"b.g", flags))
+		self.assertEquals(hits + 1, self.ed.GetRegexCacheHits())
+		self.assertEquals(misses + 2, self.ed.GetRegexCacheMisses())
+		# Changing the flags or word characters compiles again
+		self.assertEquals(2, self.ed.FindBytes(0, self.ed.Length, b"b.g", flags | self.ed.SCFIND_MATCHCASE))
+		self.ed.SetWordChars(b"abcdefghijklmnopqrstuvwxyz")
+		self.assertEquals(2, self.ed.FindBytes(0, self.ed.Length, b"b.g", flags))
+		self.assertEquals(misses + 4, self.ed.GetRegexCacheMisses())
+		self.ed.SetCharsDefault()
+
 	def testPosixREFind(self):
 		flags = self.ed.SCFIND_REGEXP | self.ed.SCFIND_POSIX
 		self.assertEquals(-1, self.ed.FindBytes(0, self.ed.Length, b"b.g", 0))
@@ -1128,6 +1389,44 @@ class TestSearch(unittest.TestCase):
 		self.assertEquals(-1, self.ed.FindBytes(0, self.ed.Length, b"\\xAB", flags))
 		self.assertEquals(0, self.ed.FindBytes(0, self.ed.Length, b"\\xAD", flags))
 
+	def testMultilineREFind(self):
+		self.ed.SetContents(b"one\ntwo\r\nthree")
+		flags = self.ed.SCFIND_REGEXP | self.ed.SCFIND_MULTILINE
+		self.assertEquals(-1, self.ed.FindBytes(0, self.ed.Length, b"e\\nt", self.ed.SCFIND_REGEXP))
+		self.assertEquals(2, self.ed.FindBytes(0, self.ed.Length, b"e\\nt", flags))
+		self.assertEquals(6, self.ed.FindBytes(0, self.ed.Length, b"o\\s+t", flags))
+		self.assertEquals(9, self.ed.FindBytes(self.ed.Length, 0, b"^t", flags))
+		self.assertEquals(6, self.ed.FindBytes(0, self.ed.Length, b"o$", flags))
+		self.assertEquals(2, self.ed.FindBytes(0, self.ed.Length, b"e\\n\\|o\\r", flags))
+		self.assertEquals(-1, self.ed.FindBytes(0, self.ed.Length, b"\\(o\\)\\1", flags))
+		self.ed.TargetWholeDocument()
+		self.ed.SearchFlags = flags
+		searchString = b"\\(\\w+\\)\\r\\n\\(\\w+\\)"
+		self.assertEquals(4, self.ed.SearchInTarget(len(searchString), searchString))
+		self.assertEquals(self.ed.GetTag(1), b"two")
+		self.assertEquals(self.ed.GetTag(2), b"three")
+		rep = b"\\2 \\1"
+		self.ed.ReplaceTargetRE(len(rep), rep)
+		self.assertEquals(self.ed.Contents(), b"one\nthree two")
+
+	def testParallelFind(self):
+		# Large enough to be divided between threads
+		self.ed.SetContents(b"abcdefghij\n" * 300000 + b"needle\n" + b"abcdefghij\n" * 300000)
+		needlePos = 11 * 300000
+		for flags in [0, self.ed.SCFIND_MATCHCASE, self.ed.SCFIND_REGEXP]:
+			flags |= self.ed.SCFIND_PARALLEL
+			self.assertEquals(needlePos, self.ed.FindBytes(0, self.ed.Length, b"needle", flags))
+			self.assertEquals(needlePos, self.ed.FindBytes(self.ed.Length, 0, b"needle", flags))
+			self.assertEquals(-1, self.ed.FindBytes(0, self.ed.Length, b"needles", flags))
+		flags = self.ed.SCFIND_REGEXP | self.ed.SCFIND_PARALLEL
+		self.assertEquals(11, self.ed.FindBytes(1, self.ed.Length, b"^a", flags))
+		self.assertEquals(needlePos + 7 + 11 * 299999, self.ed.FindBytes(self.ed.Length, 0, b"^a", flags))
+		self.ed.TargetWholeDocument()
+		self.ed.SearchFlags = self.ed.SCFIND_MATCHCASE | self.ed.SCFIND_PARALLEL
+		self.assertEquals(600000, self.ed.FindAllInTarget(0, b"j\n"))
+		self.assertEquals(self.ed.GetFoundStart(599999), self.ed.Length - 2)
+		self.ed.ClearAll()
+
 	def testMultipleAddSelection(self):
 		# Find both 'a'
 		self.assertEquals(self.ed.MultipleSelection, 0)
@@ -1549,6 +1848,47 @@ class TestStyleAttributes(unittest.TestCase):
 		self.ed.StyleSetHotSpot(self.ed.STYLE_DEFAULT, 1)
 		self.assertEquals(self.ed.StyleGetHotSpot(self.ed.STYLE_DEFAULT), 1)
 
+class TestMeasuring(unittest.TestCase):
+	""" Graphic ASCII text in a font where each of those characters has the same width
+	is positioned without measuring each piece of text so check it matches measurements.
+	"""
+	def setUp(self):
+		self.xite = Xite.xiteFrame
+		self.ed = self.xite.ed
+		self.ed.ClearAll()
+		self.ed.EmptyUndoBuffer()
+		self.graphic = bytes(bytearray(range(0x21, 0x7F)))
+
+	def tearDown(self):
+		self.ed.StyleResetDefault()
+		self.ed.StyleClearAll()
+
+	def SetFont(self, font):
+		self.ed.StyleSetFont(self.ed.STYLE_DEFAULT, font)
+		self.ed.StyleClearAll()
+
+	def WidthInText(self, text):
+		self.ed.ClearAll()
+		self.ed.AddText(len(text), text)
+		return self.ed.PointXFromPosition(len(text)) - self.ed.PointXFromPosition(0)
+
+	def testMonospacedPositions(self):
+		self.SetFont(b"Courier New")
+		self.ed.AddText(len(self.graphic), self.graphic)
+		xStart = self.ed.PointXFromPosition(0)
+		for pos in range(1, len(self.graphic) + 1):
+			measured = self.ed.TextWidth(0, self.graphic[:pos])
+			self.assertAlmostEqual(self.ed.PointXFromPosition(pos) - xStart, measured, delta=1)
+		self.assertEquals(self.WidthInText(b"i" * 20), self.WidthInText(b"W" * 20))
+
+	def testProportionalPositions(self):
+		self.SetFont(b"Verdana")
+		narrow = self.WidthInText(b"i" * 20)
+		wide = self.WidthInText(b"W" * 20)
+		self.assertLess(narrow, wide)
+		self.assertAlmostEqual(narrow, self.ed.TextWidth(0, b"i" * 20), delta=1)
+		self.assertAlmostEqual(wide, self.ed.TextWidth(0, b"W" * 20), delta=1)
+
 class TestCharacterNavigation(unittest.TestCase):
 	def setUp(self):
 		self.xite = Xite.xiteFrame
@@ -1602,6 +1942,13 @@ class TestCharacterNavigation(unittest.TestCase):
 		for i in range(0, len(t)):
 			self.assertEquals(self.ed.CountCharacters(0, i), i)
 
+	def testCountLong(self):
+		# Long enough to be counted in several blocks with characters spanning the block ends
+		t = "a\xc3\xa5\xef\xac\x82-\x80" * 20000
+		self.ed.SetContents(t.encode("latin-1"))
+		self.assertEquals(self.ed.CountCharacters(0, len(t)), 5 * 20000)
+		self.assertEquals(self.ed.CountCharacters(3, len(t) - 2), 5 * 20000 - 4)
+
 class TestCaseMapping(unittest.TestCase):
 	def setUp(self):
 		self.xite = Xite.xiteFrame
@@ -1777,6 +2124,35 @@ class TestCaseInsensitiveSearch(unittest.TestCase):
 		self.assertEquals(firstPosition, pos)
 		self.assertEquals(firstPosition+1, self.ed.TargetEnd)
 
+	def testASCIIAcrossGap(self):
+		self.ed.SetContents(b"big boat")
+		# Inserting in the middle leaves the gap inside the second "boat" so matches straddle it
+		self.ed.InsertText(6, b"AT BO")
+		self.assertEquals(self.ed.Contents(), b"big boAT BOat")
+		self.assertEquals(4, self.ed.FindBytes(0, self.ed.Length, b"boat", 0))
+		self.assertEquals(9, self.ed.FindBytes(5, self.ed.Length, b"BOAT", 0))
+		self.assertEquals(9, self.ed.FindBytes(self.ed.Length, 0, b"bOaT", 0))
+		self.assertEquals(4, self.ed.FindBytes(12, 0, b"boat", self.ed.SCFIND_WHOLEWORD))
+
+	def testUTFBackward(self):
+		self.ed.SetCodePage(65001)
+		text = "Frånds Ååſ $".encode("UTF-8")
+		self.ed.SetContents(text)
+		self.ed.SearchFlags = 0
+		searchString = "Å".encode("UTF-8")
+		self.ed.TargetStart = self.ed.Length
+		self.ed.TargetEnd = 0
+		pos = self.ed.SearchInTarget(len(searchString), searchString)
+		self.assertEquals(len("Frånds Å".encode("UTF-8")), pos)
+		# ASCII "S" matches the two byte "ſ"
+		searchString = b"S"
+		self.ed.TargetStart = self.ed.Length
+		self.ed.TargetEnd = 0
+		pos = self.ed.SearchInTarget(len(searchString), searchString)
+		firstPosition = len("Frånds Åå".encode("UTF-8"))
+		self.assertEquals(firstPosition, pos)
+		self.assertEquals(firstPosition+2, self.ed.TargetEnd)
+
 class TestLexer(unittest.TestCase):
 	def setUp(self):
 		self.xite = Xite.xiteFrame
@@ -12,12 +12,16 @@ CXXFLAGS = /EHsc /wd 4805 $(INCLUDEDIRS)
 TESTSRC=test*.cxx
 # Files being tested from scintilla/src directory
 TESTEDSRC=\
+ ../../lexlib/CharacterCategory.cxx \
  ../../lexlib/WordList.cxx \
+ ../../src/CaseConvert.cxx \
  ../../src/CellBuffer.cxx \
  ../../src/CharClassify.cxx \
  ../../src/ContractionState.cxx \
  ../../src/Decoration.cxx \
- ../../src/RunStyles.cxx 
+ ../../src/MultilineRegex.cxx \
+ ../../src/RunStyles.cxx \
+ ../../src/UniConversion.cxx 
 
 TESTS=$(EXE)
 
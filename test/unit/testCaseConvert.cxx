@@ -0,0 +1,229 @@
+// Unit Tests for Scintilla internal data structures
+
+#include <string.h>
+
+#include <string>
+
+#include "Platform.h"
+
+#include "CaseConvert.h"
+#include "UniConversion.h"
+
+#include "catch.hpp"
+
+#ifdef SCI_NAMESPACE
+using namespace Scintilla;
+#endif
+
+// Test CaseConvert.
+// The conversion tables are generated so every code point is converted and the results
+// compared with hashes of the conversions made by the tables before they were regenerated.
+
+namespace {
+
+const int maxCharacter = 0x10FFFF;
+
+const CaseConversion conversions[] = {
+	CaseConversionFold,
+	CaseConversionUpper,
+	CaseConversionLower
+};
+
+std::string UTF8FromCharacter(int character) {
+	char bytes[4];
+	size_t length = 0;
+	if (character < 0x80) {
+		bytes[length++] = static_cast<char>(character);
+	} else if (character < 0x800) {
+		bytes[length++] = static_cast<char>(0xC0 | (character >> 6));
+		bytes[length++] = static_cast<char>(0x80 | (character & 0x3F));
+	} else if (character < 0x10000) {
+		bytes[length++] = static_cast<char>(0xE0 | (character >> 12));
+		bytes[length++] = static_cast<char>(0x80 | ((character >> 6) & 0x3F));
+		bytes[length++] = static_cast<char>(0x80 | (character & 0x3F));
+	} else {
+		bytes[length++] = static_cast<char>(0xF0 | (character >> 18));
+		bytes[length++] = static_cast<char>(0x80 | ((character >> 12) & 0x3F));
+		bytes[length++] = static_cast<char>(0x80 | ((character >> 6) & 0x3F));
+		bytes[length++] = static_cast<char>(0x80 | (character & 0x3F));
+	}
+	return std::string(bytes, length);
+}
+
+bool IsSurrogate(int character) {
+	return (character >= 0xD800) && (character <= 0xDFFF);
+}
+
+// FNV-1a
+unsigned int HashBytes(unsigned int hash, const char *s, size_t length) {
+	for (size_t i = 0; i < length; i++) {
+		hash ^= static_cast<unsigned char>(s[i]);
+		hash *= 16777619U;
+	}
+	return hash;
+}
+
+const unsigned int hashStart = 2166136261U;
+
+// Hash each character that has a conversion followed by its conversion.
+unsigned int HashConversions(CaseConversion conversion, int &converted) {
+	unsigned int hash = hashStart;
+	converted = 0;
+	for (int character = 0; character <= maxCharacter; character++) {
+		const char *caseConverted = CaseConvert(character, conversion);
+		if (caseConverted && *caseConverted) {
+			converted++;
+			const char bytesCharacter[] = {
+				static_cast<char>(character >> 16),
+				static_cast<char>(character >> 8),
+				static_cast<char>(character)
+			};
+			hash = HashBytes(hash, bytesCharacter, sizeof(bytesCharacter));
+			hash = HashBytes(hash, caseConverted, strlen(caseConverted) + 1);
+		}
+	}
+	return hash;
+}
+
+struct KnownConversion {
+	int character;
+	const char *conversion[3];	// Fold, upper, lower
+};
+
+// Complex cases and the first and last characters of blocks
+const KnownConversion knownConversions[] = {
+	{0x41, {"a", "", "a"}},
+	{0x5A, {"z", "", "z"}},
+	{0x61, {"", "A", ""}},
+	{0x7A, {"", "Z", ""}},
+	{0xB5, {"\xce\xbc", "\xce\x9c", ""}},
+	{0xC0, {"\xc3\xa0", "", "\xc3\xa0"}},
+	{0xDE, {"\xc3\xbe", "", "\xc3\xbe"}},
+	// Sharp s expands
+	{0xDF, {"ss", "SS", ""}},
+	{0xFF, {"", "\xc5\xb8", ""}},
+	// Turkish dotted and dotless i
+	{0x130, {"i\xcc\x87", "", "i\xcc\x87"}},
+	{0x131, {"", "I", ""}},
+	{0x149, {"\xca\xbcn", "\xca\xbcN", ""}},
+	{0x178, {"\xc3\xbf", "", "\xc3\xbf"}},
+	{0x17F, {"s", "S", ""}},
+	// Title case digraphs
+	{0x1C4, {"\xc7\x86", "", "\xc7\x86"}},
+	{0x1C5, {"\xc7\x86", "\xc7\x84", "\xc7\x86"}},
+	{0x1C6, {"", "\xc7\x84", ""}},
+	{0x345, {"\xce\xb9", "\xce\x99", ""}},
+	// Greek with dialytika and tonos expands to 3 characters
+	{0x390, {"\xce\xb9\xcc\x88\xcc\x81", "\xce\x99\xcc\x88\xcc\x81", ""}},
+	{0x3A3, {"\xcf\x83", "", "\xcf\x83"}},
+	{0x3C2, {"\xcf\x83", "\xce\xa3", ""}},
+	{0x3F4, {"\xce\xb8", "", "\xce\xb8"}},
+	{0x400, {"\xd1\x90", "", "\xd1\x90"}},
+	{0x42F, {"\xd1\x8f", "", "\xd1\x8f"}},
+	{0x4FF, {"", "\xd3\xbe", ""}},
+	{0x531, {"\xd5\xa1", "", "\xd5\xa1"}},
+	{0x556, {"\xd6\x86", "", "\xd6\x86"}},
+	{0x587, {"\xd5\xa5\xd6\x82", "\xd4\xb5\xd5\x92", ""}},
+	{0x10A0, {"\xe2\xb4\x80", "", "\xe2\xb4\x80"}},
+	{0x10C5, {"\xe2\xb4\xa5", "", "\xe2\xb4\xa5"}},
+	{0x13A0, {"", "", ""}},
+	{0x1E9E, {"ss", "", "\xc3\x9f"}},
+	{0x1F80, {"\xe1\xbc\x80\xce\xb9", "\xe1\xbc\x88\xce\x99", ""}},
+	{0x1FFC, {"\xcf\x89\xce\xb9", "\xce\xa9\xce\x99", "\xe1\xbf\xb3"}},
+	{0x2126, {"\xcf\x89", "", "\xcf\x89"}},
+	{0x212A, {"k", "", "k"}},
+	{0x2C00, {"\xe2\xb0\xb0", "", "\xe2\xb0\xb0"}},
+	{0x2C2E, {"\xe2\xb1\x9e", "", "\xe2\xb1\x9e"}},
+	{0xA640, {"\xea\x99\x81", "", "\xea\x99\x81"}},
+	// Ligatures expand
+	{0xFB00, {"ff", "FF", ""}},
+	{0xFB06, {"st", "ST", ""}},
+	{0xFF21, {"\xef\xbd\x81", "", "\xef\xbd\x81"}},
+	{0xFF3A, {"\xef\xbd\x9a", "", "\xef\xbd\x9a"}},
+	{0xFF41, {"", "\xef\xbc\xa1", ""}},
+	{0xFF5A, {"", "\xef\xbc\xba", ""}},
+	{0x10400, {"\xf0\x90\x90\xa8", "", "\xf0\x90\x90\xa8"}},
+	{0x1044F, {"", "\xf0\x90\x90\xa7", ""}},
+	{0x10FFFF, {"", "", ""}},
+};
+
+}
+
+TEST_CASE("CaseConvert") {
+
+	UTF8BytesOfLeadInitialise();
+
+	SECTION("Known") {
+		for (size_t known = 0; known < sizeof(knownConversions) / sizeof(knownConversions[0]); known++) {
+			const KnownConversion &kc = knownConversions[known];
+			for (int conversion = 0; conversion < 3; conversion++) {
+				const char *caseConverted = CaseConvert(kc.character, conversions[conversion]);
+				REQUIRE(std::string(caseConverted ? caseConverted : "") == kc.conversion[conversion]);
+			}
+		}
+	}
+
+	SECTION("OutOfRange") {
+		for (int conversion = 0; conversion < 3; conversion++) {
+			const char *caseConverted = CaseConvert(-1, conversions[conversion]);
+			REQUIRE((!caseConverted || !*caseConverted));
+			caseConverted = CaseConvert(maxCharacter + 1, conversions[conversion]);
+			REQUIRE((!caseConverted || !*caseConverted));
+		}
+	}
+
+	SECTION("AllCharacters") {
+		// Hashes and counts of the conversions made by the tables before they were regenerated
+		const unsigned int hashes[] = { 0x49852594U, 0x236E98C3U, 0xDF97AE29U };
+		const int counts[] = { 1131, 1126, 1043 };
+		for (int conversion = 0; conversion < 3; conversion++) {
+			int converted = 0;
+			const unsigned int hash = HashConversions(conversions[conversion], converted);
+			REQUIRE(counts[conversion] == converted);
+			REQUIRE(hashes[conversion] == hash);
+		}
+	}
+
+	SECTION("StringOfEachCharacter") {
+		// Converting a string of one character gives the character's conversion or the character
+		char converted[maxExpansionCaseConversion * 4 + 1];
+		for (int conversion = 0; conversion < 3; conversion++) {
+			int different = 0;
+			for (int character = 0; character <= maxCharacter; character++) {
+				if (IsSurrogate(character))
+					continue;
+				const std::string mixed = UTF8FromCharacter(character);
+				const size_t lenConverted = CaseConvertString(converted, sizeof(converted),
+					mixed.c_str(), mixed.length(), conversions[conversion]);
+				const char *caseConverted = CaseConvert(character, conversions[conversion]);
+				const std::string expected = (caseConverted && *caseConverted) ? caseConverted : mixed;
+				if (std::string(converted, lenConverted) != expected)
+					different++;
+			}
+			REQUIRE(0 == different);
+		}
+	}
+
+	SECTION("StringOfAllCharacters") {
+		std::string mixed;
+		for (int character = 0; character <= maxCharacter; character++) {
+			if (!IsSurrogate(character))
+				mixed += UTF8FromCharacter(character);
+		}
+		const size_t lengths[] = { 4382744, 4382763, 4382580 };
+		const unsigned int hashes[] = { 0x6B031A37U, 0xE344C3EDU, 0x2747F3A1U };
+		std::string converted(mixed.length() * maxExpansionCaseConversion, '\0');
+		for (int conversion = 0; conversion < 3; conversion++) {
+			const size_t lenConverted = CaseConvertString(&converted[0], converted.length(),
+				mixed.c_str(), mixed.length(), conversions[conversion]);
+			REQUIRE(lengths[conversion] == lenConverted);
+			REQUIRE(hashes[conversion] == HashBytes(hashStart, converted.c_str(), lenConverted));
+		}
+	}
+
+	SECTION("NotEnoughSpace") {
+		char converted[2];
+		REQUIRE(0 == CaseConvertString(converted, sizeof(converted), "\xc3\x9f", 2, CaseConversionUpper));
+	}
+
+}
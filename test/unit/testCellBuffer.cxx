@@ -1,8 +1,12 @@
 // Unit Tests for Scintilla internal data structures
 
+#include <cstdio>
 #include <cstring>
 #include <stdexcept>
+#include <string>
+#include <vector>
 #include <algorithm>
+#include <chrono>
 
 #include "Platform.h"
 
@@ -139,3 +143,457 @@ TEST_CASE("CellBuffer") {
 	}
 
 }
+
+TEST_CASE("CellBufferUndoArena") {
+
+	CellBuffer cb;
+	bool startSequence = false;
+
+	SECTION("ReleaseRedo") {
+		cb.InsertString(0, "abc", 3, startSequence);
+		REQUIRE(3 == cb.UndoBytes());
+		cb.StartUndo();
+		cb.PerformUndoStep();
+		REQUIRE(cb.CanRedo());
+		// New action replaces the redo branch
+		const char *cpChange = cb.InsertString(0, "xy", 2, startSequence);
+		REQUIRE(memcmp(cpChange, "xy", 2) == 0);
+		REQUIRE(2 == cb.UndoBytes());
+		REQUIRE(!cb.CanRedo());
+		cb.DeleteUndoHistory();
+		REQUIRE(0 == cb.UndoBytes());
+	}
+
+	SECTION("LargeActions") {
+		// Larger than a chunk of the arena
+		std::string text;
+		for (int i = 0; i < 100000; i++) {
+			text += static_cast<char>('a' + i % 26);
+		}
+		cb.InsertString(0, text.c_str(), text.length(), startSequence);
+		const char *cpDeletion = cb.DeleteChars(10, 70000, startSequence);
+		REQUIRE(memcmp(cpDeletion, text.c_str() + 10, 70000) == 0);
+		REQUIRE(30000 == cb.Length());
+		REQUIRE(170000 == cb.UndoBytes());
+		cb.StartUndo();
+		cb.PerformUndoStep();
+		REQUIRE(memcmp(cb.BufferPointer(), text.c_str(), text.length()) == 0);
+		cb.StartUndo();
+		cb.PerformUndoStep();
+		REQUIRE(0 == cb.Length());
+		cb.StartRedo();
+		cb.PerformRedoStep();
+		REQUIRE(memcmp(cb.BufferPointer(), text.c_str(), text.length()) == 0);
+	}
+
+	SECTION("Limit") {
+		REQUIRE(0 == cb.GetUndoLimitBytes());
+		cb.SetUndoLimitBytes(1000);
+		REQUIRE(1000 == cb.GetUndoLimitBytes());
+		const std::string block(100, 'x');
+		for (int i = 0; i < 100; i++) {
+			cb.BeginUndoAction();
+			cb.InsertString(cb.Length(), block.c_str(), block.length(), startSequence);
+			cb.EndUndoAction();
+			REQUIRE(cb.UndoBytes() <= 1000);
+		}
+		REQUIRE(10000 == cb.Length());
+		int operations = 0;
+		while (cb.CanUndo()) {
+			const int steps = cb.StartUndo();
+			for (int step = 0; step < steps; step++) {
+				cb.PerformUndoStep();
+			}
+			operations++;
+		}
+		REQUIRE(operations >= 1);
+		REQUIRE(operations <= 10);
+		REQUIRE(cb.Length() == (10000 - operations * 100));
+		REQUIRE(!cb.IsSavePoint());
+	}
+
+	SECTION("Compression") {
+		cb.SetUndoCompressionThreshold(1000);
+		REQUIRE(1000 == cb.GetUndoCompressionThreshold());
+		// Words give matches of many lengths and random bytes give long literal runs
+		const char *words[] = { "if", "else", " ", "\n", "return x;", "for (int i=0; i<n; i++) {\n", "}\n" };
+		std::string text;
+		unsigned int value = 7;
+		while (text.length() < 200000) {
+			value = value * 1103515245 + 12345;
+			if (((value >> 8) % 100) == 0) {
+				for (int i = 0; i < 300; i++) {
+					value = value * 1103515245 + 12345;
+					text += static_cast<char>(value >> 16);
+				}
+			} else {
+				text += words[(value >> 8) % 7];
+			}
+		}
+		const char *cpChange = cb.InsertString(0, text.c_str(), text.length(), startSequence);
+		REQUIRE(memcmp(cpChange, text.c_str(), text.length()) == 0);
+		REQUIRE(cb.UndoBytes() < static_cast<Sci::Position>(text.length() / 2));
+		const char *cpDeletion = cb.DeleteChars(100, 150000, startSequence);
+		REQUIRE(memcmp(cpDeletion, text.c_str() + 100, 150000) == 0);
+		cb.StartUndo();
+		const Action &actionDeletion = cb.GetUndoStep();
+		REQUIRE(150000 == actionDeletion.lenData);
+		REQUIRE(memcmp(actionDeletion.data, text.c_str() + 100, 150000) == 0);
+		cb.PerformUndoStep();
+		REQUIRE(memcmp(cb.BufferPointer(), text.c_str(), text.length()) == 0);
+		cb.StartUndo();
+		cb.PerformUndoStep();
+		REQUIRE(0 == cb.Length());
+		cb.StartRedo();
+		cb.PerformRedoStep();
+		REQUIRE(memcmp(cb.BufferPointer(), text.c_str(), text.length()) == 0);
+		cb.StartRedo();
+		cb.PerformRedoStep();
+		REQUIRE(static_cast<Sci::Position>(text.length() - 150000) == cb.Length());
+	}
+
+	SECTION("CompressionArenaCapacity") {
+		// The arena should only grow by the compressed length, not the uncompressed length
+		cb.SetUndoCompressionThreshold(1000);
+		std::string text;
+		for (int i = 0; i < 100000; i++) {
+			text += static_cast<char>('a' + (i / 7) % 26);
+		}
+		for (int i = 0; i < 50; i++) {
+			cb.InsertString(cb.Length(), text.c_str(), text.length(), startSequence);
+		}
+		REQUIRE(cb.UndoBytes() < static_cast<Sci::Position>(text.length()));
+		REQUIRE(cb.UndoCapacity() < static_cast<Sci::Position>(text.length()));
+		while (cb.CanUndo()) {
+			const int steps = cb.StartUndo();
+			for (int step = 0; step < steps; step++) {
+				cb.PerformUndoStep();
+			}
+		}
+		REQUIRE(0 == cb.Length());
+	}
+
+	SECTION("CompressionSkipsRandomText") {
+		cb.SetUndoCompressionThreshold(1000);
+		std::string text;
+		unsigned int value = 3;
+		for (int i = 0; i < 5000; i++) {
+			value = value * 1103515245 + 12345;
+			text += static_cast<char>(value >> 16);
+		}
+		cb.InsertString(0, text.c_str(), text.length(), startSequence);
+		REQUIRE(5000 == cb.UndoBytes());
+		cb.StartUndo();
+		REQUIRE(memcmp(cb.GetUndoStep().data, text.c_str(), text.length()) == 0);
+	}
+
+	SECTION("LimitKeepsLastOperation") {
+		cb.SetUndoLimitBytes(100);
+		const std::string block(5000, 'x');
+		cb.InsertString(0, block.c_str(), block.length(), startSequence);
+		cb.InsertString(0, block.c_str(), block.length(), startSequence);
+		REQUIRE(5000 == cb.UndoBytes());
+		REQUIRE(1 == cb.StartUndo());
+		cb.PerformUndoStep();
+		REQUIRE(5000 == cb.Length());
+		REQUIRE(!cb.CanUndo());
+	}
+
+}
+
+namespace {
+
+// Line starts found by a simple scan of the whole text.
+std::vector<Sci::Position> LineStartsOf(const std::string &text, bool utf8LineEnds) {
+	std::vector<Sci::Position> starts(1, 0);
+	const Sci::Position length = text.length();
+	for (Sci::Position i = 0; i < length; i++) {
+		const std::string tail = text.substr(i, 3);
+		if (text[i] == '\r') {
+			if ((i + 1 >= length) || (text[i + 1] != '\n'))
+				starts.push_back(i + 1);
+		} else if (text[i] == '\n') {
+			starts.push_back(i + 1);
+		} else if (utf8LineEnds && (tail.compare(0, 2, "\xc2\x85") == 0)) {
+			starts.push_back(i + 2);
+		} else if (utf8LineEnds && ((tail == "\xe2\x80\xa8") || (tail == "\xe2\x80\xa9"))) {
+			starts.push_back(i + 3);
+		}
+	}
+	return starts;
+}
+
+void CheckLineStarts(const CellBuffer &cb, const std::string &text) {
+	const std::vector<Sci::Position> starts = LineStartsOf(text, cb.GetLineEndTypes() != 0);
+	REQUIRE(cb.Lines() == static_cast<Sci::Line>(starts.size()));
+	for (size_t line = 0; line < starts.size(); line++) {
+		REQUIRE(cb.LineStart(line) == starts[line]);
+	}
+}
+
+}
+
+TEST_CASE("CellBufferLineEnds") {
+
+	// Fragments include partial UTF-8 line ends so insertions join and split line ends
+	const char *fragments[] = {
+		"a", "bc", "\r", "\n", "\r\n", "\xc2\x85", "\xe2\x80\xa8", "\xe2\x80\xa9",
+		"\xe2", "\x80", "\xc2", "0123456789abcdefghijklmnopqrstuvwxyz",
+	};
+	const unsigned int nFragments = sizeof(fragments) / sizeof(fragments[0]);
+
+	for (int utf8LineEnds = 0; utf8LineEnds <= 1; utf8LineEnds++) {
+		CellBuffer cb;
+		cb.SetUndoCollection(false);
+		cb.SetLineEndTypes(utf8LineEnds);
+		std::string text;
+		unsigned int value = 1;
+		for (int insertion = 0; insertion < 300; insertion++) {
+			std::string insert;
+			value = value * 1103515245 + 12345;
+			const unsigned int pieces = (value >> 8) % 40;
+			for (unsigned int piece = 0; piece < pieces; piece++) {
+				value = value * 1103515245 + 12345;
+				insert += fragments[(value >> 8) % nFragments];
+			}
+			value = value * 1103515245 + 12345;
+			const size_t position = (value >> 8) % (text.length() + 1);
+			bool startSequence = false;
+			cb.InsertString(position, insert.c_str(), insert.length(), startSequence);
+			text.insert(position, insert);
+			CheckLineStarts(cb, text);
+			if ((insertion % 3 == 2) && !text.empty()) {
+				value = value * 1103515245 + 12345;
+				const size_t positionDelete = (value >> 8) % text.length();
+				value = value * 1103515245 + 12345;
+				const size_t lengthDelete = (value >> 8) % (text.length() - positionDelete) / 2 + 1;
+				cb.DeleteChars(positionDelete, lengthDelete, startSequence);
+				text.erase(positionDelete, lengthDelete);
+				CheckLineStarts(cb, text);
+			}
+		}
+		// Rescan all the text
+		cb.SetLineEndTypes(!utf8LineEnds);
+		CheckLineStarts(cb, text);
+	}
+
+}
+
+// Counterpart of testHuge in test/performanceTests.py.
+// Hidden so only run when requested with "unitTest [benchmark]".
+
+TEST_CASE("CellBufferPerformance", "[.][benchmark]") {
+
+	SECTION("InsertHuge") {
+		std::string data;
+		for (int line = 0; line < 100000; line++) {
+			data += "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789\n";
+		}
+		CellBuffer cb;
+		cb.SetUndoCollection(false);
+		const std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		bool startSequence = false;
+		cb.InsertString(0, data.c_str(), data.length(), startSequence);
+		const std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start;
+		REQUIRE(cb.Lines() == 100001);
+		printf("CellBuffer insert %d lines: %.4f seconds\n", 100000, duration.count());
+	}
+
+}
+
+TEST_CASE("CellBufferLarge") {
+
+	// A large CellBuffer uses pointer sized line starts from the beginning
+	// but should otherwise behave the same as a default CellBuffer.
+
+	const char sText[] = "Two\nLines";
+	const size_t sLength = strlen(sText);
+
+	CellBuffer cb(true);
+	REQUIRE(cb.IsLarge());
+
+	SECTION("InsertTwoLines") {
+		bool startSequence = false;
+		const char *cpChange = cb.InsertString(0, sText, static_cast<int>(sLength), startSequence);
+		REQUIRE(startSequence);
+		REQUIRE(sLength == static_cast<size_t>(cb.Length()));
+		REQUIRE(memcmp(cpChange, sText, sLength) == 0);
+		REQUIRE(2 == cb.Lines());
+		REQUIRE(0 == cb.LineStart(0));
+		REQUIRE(4 == cb.LineStart(1));
+		REQUIRE(1 == cb.LineFromPosition(5));
+		cb.DeleteChars(2, 3, startSequence);
+		REQUIRE(1 == cb.Lines());
+		REQUIRE(6 == cb.Length());
+	}
+
+	SECTION("DefaultIsNotLarge") {
+		CellBuffer cbSmall;
+		REQUIRE(!cbSmall.IsLarge());
+	}
+
+}
+
+TEST_CASE("CellBufferMapped") {
+
+	// Mapped text is referred to rather than copied until the buffer is made writable.
+
+	const char sText[] = "Three\nshort\r\nlines";
+	const size_t sLength = strlen(sText);
+
+	CellBuffer cb;
+	cb.SetMappedText(sText, sLength);
+
+	SECTION("ReadMapped") {
+		REQUIRE(cb.IsMapped());
+		REQUIRE(cb.IsReadOnly());
+		REQUIRE(static_cast<Sci::Position>(sLength) == cb.Length());
+		REQUIRE(3 == cb.Lines());
+		REQUIRE(6 == cb.LineStart(1));
+		REQUIRE(13 == cb.LineStart(2));
+		REQUIRE(1 == cb.LineFromPosition(7));
+		REQUIRE('s' == cb.CharAt(6));
+		REQUIRE(0 == cb.CharAt(-1));
+		REQUIRE(0 == cb.CharAt(static_cast<int>(sLength)));
+		REQUIRE(0 == cb.StyleAt(3));
+		char buffer[6] = "";
+		cb.GetCharRange(buffer, 6, 5);
+		REQUIRE(memcmp(buffer, "short", 5) == 0);
+		REQUIRE(cb.RangePointer(0, static_cast<int>(sLength)) == sText);
+		bool startSequence = false;
+		cb.InsertString(0, "x", 1, startSequence);
+		REQUIRE(static_cast<Sci::Position>(sLength) == cb.Length());
+	}
+
+	SECTION("Materialize") {
+		cb.SetReadOnly(false);
+		REQUIRE(!cb.IsMapped());
+		REQUIRE(static_cast<Sci::Position>(sLength) == cb.Length());
+		REQUIRE(cb.RangePointer(0, static_cast<int>(sLength)) != sText);
+		bool startSequence = false;
+		cb.InsertString(0, "x\n", 2, startSequence);
+		REQUIRE(4 == cb.Lines());
+		REQUIRE(8 == cb.LineStart(2));
+		REQUIRE(memcmp(cb.BufferPointer(), "x\nThree", 7) == 0);
+	}
+
+}
+
+TEST_CASE("CellBufferStyleRuns") {
+
+	// Styles held as runs should behave the same as a byte for each character.
+
+	const char sText[] = "Scintilla\nstyles";
+	const int sLength = static_cast<int>(strlen(sText));
+
+	CellBuffer cb;
+	CellBuffer cbRuns(false, true);
+	bool startSequence = false;
+	cb.InsertString(0, sText, sLength, startSequence);
+	cbRuns.InsertString(0, sText, sLength, startSequence);
+
+	SECTION("StartsUnstyled") {
+		for (int i = 0; i < sLength; i++) {
+			REQUIRE(0 == cbRuns.StyleAt(i));
+		}
+		REQUIRE(0 == cbRuns.StyleAt(-1));
+		REQUIRE(0 == cbRuns.StyleAt(sLength));
+	}
+
+	SECTION("SetStyles") {
+		REQUIRE(cbRuns.SetStyleFor(2, 5, 3));
+		REQUIRE(!cbRuns.SetStyleFor(3, 2, 3));
+		REQUIRE(cbRuns.SetStyleAt(12, 7));
+		REQUIRE(!cbRuns.SetStyleAt(12, 7));
+		REQUIRE(!cbRuns.SetStyleAt(sLength, 7));
+		REQUIRE(0 == cbRuns.StyleAt(1));
+		REQUIRE(3 == cbRuns.StyleAt(2));
+		REQUIRE(3 == cbRuns.StyleAt(6));
+		REQUIRE(0 == cbRuns.StyleAt(7));
+		REQUIRE(7 == cbRuns.StyleAt(12));
+		unsigned char styles[5] = {};
+		cbRuns.GetStyleRange(styles, 5, 5);
+		const unsigned char stylesExpected[5] = {3, 3, 0, 0, 0};
+		REQUIRE(memcmp(styles, stylesExpected, 5) == 0);
+	}
+
+	SECTION("InsertIsUnstyled") {
+		cbRuns.SetStyleFor(0, sLength, 5);
+		cbRuns.InsertString(4, "xy", 2, startSequence);
+		REQUIRE(5 == cbRuns.StyleAt(3));
+		REQUIRE(0 == cbRuns.StyleAt(4));
+		REQUIRE(0 == cbRuns.StyleAt(5));
+		REQUIRE(5 == cbRuns.StyleAt(6));
+		cbRuns.InsertString(0, "z", 1, startSequence);
+		REQUIRE(0 == cbRuns.StyleAt(0));
+		REQUIRE(5 == cbRuns.StyleAt(1));
+	}
+
+	SECTION("MatchesBytes") {
+		// Perform the same modifications to both and check styles agree
+		for (int step = 0; step < 200; step++) {
+			const int length = static_cast<int>(cb.Length());
+			const int position = (step * 7) % length;
+			if (step % 3 == 0) {
+				cb.InsertString(position, "ab", 2, startSequence);
+				cbRuns.InsertString(position, "ab", 2, startSequence);
+			} else if ((step % 3 == 1) && (length > 20)) {
+				cb.DeleteChars(position / 2, 2, startSequence);
+				cbRuns.DeleteChars(position / 2, 2, startSequence);
+			} else {
+				const int lengthStyle = std::min(step % 11, length - position);
+				const char styleValue = static_cast<char>(step % 4);
+				REQUIRE(cb.SetStyleFor(position, lengthStyle, styleValue) ==
+					cbRuns.SetStyleFor(position, lengthStyle, styleValue));
+			}
+			REQUIRE(cb.Length() == cbRuns.Length());
+			std::vector<unsigned char> styles(cb.Length());
+			std::vector<unsigned char> stylesRuns(cb.Length());
+			cb.GetStyleRange(&styles[0], 0, cb.Length());
+			cbRuns.GetStyleRange(&stylesRuns[0], 0, cb.Length());
+			REQUIRE(styles == stylesRuns);
+		}
+	}
+
+}
+
+TEST_CASE("CellBufferStylesLazy") {
+
+	// Styles are not allocated until a non-zero style is set.
+
+	const char sText[] = "Scintilla\nlazy";
+	const int sLength = static_cast<int>(strlen(sText));
+
+	CellBuffer cb(false, false, true);
+	bool startSequence = false;
+	cb.InsertString(0, sText, sLength, startSequence);
+
+	SECTION("ZeroStylesDoNotAllocate") {
+		REQUIRE(!cb.StylesAllocated());
+		REQUIRE(0 == cb.StyleAt(3));
+		REQUIRE(!cb.SetStyleAt(3, 0));
+		REQUIRE(!cb.SetStyleFor(0, sLength, 0));
+		unsigned char styles[4] = {1, 1, 1, 1};
+		cb.GetStyleRange(styles, 2, 4);
+		const unsigned char stylesExpected[4] = {0, 0, 0, 0};
+		REQUIRE(memcmp(styles, stylesExpected, 4) == 0);
+		cb.DeleteChars(1, 3, startSequence);
+		REQUIRE(!cb.StylesAllocated());
+	}
+
+	SECTION("AllocateOnNonZero") {
+		REQUIRE(!cb.SetStyleAt(sLength, 4));
+		REQUIRE(!cb.StylesAllocated());
+		REQUIRE(cb.SetStyleFor(2, 3, 4));
+		REQUIRE(cb.StylesAllocated());
+		REQUIRE(0 == cb.StyleAt(1));
+		REQUIRE(4 == cb.StyleAt(2));
+		REQUIRE(4 == cb.StyleAt(4));
+		REQUIRE(0 == cb.StyleAt(5));
+		cb.InsertString(0, "ab", 2, startSequence);
+		REQUIRE(0 == cb.StyleAt(0));
+		REQUIRE(4 == cb.StyleAt(4));
+		REQUIRE(0 == cb.StyleAt(sLength + 1));
+	}
+
+}
@@ -0,0 +1,82 @@
+// Unit Tests for Scintilla internal data structures
+
+#include <string.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "Platform.h"
+
+#include "CharacterCategory.h"
+
+#include "catch.hpp"
+
+#ifdef SCI_NAMESPACE
+using namespace Scintilla;
+#endif
+
+// Test CharacterCategory.
+
+TEST_CASE("CharacterCategory") {
+
+	SECTION("Examples") {
+		REQUIRE(CategoriseCharacter('A') == ccLu);
+		REQUIRE(CategoriseCharacter('a') == ccLl);
+		REQUIRE(CategoriseCharacter('0') == ccNd);
+		REQUIRE(CategoriseCharacter(' ') == ccZs);
+		REQUIRE(CategoriseCharacter('\n') == ccCc);
+		REQUIRE(CategoriseCharacter(0x3B1) == ccLl);	// Greek alpha
+		REQUIRE(CategoriseCharacter(0x65E5) == ccLo);	// CJK ideograph
+		REQUIRE(CategoriseCharacter(0x1F600) == ccSo);	// Emoji
+		REQUIRE(CategoriseCharacter(0xD800) == ccCs);
+		REQUIRE(CategoriseCharacter(0xE000) == ccCo);
+		REQUIRE(CategoriseCharacter(0x10FFFF) == ccCn);
+	}
+
+	SECTION("OutOfRange") {
+		REQUIRE(CategoriseCharacter(-1) == ccCn);
+		REQUIRE(CategoriseCharacter(0x110000) == ccCn);
+		REQUIRE(CategoriseCharacter(0x7FFFFFFF) == ccCn);
+	}
+
+	SECTION("TablesMatchRanges") {
+		// Check every code point, only reporting the first difference
+		int firstDifferent = -1;
+		for (int ch = 0; ch <= 0x10FFFF; ch++) {
+			if (CategoriseCharacter(ch) != CategoriseCharacterByRanges(ch)) {
+				firstDifferent = ch;
+				break;
+			}
+		}
+		REQUIRE(firstDifferent == -1);
+	}
+}
+
+// Hidden so only run when requested with "unitTest [benchmark]".
+
+namespace {
+
+template <typename CATEGORISE>
+double TimeAllCharacters(CATEGORISE categorise, int &sum) {
+	const std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+	for (int repetition=0; repetition<20; repetition++) {
+		for (int ch = 0; ch <= 0x10FFFF; ch++) {
+			sum += categorise(ch);
+		}
+	}
+	const std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start;
+	return duration.count();
+}
+
+}
+
+TEST_CASE("CharacterCategoryPerformance", "[.][benchmark]") {
+	int sumTables = 0;
+	const double durationTables = TimeAllCharacters(CategoriseCharacter, sumTables);
+	printf("CategoriseCharacter 20 times over all characters: %.3f seconds\n", durationTables);
+	int sumRanges = 0;
+	const double durationRanges = TimeAllCharacters(CategoriseCharacterByRanges, sumRanges);
+	printf("CategoriseCharacterByRanges 20 times over all characters: %.3f seconds\n", durationRanges);
+	REQUIRE(sumTables == sumRanges);
+}
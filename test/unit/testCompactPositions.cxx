@@ -0,0 +1,125 @@
+// Unit Tests for Scintilla internal data structures
+
+#include <math.h>
+
+#include <vector>
+#include <algorithm>
+
+#include "Platform.h"
+
+#include "CompactPositions.h"
+
+#include "catch.hpp"
+
+#ifdef SCI_NAMESPACE
+using namespace Scintilla;
+#endif
+
+// Test CompactPositions.
+
+namespace {
+
+// Positions recreated from compact form are within half of 1/64 pixel of the original.
+const double tolerance = 0.5 / compactScale;
+
+// Positions for characters of the given widths.
+std::vector<XYPOSITION> PositionsFromWidths(const std::vector<double> &widths) {
+	std::vector<XYPOSITION> positions(1, 0);
+	double position = 0;
+	for (size_t i = 0; i < widths.size(); i++) {
+		position += widths[i];
+		positions.push_back(static_cast<XYPOSITION>(position));
+	}
+	return positions;
+}
+
+// Store and load positions returning the largest difference or -1 when they can not be stored.
+double RoundTrip(const std::vector<XYPOSITION> &positions) {
+	const int length = static_cast<int>(positions.size()) - 1;
+	std::vector<unsigned short> compact(length + 1);
+	if (!CompactPositionsStore(&positions[0], length, &compact[0]))
+		return -1;
+	std::vector<XYPOSITION> loaded(length + 1, -1);
+	CompactPositionsLoad(&compact[0], length, &loaded[0]);
+	double difference = 0;
+	for (int i = 0; i <= length; i++) {
+		difference = std::max(difference, fabs(static_cast<double>(loaded[i]) - positions[i]));
+	}
+	return difference;
+}
+
+}
+
+TEST_CASE("CompactPositions") {
+
+	SECTION("Empty") {
+		const std::vector<XYPOSITION> positions(1, 0);
+		REQUIRE(RoundTrip(positions) == 0);
+	}
+
+	SECTION("Exact") {
+		// Widths that are multiples of 1/64 pixel are stored exactly
+		std::vector<double> widths;
+		for (int i = 0; i < 200; i++)
+			widths.push_back((i % 17) + (i % 64) / 64.0);
+		REQUIRE(RoundTrip(PositionsFromWidths(widths)) == 0);
+	}
+
+	SECTION("Fractional") {
+		std::vector<double> widths;
+		for (int i = 0; i < 500; i++)
+			widths.push_back(7.0 + (i % 13) / 7.0);
+		const double difference = RoundTrip(PositionsFromWidths(widths));
+		REQUIRE(difference >= 0);
+		REQUIRE(difference <= tolerance);
+	}
+
+	SECTION("NoAccumulation") {
+		// Rounding each width alone would leave the end of the line 1/192 pixel out for each character
+		std::vector<double> widths(10000, 1.0 / 3.0);
+		const double difference = RoundTrip(PositionsFromWidths(widths));
+		REQUIRE(difference >= 0);
+		REQUIRE(difference <= tolerance);
+	}
+
+	SECTION("WidestCharacter") {
+		// 0xFFFF units of 1/64 pixel is the widest character that can be stored
+		std::vector<double> widths;
+		widths.push_back(8);
+		widths.push_back(0xFFFF / 64.0);
+		widths.push_back(8.5);
+		widths.push_back(1023.99);
+		widths.push_back(0.25);
+		const double difference = RoundTrip(PositionsFromWidths(widths));
+		REQUIRE(difference >= 0);
+		REQUIRE(difference <= tolerance);
+	}
+
+	SECTION("TooWide") {
+		std::vector<double> widths;
+		widths.push_back(8);
+		widths.push_back(1024);
+		REQUIRE(RoundTrip(PositionsFromWidths(widths)) < 0);
+		widths[1] = 0x10000 / 64.0 - 0.25 / 64.0;
+		REQUIRE(RoundTrip(PositionsFromWidths(widths)) < 0);
+	}
+
+	SECTION("Negative") {
+		std::vector<XYPOSITION> positions;
+		positions.push_back(0);
+		positions.push_back(10);
+		positions.push_back(9);
+		REQUIRE(RoundTrip(positions) < 0);
+	}
+
+	SECTION("LongLine") {
+		// Lines whose end can not be held in 1/64 pixel units of an int are not stored
+		std::vector<double> widths(16778, 1000);
+		REQUIRE(RoundTrip(PositionsFromWidths(widths)) < 0);
+		widths.pop_back();
+		const double difference = RoundTrip(PositionsFromWidths(widths));
+		REQUIRE(difference >= 0);
+		REQUIRE(difference <= tolerance);
+	}
+
+}
@@ -0,0 +1,127 @@
+// Unit Tests for Scintilla internal data structures
+
+#include <string.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "Platform.h"
+
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "CellBuffer.h"
+#include "CharClassify.h"
+#include "MultilineRegex.h"
+
+#include "catch.hpp"
+
+// Test MultilineRegex.
+
+namespace {
+
+// Split text into two pieces as if the gap was at position gap.
+class GappedText {
+	std::string before;
+	std::string after;
+public:
+	GappedText(const char *text, Sci::Position gap) : before(text, gap), after(text + gap) {
+	}
+	GapText Text() const {
+		return GapText(before.c_str(), before.length(), after.c_str(), before.length() + after.length());
+	}
+};
+
+}
+
+TEST_CASE("MultilineRegex") {
+
+	CharClassify charClass;
+	MultilineRegex regex;
+	const char sText[] = "one\ntwo\r\nthree four";
+	const Sci::Position sLength = static_cast<Sci::Position>(strlen(sText));
+
+	SECTION("MatchOverLineEnds") {
+		REQUIRE(regex.Compile("e\\nt", 4, true, false, &charClass) == 0);
+		for (Sci::Position gap = 0; gap <= sLength; gap++) {
+			GappedText gt(sText, gap);
+			REQUIRE(regex.Execute(gt.Text(), 0, sLength));
+			REQUIRE(regex.bopat[0] == 2);
+			REQUIRE(regex.eopat[0] == 5);
+		}
+	}
+
+	SECTION("Tags") {
+		const char *pattern = "\\(\\w+\\)\\s+\\(\\w+\\)";
+		REQUIRE(regex.Compile(pattern, strlen(pattern), true, false, &charClass) == 0);
+		GappedText gt(sText, 6);
+		REQUIRE(regex.Execute(gt.Text(), 4, sLength));
+		REQUIRE(regex.bopat[0] == 4);
+		REQUIRE(regex.eopat[0] == 14);
+		REQUIRE(regex.bopat[1] == 4);
+		REQUIRE(regex.eopat[1] == 7);
+		REQUIRE(regex.bopat[2] == 9);
+		REQUIRE(regex.eopat[2] == 14);
+		REQUIRE(regex.bopat[3] == -1);
+	}
+
+	SECTION("LineAssertions") {
+		REQUIRE(regex.Compile("^t", 2, true, false, &charClass) == 0);
+		GappedText gt(sText, 3);
+		REQUIRE(regex.Execute(gt.Text(), 5, sLength));
+		REQUIRE(regex.bopat[0] == 9);
+		// $ is before the \r\n line end, not between \r and \n
+		REQUIRE(regex.Compile("\\r$", 3, true, false, &charClass) == 0);
+		REQUIRE(!regex.Execute(gt.Text(), 0, sLength));
+		REQUIRE(regex.Compile("o$", 2, true, false, &charClass) == 0);
+		REQUIRE(regex.Execute(gt.Text(), 0, sLength));
+		REQUIRE(regex.bopat[0] == 6);
+		// Assertions at the end of the range look at the following text
+		REQUIRE(regex.Compile("thr$", 4, true, false, &charClass) == 0);
+		REQUIRE(!regex.Execute(gt.Text(), 0, 12));
+	}
+
+	SECTION("Alternation") {
+		REQUIRE(regex.Compile("four\\|two", 9, true, false, &charClass) == 0);
+		GappedText gt(sText, 10);
+		REQUIRE(regex.Execute(gt.Text(), 0, sLength));
+		REQUIRE(regex.bopat[0] == 4);
+		REQUIRE(regex.Execute(gt.Text(), 5, sLength));
+		REQUIRE(regex.bopat[0] == 15);
+		REQUIRE(regex.Compile("(f|t)(o|w)", 10, true, true, &charClass) == 0);
+		REQUIRE(regex.Execute(gt.Text(), 5, sLength));
+		REQUIRE(regex.bopat[0] == 15);
+		REQUIRE(regex.bopat[2] == 16);
+	}
+
+	SECTION("CaseInsensitive") {
+		REQUIRE(regex.Compile("O\\r\\nT", 6, false, false, &charClass) == 0);
+		GappedText gt(sText, 8);
+		REQUIRE(regex.Execute(gt.Text(), 0, sLength));
+		REQUIRE(regex.bopat[0] == 6);
+		REQUIRE(regex.eopat[0] == 10);
+	}
+
+	SECTION("LeftmostGreedy") {
+		REQUIRE(regex.Compile("o[^r]*", 6, true, false, &charClass) == 0);
+		GappedText gt(sText, 12);
+		REQUIRE(regex.Execute(gt.Text(), 0, sLength));
+		REQUIRE(regex.bopat[0] == 0);
+		REQUIRE(regex.eopat[0] == 11);
+		REQUIRE(regex.Compile("o[^r]*?e", 8, true, false, &charClass) == 0);
+		REQUIRE(regex.Execute(gt.Text(), 0, sLength));
+		REQUIRE(regex.eopat[0] == 3);
+	}
+
+	SECTION("Errors") {
+		REQUIRE(regex.Compile("*a", 2, true, false, &charClass) != 0);
+		REQUIRE(regex.Compile("\\(a", 3, true, false, &charClass) != 0);
+		REQUIRE(regex.Compile("a\\)", 3, true, false, &charClass) != 0);
+		REQUIRE(regex.Compile("[a", 2, true, false, &charClass) != 0);
+		REQUIRE(regex.Compile("\\(a\\)\\1", 7, true, false, &charClass) != 0);
+	}
+}
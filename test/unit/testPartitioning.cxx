@@ -1,15 +1,21 @@
 // Unit Tests for Scintilla internal data structures
 
 #include <string.h>
+#include <stdio.h>
+#include <limits.h>
+#include <stdint.h>
 
 #include <stdexcept>
+#include <vector>
 #include <algorithm>
+#include <chrono>
 
 #include "Platform.h"
 
 #include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
+#include "BlockedPartitioning.h"
 
 #include "catch.hpp"
 
@@ -22,7 +28,7 @@ static const int testArray[lengthTestArray] = {3, 4, 5, 6, 7, 8, 9, 10};
 
 TEST_CASE("SplitVectorWithRangeAdd") {
 
-	SplitVectorWithRangeAdd svwra(growSize);
+	SplitVectorWithRangeAdd<int> svwra(growSize);
 
 	SECTION("IsEmptyInitially") {
 		REQUIRE(0 == svwra.Length());
@@ -39,13 +45,29 @@ TEST_CASE("SplitVectorWithRangeAdd") {
 		}
 	}
 
+	SECTION("IncrementAcrossGap") {
+		// Long enough to use the vector loop with the gap in the middle of the range
+		for (int i=0; i<100; i++) {
+			svwra.Insert(i, i);
+		}
+		svwra.Insert(37, 1000);
+		svwra.Delete(37);
+		svwra.RangeAddDelta(3, 90, 5);
+		for (int i=0; i<svwra.Length(); i++) {
+			if ((i < 3) || (i >= 90))
+				REQUIRE(i == svwra.ValueAt(i));
+			else
+				REQUIRE((i+5) == svwra.ValueAt(i));
+		}
+	}
+
 }
 
 // Test Partitioning.
 
 TEST_CASE("Partitioning") {
 
-	Partitioning part(growSize);
+	Partitioning<int> part(growSize);
 
 	SECTION("IsEmptyInitially") {
 		REQUIRE(1 == part.Partitions());
@@ -126,6 +148,27 @@ TEST_CASE("Partitioning") {
 		REQUIRE(2 == part.PositionFromPartition(1));
 	}
 
+	SECTION("DeletePartitions") {
+		// Step before, inside and after the removed range
+		for (int stepAt=1; stepAt<10; stepAt+=3) {
+			part.DeleteAll();
+			part.InsertText(0, 20);
+			for (int i=1; i<10; i++) {
+				part.InsertPartition(i, i * 2);
+			}
+			part.InsertText(stepAt, 1);
+			part.RemovePartitions(4, 3);
+			REQUIRE(7 == part.Partitions());
+			REQUIRE(0 == part.PositionFromPartition(0));
+			for (int i=1; i<7; i++) {
+				const int lineOriginal = (i < 4) ? i : (i + 3);
+				const int expected = lineOriginal * 2 + ((lineOriginal > stepAt) ? 1 : 0);
+				REQUIRE(expected == part.PositionFromPartition(i));
+			}
+			REQUIRE(21 == part.PositionFromPartition(7));
+		}
+	}
+
 	SECTION("DeleteAll") {
 		part.InsertText(0, 3);
 		part.InsertPartition(1, 2);
@@ -182,3 +225,241 @@ TEST_CASE("Partitioning") {
 	}
 
 }
+
+namespace {
+
+// Simple repeatable pseudo random sequence
+class Sequence {
+	unsigned int value;
+public:
+	explicit Sequence(unsigned int seed) : value(seed) {
+	}
+	int Next(int range) {
+		value = value * 1103515245 + 12345;
+		return static_cast<int>((value >> 8) % range);
+	}
+};
+
+template <typename PARTITIONING>
+void FillLines(PARTITIONING &part, int lines, int lineLength) {
+	part.InsertText(0, lines * lineLength);
+	for (int line=1; line<lines; line++) {
+		part.InsertPartition(line, line * lineLength);
+	}
+}
+
+}
+
+// Test BlockedPartitioning.
+
+TEST_CASE("BlockedPartitioning") {
+
+	BlockedPartitioning<ptrdiff_t> part(growSize);
+
+	SECTION("IsEmptyInitially") {
+		REQUIRE(1 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(part.Partitions()));
+		REQUIRE(0 == part.PartitionFromPosition(0));
+	}
+
+	SECTION("MoveStart") {
+		part.InsertText(0, 3);
+		part.InsertPartition(1, 2);
+		part.SetPartitionStartPosition(1,1);
+		REQUIRE(2 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(0));
+		REQUIRE(1 == part.PositionFromPartition(1));
+		REQUIRE(3 == part.PositionFromPartition(2));
+		REQUIRE(0 == part.PartitionFromPosition(0));
+		REQUIRE(1 == part.PartitionFromPosition(2));
+		REQUIRE(1 == part.PartitionFromPosition(3));
+	}
+
+	SECTION("DeleteAll") {
+		FillLines(part, 100, 3);
+		part.DeleteAll();
+		REQUIRE(1 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(part.Partitions()));
+	}
+
+	SECTION("MatchesPartitioning") {
+		// Perform the same random operations on both and check they agree
+		Partitioning<int> partRef(growSize);
+		FillLines(part, 50, 4);
+		FillLines(partRef, 50, 4);
+		Sequence seq(1);
+		for (int op=0; op<5000; op++) {
+			const int partitions = partRef.Partitions();
+			switch (seq.Next(5)) {
+			case 0: {
+					const int partition = seq.Next(partitions);
+					const int delta = seq.Next(20) + 1;
+					part.InsertText(partition, delta);
+					partRef.InsertText(partition, delta);
+				}
+				break;
+			case 1: {
+					// Delete within one partition
+					const int partition = seq.Next(partitions);
+					const int length = partRef.PositionFromPartition(partition+1) -
+						partRef.PositionFromPartition(partition);
+					if (length > 1) {
+						const int delta = seq.Next(length - 1) + 1;
+						part.InsertText(partition, -delta);
+						partRef.InsertText(partition, -delta);
+					}
+				}
+				break;
+			case 2: {
+					const int partition = seq.Next(partitions) + 1;
+					const int start = partRef.PositionFromPartition(partition-1);
+					const int length = partRef.PositionFromPartition(partition) - start;
+					if (length > 1) {
+						const int pos = start + seq.Next(length - 1) + 1;
+						part.InsertPartition(partition, pos);
+						partRef.InsertPartition(partition, pos);
+					}
+				}
+				break;
+			case 3:
+				if (partitions > 1) {
+					const int partition = seq.Next(partitions - 1) + 1;
+					part.RemovePartition(partition);
+					partRef.RemovePartition(partition);
+				}
+				break;
+			case 4:
+				if (partitions > 1) {
+					const int partition = seq.Next(partitions - 1) + 1;
+					const int start = partRef.PositionFromPartition(partition-1);
+					const int length = partRef.PositionFromPartition(partition+1) - start;
+					if (length > 1) {
+						const int pos = start + seq.Next(length - 1) + 1;
+						part.SetPartitionStartPosition(partition, pos);
+						partRef.SetPartitionStartPosition(partition, pos);
+					}
+				}
+				break;
+			}
+			REQUIRE(partRef.Partitions() == part.Partitions());
+			const int check = seq.Next(partRef.Partitions() + 1);
+			REQUIRE(partRef.PositionFromPartition(check) == part.PositionFromPartition(check));
+			const int posCheck = seq.Next(partRef.PositionFromPartition(partRef.Partitions()) + 2);
+			REQUIRE(partRef.PartitionFromPosition(posCheck) == part.PartitionFromPosition(posCheck));
+		}
+		for (int partition=0; partition<=partRef.Partitions(); partition++) {
+			REQUIRE(partRef.PositionFromPartition(partition) == part.PositionFromPartition(partition));
+		}
+	}
+
+	SECTION("InsertPartitions") {
+		// Insert enough partitions in one call to split the block several times
+		Partitioning<int> partRef(growSize);
+		FillLines(part, 50, 2000);
+		FillLines(partRef, 50, 2000);
+		std::vector<ptrdiff_t> positions;
+		std::vector<int> positionsRef;
+		for (int i=1; i<=1500; i++) {
+			positions.push_back(10 * 2000 + i);
+			positionsRef.push_back(10 * 2000 + i);
+		}
+		part.InsertPartitions(11, positions.data(), positions.size());
+		partRef.InsertPartitions(11, positionsRef.data(), positionsRef.size());
+		REQUIRE(1550 == part.Partitions());
+		REQUIRE(partRef.Partitions() == part.Partitions());
+		for (int partition=0; partition<=partRef.Partitions(); partition++) {
+			REQUIRE(partRef.PositionFromPartition(partition) == part.PositionFromPartition(partition));
+		}
+		for (int pos=19990; pos<21600; pos++) {
+			REQUIRE(partRef.PartitionFromPosition(pos) == part.PartitionFromPosition(pos));
+		}
+	}
+
+	SECTION("RemovePartitions") {
+		// Remove ranges that start inside blocks, at block starts and cover whole blocks
+		Partitioning<int> partRef(growSize);
+		FillLines(part, 200, 10);
+		FillLines(partRef, 200, 10);
+		Sequence seq(3);
+		while (partRef.Partitions() > 2) {
+			const int partition = seq.Next(partRef.Partitions() - 1) + 1;
+			const int lengthRemove = seq.Next(partRef.Partitions() - partition) + 1;
+			part.RemovePartitions(partition, lengthRemove);
+			partRef.RemovePartitions(partition, lengthRemove);
+			REQUIRE(partRef.Partitions() == part.Partitions());
+			for (int p=0; p<=partRef.Partitions(); p++) {
+				REQUIRE(partRef.PositionFromPartition(p) == part.PositionFromPartition(p));
+			}
+			part.InsertText(0, 1);
+			partRef.InsertText(0, 1);
+		}
+	}
+
+#if PTRDIFF_MAX > INT_MAX
+	SECTION("WideOffsets") {
+		// Lines longer than an int offset force blocks to split
+		const ptrdiff_t big = static_cast<ptrdiff_t>(INT_MAX) + 10;
+		FillLines(part, 20, 10);
+		part.InsertText(5, big);
+		part.InsertText(12, big);
+		REQUIRE(20 == part.Partitions());
+		REQUIRE(50 == part.PositionFromPartition(5));
+		REQUIRE(part.PositionFromPartition(6) == (60 + big));
+		REQUIRE(part.PositionFromPartition(13) == (130 + 2 * big));
+		REQUIRE(part.PositionFromPartition(20) == (200 + 2 * big));
+		REQUIRE(5 == part.PartitionFromPosition(big));
+		REQUIRE(6 == part.PartitionFromPosition(60 + big));
+		REQUIRE(12 == part.PartitionFromPosition(130 + big));
+		REQUIRE(13 == part.PartitionFromPosition(130 + 2 * big));
+		part.InsertPartition(6, 55 + big);
+		REQUIRE(part.PositionFromPartition(6) == (55 + big));
+		REQUIRE(part.PositionFromPartition(7) == (60 + big));
+		part.InsertText(5, -big);
+		part.RemovePartition(6);
+		REQUIRE(60 == part.PositionFromPartition(6));
+		REQUIRE(part.PositionFromPartition(13) == (130 + big));
+		REQUIRE(6 == part.PartitionFromPosition(65));
+	}
+#endif
+
+}
+
+// Time inserting near the start of a document with many lines.
+// Hidden so only run when requested with "unitTest [benchmark]".
+
+namespace {
+
+template <typename PARTITIONING>
+double TimeEditsNearStart(PARTITIONING &part) {
+	const int lines = 10000000;
+	FillLines(part, lines, 10);
+	const std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+	Sequence seq(2);
+	for (int edit=0; edit<1000; edit++) {
+		// Alternating between two lines forces the step to be applied each time
+		const int line = seq.Next(100);
+		part.InsertText(line, 1);
+		part.InsertText(lines - 1 - line, 1);
+	}
+	const std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start;
+	REQUIRE(part.PositionFromPartition(lines) == (lines * 10 + 2000));
+	return duration.count();
+}
+
+}
+
+TEST_CASE("PartitioningPerformance", "[.][benchmark]") {
+
+	SECTION("RangeAddDelta") {
+		Partitioning<int> part(growSize);
+		const double duration = TimeEditsNearStart(part);
+		printf("Partitioning<int> 2000 edits on 10M lines: %.3f seconds\n", duration);
+	}
+
+	SECTION("Blocked") {
+		BlockedPartitioning<ptrdiff_t> part(256);
+		const double duration = TimeEditsNearStart(part);
+		printf("BlockedPartitioning<ptrdiff_t> 2000 edits on 10M lines: %.3f seconds\n", duration);
+	}
+
+}
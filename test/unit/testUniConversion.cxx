@@ -0,0 +1,227 @@
+// Unit Tests for Scintilla internal data structures
+
+#include <string.h>
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+
+#include "Platform.h"
+
+#include "UniConversion.h"
+
+#include "catch.hpp"
+
+#ifdef SCI_NAMESPACE
+using namespace Scintilla;
+#endif
+
+// Test UniConversion.
+// The conversions examine many bytes at once when they can so are checked against
+// simple implementations that examine one character at a time.
+
+namespace {
+
+size_t UTF16LengthByCharacter(const char *s, size_t len) {
+	size_t ulen = 0;
+	for (size_t i = 0; i < len;) {
+		const unsigned char ch = static_cast<unsigned char>(s[i]);
+		i += UTF8CharLength(ch);
+		ulen += (ch >= 0xF0) ? 2 : 1;
+	}
+	return ulen;
+}
+
+// Steps through text as Document::NextPosition does.
+void CountByCharacter(const char *s, size_t lenCount, size_t lenAvailable, size_t &characters, size_t &utf16Length) {
+	const unsigned char *us = reinterpret_cast<const unsigned char *>(s);
+	for (size_t i = 0; i < lenCount;) {
+		const int utf8Status = UTF8Classify(us + i, static_cast<int>(std::min<size_t>(lenAvailable - i, UTF8MaxBytes)));
+		const int widthChar = (utf8Status & UTF8MaskInvalid) ? 1 : (utf8Status & UTF8MaskWidth);
+		characters++;
+		utf16Length += (widthChar == 4) ? 2 : 1;
+		i += widthChar;
+	}
+}
+
+// Deterministic text that mixes ASCII, valid characters of each length, and, when invalid
+// is true, the byte sequences UTF8Classify treats specially.
+std::string MixedText(unsigned int seed, size_t length, bool invalid) {
+	static const char *pieces[] = {
+		"a", "Scintilla ", "\r\n", "\xC2\xA9", "\xCE\xB1\xCE\xB2", "\xE2\x82\xAC", "\xE6\x97\xA5\xE6\x9C\xAC",
+		"\xE0\xA4\x95", "\xED\x9F\xBF", "\xEF\xBC\xA1", "\xF0\x9F\x98\x80", "\xF0\x90\x80\x80", "\xF4\x8F\xBF\xBD",
+		"\x80", "\xBF", "\xC0\xAF", "\xC1\xBF", "\xE0\x80\xAF", "\xED\xA0\x80", "\xEF\xBF\xBE", "\xEF\xBF\xBF",
+		"\xEF\xB7\x90", "\xEF\xB7\xAF", "\xF0\x8F\xBF\xBF", "\xF4\x90\x80\x80", "\xF0\x9F\xBF\xBE", "\xF5\x80",
+		"\xF8", "\xFF", "\xC3", "\xE2\x82", "\xF0\x9F\x98",
+	};
+	const size_t countPieces = invalid ? sizeof(pieces) / sizeof(pieces[0]) : 13;
+	std::string text;
+	unsigned int state = seed;
+	while (text.length() < length) {
+		state = state * 1103515245 + 12345;
+		const unsigned int choice = (state >> 16) % (countPieces * 2);
+		// Half of the time choose ASCII so there are both long and short runs of it
+		text += (choice < countPieces) ? pieces[choice] : "z";
+	}
+	text.resize(length);
+	return text;
+}
+
+}
+
+TEST_CASE("UniConversion") {
+
+	SECTION("UTF16Length") {
+		REQUIRE(UTF16Length("", 0) == 0);
+		REQUIRE(UTF16Length("abc", 3) == 3);
+		REQUIRE(UTF16Length("\xE6\x97\xA5\xE6\x9C\xAC", 6) == 2);
+		REQUIRE(UTF16Length("\xF0\x9F\x98\x80", 4) == 2);
+		const std::string longAscii(1000, 'x');
+		REQUIRE(UTF16Length(longAscii.c_str(), longAscii.length()) == 1000);
+	}
+
+	SECTION("UTF16FromUTF8") {
+		const char s[] = "ab\xC2\xA9\xE2\x82\xAC\xF0\x9F\x98\x80" "0123456789abcdefghijklmnopqrstuvwxyz";
+		wchar_t tbuf[60] = L"";
+		const size_t ulen = UTF16FromUTF8(s, strlen(s), tbuf, 60);
+		REQUIRE(ulen == 42);
+		REQUIRE(tbuf[0] == 'a');
+		REQUIRE(tbuf[2] == 0xA9);
+		REQUIRE(tbuf[3] == 0x20AC);
+		REQUIRE(tbuf[4] == 0xD83D);
+		REQUIRE(tbuf[5] == 0xDE00);
+		REQUIRE(tbuf[6] == '0');
+		REQUIRE(tbuf[41] == 'z');
+	}
+
+	SECTION("UTF16FromUTF8StopsAtEndOfBuffer") {
+		const std::string s(40, 'q');
+		std::vector<wchar_t> tbuf(41, 0);
+		REQUIRE(UTF16FromUTF8(s.c_str(), s.length(), &tbuf[0], 20) == 20);
+		REQUIRE(tbuf[19] == 'q');
+		// The vectorized conversion may only write within the 20 elements allowed
+		REQUIRE(tbuf[20] == 0);
+	}
+
+	SECTION("UTF32FromUTF8") {
+		const char s[] = "0123456789abcdefghij\xF0\x9F\x98\x80\xCE\xB1";
+		unsigned int tbuf[30] = {0};
+		const unsigned int ulen = UTF32FromUTF8(s, static_cast<unsigned int>(strlen(s)), tbuf, 30);
+		REQUIRE(ulen == 22);
+		REQUIRE(tbuf[0] == 0x30);
+		REQUIRE(tbuf[19] == 0x6A);
+		REQUIRE(tbuf[20] == 0x1F600);
+		REQUIRE(tbuf[21] == 0x3B1);
+	}
+
+	SECTION("CountCharacters") {
+		const char s[] = "a\xC2\xA9\xF0\x9F\x98\x80\x80\xEF\xBF\xBE";
+		size_t characters = 0;
+		size_t utf16Length = 0;
+		const size_t len = strlen(s);
+		REQUIRE(UTF8CountCharacters(s, len, len, characters, utf16Length) == len);
+		// The trail byte and each byte of the non-character U+FFFE count as characters
+		REQUIRE(characters == 7);
+		REQUIRE(utf16Length == 8);
+	}
+
+	SECTION("CountCharactersStopsAfterCharacter") {
+		const char s[] = "0123456789abcde\xE2\x82\xAC";
+		size_t characters = 0;
+		size_t utf16Length = 0;
+		REQUIRE(UTF8CountCharacters(s, 16, 18, characters, utf16Length) == 18);
+		REQUIRE(characters == 16);
+	}
+
+	SECTION("MatchesCharacterByCharacter") {
+		for (unsigned int seed = 1; seed <= 200; seed++) {
+			const std::string text = MixedText(seed, seed * 7, (seed % 2) == 1);
+			const char *s = text.c_str();
+			const size_t len = text.length();
+			REQUIRE(UTF16Length(s, len) == UTF16LengthByCharacter(s, len));
+
+			std::vector<wchar_t> tbuf(len + 1);
+			std::vector<wchar_t> tbufExpected(len + 1);
+			const size_t ulen = UTF16FromUTF8(s, len, &tbuf[0], len);
+			size_t ulenExpected = 0;
+			for (size_t i = 0; i < len;) {
+				// Converting one character at a time avoids the vectorized path for ASCII
+				const size_t widthChar = std::min<size_t>(UTF8CharLength(static_cast<unsigned char>(s[i])), len - i);
+				ulenExpected += UTF16FromUTF8(s + i, widthChar, &tbufExpected[ulenExpected], len - ulenExpected);
+				i += widthChar;
+			}
+			REQUIRE(ulen == ulenExpected);
+			REQUIRE(std::equal(tbuf.begin(), tbuf.begin() + ulen, tbufExpected.begin()));
+
+			std::vector<unsigned int> u32(len + 1);
+			std::vector<unsigned int> u32Expected(len + 1);
+			const unsigned int lenU = static_cast<unsigned int>(len);
+			const unsigned int ulen32 = UTF32FromUTF8(s, lenU, &u32[0], lenU);
+			unsigned int ulen32Expected = 0;
+			for (unsigned int i = 0; i < lenU;) {
+				const unsigned int widthChar = std::min(UTF8CharLength(static_cast<unsigned char>(s[i])), lenU - i);
+				ulen32Expected += UTF32FromUTF8(s + i, widthChar, &u32Expected[ulen32Expected], lenU - ulen32Expected);
+				i += widthChar;
+			}
+			REQUIRE(ulen32 == ulen32Expected);
+			REQUIRE(std::equal(u32.begin(), u32.begin() + ulen32, u32Expected.begin()));
+
+			for (size_t lenCount = len / 2; lenCount <= len; lenCount += len / 2 + 1) {
+				size_t characters = 0;
+				size_t utf16Length = 0;
+				UTF8CountCharacters(s, lenCount, len, characters, utf16Length);
+				size_t charactersExpected = 0;
+				size_t utf16LengthExpected = 0;
+				CountByCharacter(s, lenCount, len, charactersExpected, utf16LengthExpected);
+				REQUIRE(characters == charactersExpected);
+				REQUIRE(utf16Length == utf16LengthExpected);
+			}
+		}
+	}
+}
+
+// Hidden so only run when requested with "unitTest [benchmark]".
+
+TEST_CASE("UniConversionPerformance", "[.][benchmark]") {
+	const size_t lengthText = 200 * 1024 * 1024;
+	const char *kinds[] = { "ASCII", "Multilingual", "Partly invalid" };
+	for (int kind = 0; kind < 3; kind++) {
+		const std::string text = (kind == 0) ? std::string(lengthText, 'x') : MixedText(1, lengthText, kind == 2);
+		printf("%s text:\n", kinds[kind]);
+
+		std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		const size_t ulen = UTF16Length(text.c_str(), text.length());
+		std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start;
+		printf("UTF16Length %.3f seconds\n", duration.count());
+
+		start = std::chrono::high_resolution_clock::now();
+		const size_t ulenByCharacter = UTF16LengthByCharacter(text.c_str(), text.length());
+		duration = std::chrono::high_resolution_clock::now() - start;
+		printf("UTF16Length by character %.3f seconds\n", duration.count());
+		REQUIRE(ulen == ulenByCharacter);
+
+		std::vector<wchar_t> tbuf(ulen);
+		start = std::chrono::high_resolution_clock::now();
+		UTF16FromUTF8(text.c_str(), text.length(), &tbuf[0], ulen);
+		duration = std::chrono::high_resolution_clock::now() - start;
+		printf("UTF16FromUTF8 %.3f seconds\n", duration.count());
+
+		size_t characters = 0;
+		size_t utf16Length = 0;
+		start = std::chrono::high_resolution_clock::now();
+		UTF8CountCharacters(text.c_str(), text.length(), text.length(), characters, utf16Length);
+		duration = std::chrono::high_resolution_clock::now() - start;
+		printf("UTF8CountCharacters %.3f seconds\n", duration.count());
+
+		size_t charactersByCharacter = 0;
+		size_t utf16LengthByCharacter = 0;
+		start = std::chrono::high_resolution_clock::now();
+		CountByCharacter(text.c_str(), text.length(), text.length(), charactersByCharacter, utf16LengthByCharacter);
+		duration = std::chrono::high_resolution_clock::now() - start;
+		printf("UTF8CountCharacters by character %.3f seconds\n", duration.count());
+		REQUIRE(characters == charactersByCharacter);
+		REQUIRE(utf16Length == utf16LengthByCharacter);
+	}
+}
@@ -564,6 +564,8 @@ public:
 
 	void SetUnicodeMode(bool unicodeMode_);
 	void SetDBCSMode(int codePage_);
+
+	Surface *AllocateMeasuringSurface();
 };
 
 SurfaceGDI::SurfaceGDI() :
@@ -1055,6 +1057,16 @@ void SurfaceGDI::SetDBCSMode(int codePage_) {
 	codePage = codePage_;
 }
 
+// Fonts may be selected into device contexts on several threads so each thread measures
+// with its own memory device context.
+Surface *SurfaceGDI::AllocateMeasuringSurface() {
+	SurfaceGDI *surface = new SurfaceGDI();
+	surface->Init(0);
+	surface->SetUnicodeMode(unicodeMode);
+	surface->SetDBCSMode(codePage);
+	return surface;
+}
+
 #if defined(USE_D2D)
 
 class SurfaceD2D : public Surface {
@@ -1134,6 +1146,8 @@ public:
 
 	void SetUnicodeMode(bool unicodeMode_);
 	void SetDBCSMode(int codePage_);
+
+	Surface *AllocateMeasuringSurface();
 };
 
 SurfaceD2D::SurfaceD2D() :
@@ -1767,6 +1781,16 @@ void SurfaceD2D::SetDBCSMode(int codePage_) {
 	// No action on window as automatically handled by system.
 	codePage = codePage_;
 }
+
+// Text is measured with the shared DirectWrite factory and the font's immutable text format
+// so no render target is needed.
+Surface *SurfaceD2D::AllocateMeasuringSurface() {
+	SurfaceD2D *surface = new SurfaceD2D();
+	surface->Init(0);
+	surface->SetUnicodeMode(unicodeMode);
+	surface->SetDBCSMode(codePage);
+	return surface;
+}
 #endif
 
 Surface *Surface::Allocate(int technology) {
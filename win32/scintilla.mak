@@ -49,6 +49,10 @@ CXXFLAGS=$(CXXFLAGS) -DDISABLE_D2D
 CXXFLAGS=$(CXXFLAGS) -DNO_CXX11_REGEX
 !ENDIF
 
+!IFDEF NO_CXX11_THREADS
+CXXFLAGS=$(CXXFLAGS) -DNO_CXX11_THREADS
+!ENDIF
+
 !IFDEF DEBUG
 CXXFLAGS=$(CXXFLAGS) $(CXXDEBUG)
 LDFLAGS=$(LDDEBUG) $(LDFLAGS)
@@ -84,6 +88,7 @@ SHAREDOBJS=\
 	$(DIR_O)\KeyMap.obj \
 	$(DIR_O)\LineMarker.obj \
 	$(DIR_O)\MarginView.obj \
+	$(DIR_O)\MultilineRegex.obj \
 	$(DIR_O)\PerLine.obj \
 	$(DIR_O)\PlatWin.obj \
 	$(DIR_O)\PositionCache.obj \
@@ -329,6 +334,7 @@ $(DIR_O)\CellBuffer.obj: \
 	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
+	../src/BlockedPartitioning.h \
 	../src/CellBuffer.h \
 	../src/UniConversion.h
 $(DIR_O)\CharacterCategory.obj: \
@@ -377,6 +383,7 @@ $(DIR_O)\Document.obj: \
 	../src/CaseFolder.h \
 	../src/Document.h \
 	../src/RESearch.h \
+	../src/MultilineRegex.h \
 	../src/UniConversion.h \
 	../src/UnicodeFromUTF8.h
 $(DIR_O)\EditModel.obj: \
@@ -791,6 +798,16 @@ $(DIR_O)\MarginView.obj: \
 	../src/EditModel.h \
 	../src/MarginView.h \
 	../src/EditView.h
+$(DIR_O)\MultilineRegex.obj: \
+	../src/MultilineRegex.cxx \
+	../include/Platform.h \
+	../src/Position.h \
+	../src/SplitVector.h \
+	../src/Partitioning.h \
+	../src/RunStyles.h \
+	../src/CellBuffer.h \
+	../src/CharClassify.h \
+	../src/MultilineRegex.h
 $(DIR_O)\PerLine.obj: \
 	../src/PerLine.cxx \
 	../include/Platform.h \
@@ -832,7 +849,8 @@ $(DIR_O)\PositionCache.obj: \
 	../src/Document.h \
 	../src/UniConversion.h \
 	../src/Selection.h \
-	../src/PositionCache.h
+	../src/PositionCache.h \
+	../src/CompactPositions.h
 $(DIR_O)\PropSetSimple.obj: \
 	../lexlib/PropSetSimple.cxx \
 	../lexlib/PropSetSimple.h